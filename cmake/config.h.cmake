@@ -54,8 +54,13 @@
 #cmakedefine HAVE_MPI_QUERY_THREAD
 #cmakedefine HAVE_MPI3_NONBLOCKING_COLLECTIVES
 #cmakedefine HAVE_MPIX_NONBLOCKING_COLLECTIVES
+#cmakedefine HAVE_MPI_LARGE_COUNT
+#cmakedefine HAVE_MPI3_SHARED_MEMORY
 #cmakedefine REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
 #cmakedefine USE_BYTE_ALLGATHERS
+#cmakedefine HAVE_SYS_MMAN_H
+#cmakedefine HAVE_MADVISE
+#cmakedefine HAVE_MBIND
 
 /* Advanced configuration options */
 #cmakedefine CACHE_WARNINGS
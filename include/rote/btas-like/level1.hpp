@@ -15,6 +15,7 @@
 #include "level1/Elemscal.hpp"
 #include "level1/Norm.hpp"
 #include "level1/Reduce.hpp"
+#include "level1/TransposePlan.hpp"
 #include "level1/Permute.hpp"
 #include "level1/Scal.hpp"
 #include "level1/YAxpBy.hpp"
@@ -25,5 +26,6 @@
 #include "level1/ZAxpBypPx.hpp"
 #include "level1/GenZAxpBypPx.hpp"
 #include "level1/SetAllVal.hpp"
+#include "level1/Expr.hpp"
 
 #endif // ifndef ROTE_BTAS_LEVEL1_HPP
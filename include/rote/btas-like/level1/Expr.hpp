@@ -0,0 +1,568 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ROTE_BTAS_EXPR_HPP
+#define ROTE_BTAS_EXPR_HPP
+
+#ifdef HAVE_OPENMP
+# include <omp.h>
+#endif
+
+namespace rote{
+
+// Number of elements below which an expression is not split across threads
+#define EXPR_PARALLEL_THRESHOLD 32768
+
+// Lazy elementwise expressions over Tensors or DistTensors, e.g.
+//
+//   Z = alpha*X + beta*Y + gamma*Permuted(X, perm);
+//
+// Nothing is computed until the expression is assigned.  Assignment runs a
+// single loop nest over the strides of every operand instead of one pass per
+// level-1 routine.  For DistTensors, an operand whose distribution does not
+// line up with Z is redistributed once into a temporary beforehand, shared
+// by every term using that operand under the same permutation.
+
+template<typename T, typename E>
+class ExprBase
+{
+public:
+    const E& Derived() const { return static_cast<const E&>(*this); }
+};
+
+////////////////////////////////////
+// Operands
+////////////////////////////////////
+
+// Mode i of the term is mode perm[i] of A
+template<typename T>
+class TensorTerm : public ExprBase<T, TensorTerm<T> >
+{
+public:
+    static const Unsigned numLeaves = 1;
+
+    TensorTerm( const Tensor<T>& A ) : A_(&A), perm_(A.Order()) { }
+    TensorTerm( const Tensor<T>& A, const Permutation& perm ) : A_(&A), perm_(perm) { }
+
+    const Tensor<T>& Operand() const { return *A_; }
+    const Permutation& Perm() const { return perm_; }
+    ObjShape Shape() const { return perm_.applyTo(A_->Shape()); }
+
+    template<typename Binder>
+    void Bind( Binder& binder ) const { binder.Add(*this); }
+
+    T Eval( T const * const * bufs, const Offset* strides, Unsigned i ) const
+    { return bufs[0][i * strides[0]]; }
+    T EvalUnit( T const * const * bufs, Unsigned i ) const
+    { return bufs[0][i]; }
+
+private:
+    const Tensor<T>* A_;
+    Permutation perm_;
+};
+
+// Mode i of the term is mode perm[i] of A
+template<typename T>
+class DistTensorTerm : public ExprBase<T, DistTensorTerm<T> >
+{
+public:
+    static const Unsigned numLeaves = 1;
+
+    DistTensorTerm( const DistTensor<T>& A ) : A_(&A), perm_(A.Order()) { }
+    DistTensorTerm( const DistTensor<T>& A, const Permutation& perm ) : A_(&A), perm_(perm) { }
+
+    const DistTensor<T>& Operand() const { return *A_; }
+    const Permutation& Perm() const { return perm_; }
+    ObjShape Shape() const { return perm_.applyTo(A_->Shape()); }
+
+    template<typename Binder>
+    void Bind( Binder& binder ) const { binder.Add(*this); }
+
+    T Eval( T const * const * bufs, const Offset* strides, Unsigned i ) const
+    { return bufs[0][i * strides[0]]; }
+    T EvalUnit( T const * const * bufs, Unsigned i ) const
+    { return bufs[0][i]; }
+
+private:
+    const DistTensor<T>* A_;
+    Permutation perm_;
+};
+
+template<typename T>
+inline TensorTerm<T>
+Permuted( const Tensor<T>& A, const Permutation& perm )
+{ return TensorTerm<T>(A, perm); }
+
+template<typename T>
+inline DistTensorTerm<T>
+Permuted( const DistTensor<T>& A, const Permutation& perm )
+{ return DistTensorTerm<T>(A, perm); }
+
+////////////////////////////////////
+// Operations
+////////////////////////////////////
+
+template<typename T, typename E>
+class ScaledExpr : public ExprBase<T, ScaledExpr<T, E> >
+{
+public:
+    static const Unsigned numLeaves = E::numLeaves;
+
+    ScaledExpr( T alpha, const E& e ) : alpha_(alpha), e_(e) { }
+
+    ObjShape Shape() const { return e_.Shape(); }
+
+    template<typename Binder>
+    void Bind( Binder& binder ) const { e_.Bind(binder); }
+
+    T Eval( T const * const * bufs, const Offset* strides, Unsigned i ) const
+    { return alpha_ * e_.Eval(bufs, strides, i); }
+    T EvalUnit( T const * const * bufs, Unsigned i ) const
+    { return alpha_ * e_.EvalUnit(bufs, i); }
+
+private:
+    T alpha_;
+    E e_;
+};
+
+struct ExprAdd { template<typename T> static T Apply( T a, T b ) { return a + b; } };
+struct ExprSub { template<typename T> static T Apply( T a, T b ) { return a - b; } };
+struct ExprMul { template<typename T> static T Apply( T a, T b ) { return a * b; } };
+
+template<typename T, typename L, typename R, typename Op>
+class BinaryExpr : public ExprBase<T, BinaryExpr<T, L, R, Op> >
+{
+public:
+    static const Unsigned numLeaves = L::numLeaves + R::numLeaves;
+
+    BinaryExpr( const L& l, const R& r ) : l_(l), r_(r) { }
+
+    ObjShape Shape() const
+    {
+#ifndef RELEASE
+        if(l_.Shape() != r_.Shape())
+            LogicError("Expression operands must have the same shape");
+#endif
+        return l_.Shape();
+    }
+
+    template<typename Binder>
+    void Bind( Binder& binder ) const { l_.Bind(binder); r_.Bind(binder); }
+
+    T Eval( T const * const * bufs, const Offset* strides, Unsigned i ) const
+    { return Op::Apply(l_.Eval(bufs, strides, i), r_.Eval(bufs + L::numLeaves, strides + L::numLeaves, i)); }
+    T EvalUnit( T const * const * bufs, Unsigned i ) const
+    { return Op::Apply(l_.EvalUnit(bufs, i), r_.EvalUnit(bufs + L::numLeaves, i)); }
+
+private:
+    L l_;
+    R r_;
+};
+
+////////////////////////////////////
+// Operators
+////////////////////////////////////
+
+// Maps anything usable in an expression to its expression type
+template<typename X>
+struct ExprOperand { static const bool value = false; };
+
+template<typename T>
+struct ExprOperand<Tensor<T> >
+{
+    static const bool value = true;
+    typedef T type;
+    typedef TensorTerm<T> expr;
+    static expr Wrap( const Tensor<T>& A ) { return expr(A); }
+};
+
+template<typename T>
+struct ExprOperand<DistTensor<T> >
+{
+    static const bool value = true;
+    typedef T type;
+    typedef DistTensorTerm<T> expr;
+    static expr Wrap( const DistTensor<T>& A ) { return expr(A); }
+};
+
+template<typename T>
+struct ExprOperand<TensorTerm<T> >
+{
+    static const bool value = true;
+    typedef T type;
+    typedef TensorTerm<T> expr;
+    static const expr& Wrap( const expr& e ) { return e; }
+};
+
+template<typename T>
+struct ExprOperand<DistTensorTerm<T> >
+{
+    static const bool value = true;
+    typedef T type;
+    typedef DistTensorTerm<T> expr;
+    static const expr& Wrap( const expr& e ) { return e; }
+};
+
+template<typename T, typename E>
+struct ExprOperand<ScaledExpr<T, E> >
+{
+    static const bool value = true;
+    typedef T type;
+    typedef ScaledExpr<T, E> expr;
+    static const expr& Wrap( const expr& e ) { return e; }
+};
+
+template<typename T, typename L, typename R, typename Op>
+struct ExprOperand<BinaryExpr<T, L, R, Op> >
+{
+    static const bool value = true;
+    typedef T type;
+    typedef BinaryExpr<T, L, R, Op> expr;
+    static const expr& Wrap( const expr& e ) { return e; }
+};
+
+template<typename X, typename Y, typename Op>
+struct ExprBinaryResult
+{
+    typedef BinaryExpr<typename ExprOperand<X>::type,
+                       typename ExprOperand<X>::expr,
+                       typename ExprOperand<Y>::expr, Op> type;
+};
+
+template<typename X, typename Y>
+inline typename std::enable_if<ExprOperand<X>::value && ExprOperand<Y>::value,
+                               ExprBinaryResult<X, Y, ExprAdd> >::type::type
+operator+( const X& x, const Y& y )
+{ return typename ExprBinaryResult<X, Y, ExprAdd>::type(ExprOperand<X>::Wrap(x), ExprOperand<Y>::Wrap(y)); }
+
+template<typename X, typename Y>
+inline typename std::enable_if<ExprOperand<X>::value && ExprOperand<Y>::value,
+                               ExprBinaryResult<X, Y, ExprSub> >::type::type
+operator-( const X& x, const Y& y )
+{ return typename ExprBinaryResult<X, Y, ExprSub>::type(ExprOperand<X>::Wrap(x), ExprOperand<Y>::Wrap(y)); }
+
+// Elementwise (Hadamard) product
+template<typename X, typename Y>
+inline typename std::enable_if<ExprOperand<X>::value && ExprOperand<Y>::value,
+                               ExprBinaryResult<X, Y, ExprMul> >::type::type
+operator*( const X& x, const Y& y )
+{ return typename ExprBinaryResult<X, Y, ExprMul>::type(ExprOperand<X>::Wrap(x), ExprOperand<Y>::Wrap(y)); }
+
+template<typename X>
+inline ScaledExpr<typename ExprOperand<X>::type, typename ExprOperand<X>::expr>
+operator*( typename ExprOperand<X>::type alpha, const X& x )
+{ return ScaledExpr<typename ExprOperand<X>::type, typename ExprOperand<X>::expr>(alpha, ExprOperand<X>::Wrap(x)); }
+
+template<typename X>
+inline ScaledExpr<typename ExprOperand<X>::type, typename ExprOperand<X>::expr>
+operator*( const X& x, typename ExprOperand<X>::type alpha )
+{ return alpha * x; }
+
+template<typename X>
+inline ScaledExpr<typename ExprOperand<X>::type, typename ExprOperand<X>::expr>
+operator-( const X& x )
+{ return typename ExprOperand<X>::type(-1) * x; }
+
+////////////////////////////////////
+// Workhorse routines
+////////////////////////////////////
+
+template<typename T, typename E>
+void ExprEvaluateChunk( const E& expr, const ExprData& data, Unsigned begin, Unsigned end,
+                        T const * const * srcBufs, T * const dstBuf )
+{
+    if(begin >= end)
+        return;
+
+    const Unsigned nSrc = E::numLeaves;
+    const Unsigned order = data.loopShape.size();
+    const Unsigned last = order - 1;
+    Unsigned k, ptr;
+
+    Location curLoc(order, 0);
+    ObjShape loopEnd = data.loopShape;
+    curLoc[last] = begin;
+    loopEnd[last] = end;
+
+    const T* bufs[nSrc];
+    Offset innerStrides[nSrc];
+    Offset srcBufPtr[nSrc];
+    bool unit = data.dstStrides[0] == 1;
+    for(k = 0; k < nSrc; k++){
+        innerStrides[k] = data.srcStrides[k][0];
+        srcBufPtr[k] = begin * data.srcStrides[k][last];
+        unit = unit && innerStrides[k] == 1;
+    }
+    Offset dstBufPtr = begin * data.dstStrides[last];
+    const Offset dstStride = data.dstStrides[0];
+    const Unsigned n = order == 1 ? end - begin : data.loopShape[0];
+
+    while(true){
+        for(k = 0; k < nSrc; k++)
+            bufs[k] = &(srcBufs[k][srcBufPtr[k]]);
+        T * const dst = &(dstBuf[dstBufPtr]);
+        if(unit){
+            for(Unsigned i = 0; i < n; i++)
+                dst[i] = expr.EvalUnit(bufs, i);
+        }else{
+            for(Unsigned i = 0; i < n; i++)
+                dst[i * dstStride] = expr.Eval(bufs, innerStrides, i);
+        }
+
+        //Update
+        if(order == 1)
+            return;
+        for(ptr = 1; ptr < order; ptr++){
+            curLoc[ptr]++;
+            dstBufPtr += data.dstStrides[ptr];
+            for(k = 0; k < nSrc; k++)
+                srcBufPtr[k] += data.srcStrides[k][ptr];
+            if(curLoc[ptr] < loopEnd[ptr])
+                break;
+            if(ptr == last)
+                return;
+            dstBufPtr -= data.dstStrides[ptr] * loopEnd[ptr];
+            for(k = 0; k < nSrc; k++)
+                srcBufPtr[k] -= data.srcStrides[k][ptr] * loopEnd[ptr];
+            curLoc[ptr] = 0;
+        }
+    }
+}
+
+template<typename T, typename E>
+void ExprEvaluate_fast( const E& expr, const ExprData& data, T const * const * srcBufs, T * const dstBuf )
+{
+    const Unsigned nSrc = E::numLeaves;
+    const Unsigned order = data.loopShape.size();
+    Unsigned i, k;
+
+    //An order-0 tensor holds one entry, although its shape multiplies to 0
+    if(order > 0 && prod(data.loopShape) == 0)
+        return;
+
+    //Drop unit modes and merge modes contiguous in every operand, as long
+    //as the merged extent still fits in an Unsigned
+    ExprData merged;
+    merged.srcStrides.resize(nSrc);
+    for(i = 0; i < order; i++){
+        const Unsigned n = data.loopShape[i];
+        if(n == 1)
+            continue;
+        const Unsigned prev = merged.loopShape.size();
+        bool canMerge = prev > 0 &&
+            merged.loopShape[prev-1] <= std::numeric_limits<Unsigned>::max() / n &&
+            data.dstStrides[i] == merged.dstStrides[prev-1] * merged.loopShape[prev-1];
+        for(k = 0; k < nSrc && canMerge; k++)
+            canMerge = data.srcStrides[k][i] == merged.srcStrides[k][prev-1] * merged.loopShape[prev-1];
+        if(canMerge){
+            merged.loopShape[prev-1] *= n;
+        }else{
+            merged.loopShape.push_back(n);
+            merged.dstStrides.push_back(data.dstStrides[i]);
+            for(k = 0; k < nSrc; k++)
+                merged.srcStrides[k].push_back(data.srcStrides[k][i]);
+        }
+    }
+
+    if(merged.loopShape.size() == 0){
+        dstBuf[0] = expr.EvalUnit(srcBufs, 0);
+        return;
+    }
+
+    const Unsigned nSplit = merged.loopShape[merged.loopShape.size() - 1];
+#ifdef HAVE_OPENMP
+    if(nSplit > 1 && prod(merged.loopShape) >= EXPR_PARALLEL_THRESHOLD && !omp_in_parallel()){
+        //Contiguous static chunks of the outermost loop, one per thread
+        #pragma omp parallel
+        {
+            const Unsigned nThreads = omp_get_num_threads();
+            const Unsigned tid = omp_get_thread_num();
+            const Unsigned chunk = (nSplit + nThreads - 1) / nThreads;
+            const Unsigned begin = std::min(tid * chunk, nSplit);
+            const Unsigned end = std::min(begin + chunk, nSplit);
+            ExprEvaluateChunk(expr, merged, begin, end, srcBufs, dstBuf);
+        }
+        return;
+    }
+#endif
+    ExprEvaluateChunk(expr, merged, 0, nSplit, srcBufs, dstBuf);
+}
+
+////////////////////////////////////
+// Local interfaces
+////////////////////////////////////
+
+// Collects operand buffers and their strides in Z's mode order
+template<typename T>
+class LocalExprBinder
+{
+public:
+    LocalExprBinder( const Tensor<T>& Z ) : Z_(Z) { }
+
+    void Add( const TensorTerm<T>& term )
+    {
+        const Tensor<T>& A = term.Operand();
+#ifndef RELEASE
+        if(term.Shape() != Z_.Shape())
+            LogicError("Expression operand does not match the shape of the output");
+        if(A.LockedBuffer() == Z_.LockedBuffer() && term.Perm().applyTo(A.Strides()) != Z_.Strides())
+            LogicError("Output may only appear unpermuted in its own expression");
+#endif
+        bufs.push_back(A.LockedBuffer());
+        strides.push_back(term.Perm().applyTo(A.Strides()));
+    }
+
+    std::vector<const T*> bufs;
+    std::vector<std::vector<Offset> > strides;
+
+private:
+    const Tensor<T>& Z_;
+};
+
+template<typename T, typename E>
+void EvaluateExpr( const E& expr, Tensor<T>& Z )
+{
+    const ObjShape shape = expr.Shape();
+    if(Z.Shape() != shape)
+        Z.ResizeTo(shape);
+
+    LocalExprBinder<T> binder(Z);
+    expr.Bind(binder);
+
+    ExprData data;
+    data.loopShape = Z.Shape();
+    data.dstStrides = Z.Strides();
+    data.srcStrides = binder.strides;
+    ExprEvaluate_fast(expr, data, &(binder.bufs[0]), Z.Buffer());
+}
+
+template<typename T>
+template<typename E>
+inline Tensor<T>&
+Tensor<T>::operator=( const ExprBase<T, E>& expr )
+{
+    EvaluateExpr(expr.Derived(), *this);
+    return *this;
+}
+
+////////////////////////////////////
+// Global interfaces
+////////////////////////////////////
+
+// Collects local operand buffers and their strides in Z's local mode order,
+// redistributing any operand not distributed like Z
+template<typename T>
+class DistExprBinder
+{
+public:
+    DistExprBinder( const DistTensor<T>& Z ) : Z_(Z) { }
+
+    void Add( const DistTensorTerm<T>& term )
+    {
+        const DistTensor<T>& A = term.Operand();
+        const Unsigned order = Z_.Order();
+        const std::vector<Unsigned> perm = term.Perm().Entries();
+        Unsigned i;
+#ifndef RELEASE
+        if(A.Grid() != Z_.Grid())
+            LogicError("Expression operands must be distributed over the same grid");
+        if(term.Shape() != Z_.Shape())
+            LogicError("Expression operand does not match the shape of the output");
+#endif
+
+        //Mode perm[i] of A must be distributed and aligned like mode i of Z
+        const TensorDistribution distZ = Z_.TensorDist();
+        TensorDistribution distA = distZ;
+        bool matches = true;
+        for(i = 0; i < order; i++){
+            distA[perm[i]] = distZ[i];
+            matches = matches && A.ModeAlignment(perm[i]) == Z_.ModeAlignment(i);
+        }
+        matches = matches && A.TensorDist() == distA;
+
+        //An operand used again under the same permutation reuses its copy
+        const std::pair<const DistTensor<T>*, std::vector<Unsigned> > key(&A, perm);
+        typename std::map<std::pair<const DistTensor<T>*, std::vector<Unsigned> >, const DistTensor<T>*>::const_iterator
+            cached = redistributed_.find(key);
+        const DistTensor<T>* src = &A;
+        if(cached != redistributed_.end()){
+            src = cached->second;
+        }else if(!matches){
+            PROFILE_SECTION("ExprRedist");
+            temps_.emplace_back(distA, Z_.Grid());
+            DistTensor<T>& tmp = temps_.back();
+            ModeArray modesZ(order);
+            for(i = 0; i < order; i++)
+                modesZ[i] = i;
+            tmp.AlignModesWith(perm, Z_, modesZ);
+            tmp.RedistFrom(A);
+            src = &tmp;
+            redistributed_[key] = src;
+            PROFILE_STOP;
+        }
+
+#ifndef RELEASE
+        if(src->LockedBuffer() == Z_.LockedBuffer() && perm != Permutation(order).Entries())
+            LogicError("Output may only appear unpermuted in its own expression");
+#endif
+        //Local mode i of Z holds global mode localPermZ[i]
+        const std::vector<Unsigned> localPermZ = Z_.LocalPermutation().Entries();
+        const std::vector<Unsigned> localPermSrc = src->LocalPermutation().Entries();
+        const std::vector<Offset> srcStrides = src->LockedTensor().Strides();
+        std::vector<Offset> localStrides(order);
+        for(i = 0; i < order; i++)
+            localStrides[i] = srcStrides[IndexOf(localPermSrc, perm[localPermZ[i]])];
+
+        bufs.push_back(src->LockedBuffer());
+        strides.push_back(localStrides);
+    }
+
+    std::vector<const T*> bufs;
+    std::vector<std::vector<Offset> > strides;
+
+private:
+    const DistTensor<T>& Z_;
+    std::list<DistTensor<T> > temps_;
+    std::map<std::pair<const DistTensor<T>*, std::vector<Unsigned> >, const DistTensor<T>*> redistributed_;
+};
+
+template<typename T, typename E>
+void EvaluateExpr( const E& expr, DistTensor<T>& Z )
+{
+    PROFILE_SECTION("Expr");
+    const ObjShape shape = expr.Shape();
+    if(Z.Shape() != shape)
+        Z.ResizeTo(shape);
+
+    //Redistributions are collective, so every process binds
+    DistExprBinder<T> binder(Z);
+    expr.Bind(binder);
+
+    if(Z.Participating()){
+        ExprData data;
+        data.loopShape = Z.LockedTensor().Shape();
+        data.dstStrides = Z.LockedTensor().Strides();
+        data.srcStrides = binder.strides;
+        ExprEvaluate_fast(expr, data, &(binder.bufs[0]), Z.Buffer());
+    }
+    PROFILE_STOP;
+}
+
+template<typename T>
+template<typename E>
+inline DistTensor<T>&
+DistTensor<T>::operator=( const ExprBase<T, E>& expr )
+{
+    EvaluateExpr(expr.Derived(), *this);
+    return *this;
+}
+
+} // namespace rote
+
+#endif // ifndef ROTE_BTAS_EXPR_HPP
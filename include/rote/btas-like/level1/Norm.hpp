@@ -19,9 +19,9 @@ namespace rote{
 template <typename T>
 BASE(T) Norm(const Tensor<T>& A){
     const std::vector<Unsigned> loopEnd = A.Shape();
-    const std::vector<Unsigned> srcBufStrides = A.Strides();
+    const std::vector<Offset> srcBufStrides = A.Strides();
     const T* srcBuf = A.LockedBuffer();
-    Unsigned srcBufPtr = 0;
+    Offset srcBufPtr = 0;
     Unsigned order = loopEnd.size();
     Location curLoc(order, 0);
     Unsigned ptr = 0;
@@ -24,12 +24,12 @@ void PackCommHelper_fast(const PackData& packData, T const * const srcBuf, T * c
     }
 
     const std::vector<Unsigned> loopEnd = packData.loopShape;
-    const std::vector<Unsigned> dstBufStrides = packData.dstBufStrides;
-    const std::vector<Unsigned> srcBufStrides = packData.srcBufStrides;
+    const std::vector<Offset> dstBufStrides = packData.dstBufStrides;
+    const std::vector<Offset> srcBufStrides = packData.srcBufStrides;
     Unsigned order = loopEnd.size();
     Location curLoc(order,0);
-    Unsigned dstBufPtr = 0;
-    Unsigned srcBufPtr = 0;
+    Offset dstBufPtr = 0;
+    Offset srcBufPtr = 0;
     Unsigned ptr = 0;
 
     if(loopEnd.size() == 0){
@@ -113,12 +113,15 @@ void PackCommHelper(const PackData& packData, T const * const srcBuf, T * const
         newData.loopShape.push_back(modifiedData.loopShape[0]);
         newData.srcBufStrides.push_back(modifiedData.srcBufStrides[0]);
         newData.dstBufStrides.push_back(modifiedData.dstBufStrides[0]);
-        Unsigned srcStrideToMatch = modifiedData.srcBufStrides[0] * modifiedData.loopShape[0];
-        Unsigned dstStrideToMatch = modifiedData.dstBufStrides[0] * modifiedData.loopShape[0];
+        Offset srcStrideToMatch = modifiedData.srcBufStrides[0] * modifiedData.loopShape[0];
+        Offset dstStrideToMatch = modifiedData.dstBufStrides[0] * modifiedData.loopShape[0];
 
         Unsigned mergeMode = 0;
         for(i = 1; i < oldOrder; i++){
-            if(modifiedData.srcBufStrides[i] == srcStrideToMatch &&
+            //Merged extents must still fit in an Unsigned
+            if((modifiedData.loopShape[i] == 0 ||
+                newData.loopShape[mergeMode] <= std::numeric_limits<Unsigned>::max() / modifiedData.loopShape[i]) &&
+               modifiedData.srcBufStrides[i] == srcStrideToMatch &&
                modifiedData.dstBufStrides[i] == dstStrideToMatch){
                 newData.loopShape[mergeMode] *= modifiedData.loopShape[i];
                 srcStrideToMatch *= modifiedData.loopShape[i];
@@ -144,22 +147,40 @@ void PackCommHelper(const PackData& packData, T const * const srcBuf, T * const
 // Local interfaces
 ////////////////////////////////////
 
+template<typename T>
+void Permute(const Tensor<T>& A, Tensor<T>& B, const TransposePlan<T>& plan){
+    plan.Execute(A.LockedBuffer(), B.Buffer());
+}
+
+// Number of plans kept by the permutation overload below before it starts over
+#define TRANSPOSE_PLAN_CACHE_SIZE 64
+
+// Plans of the permutes done through Permute(A, B, perm), keyed by the
+// layouts of A and B, so the repeated permutes of the partition loops in
+// Contract are planned once
+template<typename T>
+std::shared_ptr<const TransposePlan<T> >
+CachedTransposePlan(const Tensor<T>& A, const Tensor<T>& B, const Permutation& perm){
+    typedef std::pair<ObjShape, std::pair<std::vector<Offset>, std::vector<Offset> > > Key;
+    static std::mutex mutex;
+    static std::map<Key, std::shared_ptr<const TransposePlan<T> > > plans;
+
+    const Key key(A.Shape(), std::make_pair(A.Strides(), perm.InversePermutation().applyTo(B.Strides())));
+    std::lock_guard<std::mutex> lock(mutex);
+    typename std::map<Key, std::shared_ptr<const TransposePlan<T> > >::const_iterator it = plans.find(key);
+    if(it != plans.end())
+        return it->second;
+    if(plans.size() >= TRANSPOSE_PLAN_CACHE_SIZE)
+        plans.clear();
+    std::shared_ptr<const TransposePlan<T> > plan(new TransposePlan<T>(A, B, perm));
+    plans[key] = plan;
+    return plan;
+}
+
 template<typename T>
 void Permute(const Tensor<T>& A, Tensor<T>& B, const Permutation& perm){
     B.ResizeTo(FilterVector(A.Shape(), perm.Entries()));
-    Unsigned order = A.Order();
-    T* dstBuf = B.Buffer();
-    const T * srcBuf = A.LockedBuffer();
-
-    Location zeros(order, 0);
-    Location ones(order, 1);
-    Permutation invperm = perm.InversePermutation();
-    PackData data;
-    data.loopShape = A.Shape();
-    data.srcBufStrides = A.Strides();
-    data.dstBufStrides = invperm.applyTo(B.Strides());
-
-    PackCommHelper(data, &(srcBuf[0]), &(dstBuf[0]));
+    Permute(A, B, *CachedTransposePlan(A, B, perm));
 }
 
 ////////////////////////////////////
@@ -17,12 +17,12 @@ namespace rote{
 ////////////////////////////////////
 
 template <typename T>
-void LocalReduceElemSelect_merged(const T alpha, const ObjShape& sB, T const * const a, const std::vector<Unsigned>& stA, T * const b, const std::vector<Unsigned>& stB){
+void LocalReduceElemSelect_merged(const T alpha, const ObjShape& sB, T const * const a, const std::vector<Offset>& stA, T * const b, const std::vector<Offset>& stB){
   Unsigned o = sB.size();
   Location l(o, 0);
   Unsigned p = 0;
-  Unsigned pA = 0;
-  Unsigned pB = 0;
+  Offset pA = 0;
+  Offset pB = 0;
 
   if(o == 0){
       b[0] += alpha * a[0];
@@ -72,11 +72,11 @@ void LocalReduce(const T alpha, const Tensor<T>& A, Tensor<T>& B, const Permutat
 #endif
 
   const ObjShape sA = A.Shape();
-  const std::vector<Unsigned> stA = A.Strides();
-  const std::vector<Unsigned> stB = permBToA.applyTo(B.Strides());
-  const std::vector<Unsigned> zero(reduceModes.size(), 0);
-  Location stUseA = ConcatenateVectors(FilterVector(stA, reduceModes), NegFilterVector(stA, reduceModes));
-  Location stUseB = ConcatenateVectors(zero, NegFilterVector(stB, reduceModes));
+  const std::vector<Offset> stA = A.Strides();
+  const std::vector<Offset> stB = permBToA.applyTo(B.Strides());
+  const std::vector<Offset> zero(reduceModes.size(), 0);
+  std::vector<Offset> stUseA = ConcatenateVectors(FilterVector(stA, reduceModes), NegFilterVector(stA, reduceModes));
+  std::vector<Offset> stUseB = ConcatenateVectors(zero, NegFilterVector(stB, reduceModes));
   ObjShape sUseA = ConcatenateVectors(FilterVector(sA, reduceModes), NegFilterVector(sA, reduceModes));
 
   LocalReduceElemSelect_merged(alpha, sUseA, A.LockedBuffer(), stUseA, B.Buffer(), stUseB);
@@ -20,8 +20,8 @@ template<typename T>
 inline void
 Scal_fast(T alpha, T * srcBuf, const ScalData& data ){
     const std::vector<Unsigned> loopEnd = data.loopShape;
-    const std::vector<Unsigned> srcBufStrides = data.srcStrides;
-    Unsigned srcBufPtr = 0;
+    const std::vector<Offset> srcBufStrides = data.srcStrides;
+    Offset srcBufPtr = 0;
     Unsigned order = loopEnd.size();
     Location curLoc(order, 0);
     Unsigned ptr = 0;
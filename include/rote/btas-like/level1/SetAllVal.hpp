@@ -17,9 +17,9 @@ namespace rote {
 ////////////////////////////////////
 
 template<typename T>
-void SetAllVal_fast(const ObjShape& shape, const std::vector<Unsigned>& strides, T * const buf, T val){
+void SetAllVal_fast(const ObjShape& shape, const std::vector<Offset>& strides, T * const buf, T val){
     const std::vector<Unsigned> loopEnd = shape;
-    const std::vector<Unsigned> bufStrides = strides;
+    const std::vector<Offset> bufStrides = strides;
     Unsigned bufPtr = 0;
     Unsigned order = loopEnd.size();
     Location curLoc(order, 0);
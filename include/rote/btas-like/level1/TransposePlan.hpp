@@ -0,0 +1,349 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ROTE_BTAS_TRANSPOSEPLAN_HPP
+#define ROTE_BTAS_TRANSPOSEPLAN_HPP
+
+#ifdef HAVE_OPENMP
+# include <omp.h>
+#endif
+
+namespace rote{
+
+// Number of elements below which a transpose is not split across threads
+#define TRANSPOSE_PARALLEL_THRESHOLD 32768
+
+// A reusable plan for dst = permute(src).
+// Built once from the shape and strides (modes merged, loop order and
+// tiling chosen from the strides), then executed any number of times on
+// buffers with the same layout.  When built with measure=true, the first
+// Execute times a handful of candidate schedules and keeps the fastest.
+template<typename T>
+class TransposePlan
+{
+public:
+    TransposePlan();
+    // loopShape/srcBufStrides/dstBufStrides as for PackCommHelper
+    explicit TransposePlan(const PackData& packData, bool measure=false);
+    // B := A permuted by perm (B must already be sized)
+    TransposePlan(const Tensor<T>& A, const Tensor<T>& B, const Permutation& perm, bool measure=false);
+
+    void Execute(T const * const srcBuf, T * const dstBuf) const;
+
+    Unsigned NumCandidates() const { return candidates_.size(); }
+
+private:
+    struct Schedule
+    {
+        // Loop 0 is innermost
+        ObjShape loopShape;
+        std::vector<Offset> srcStrides;
+        std::vector<Offset> dstStrides;
+        // If nonzero, loops 0 and 1 are tiled blkSize x blkSize
+        Unsigned blkSize;
+    };
+
+    std::vector<Schedule> candidates_;
+    mutable Unsigned chosen_;
+    mutable bool measure_;
+    bool empty_;
+
+    void Setup(const PackData& packData, bool measure);
+    static Schedule MakeSchedule(const PackData& merged, const std::vector<Unsigned>& order, Unsigned blkSize);
+    static void ExecuteSchedule(const Schedule& s, T const * const srcBuf, T * const dstBuf);
+    static void ExecuteChunk(const Schedule& s, const ObjShape& outerShape,
+                             const std::vector<Offset>& outerSrcStrides, const std::vector<Offset>& outerDstStrides,
+                             Unsigned begin, Unsigned end,
+                             T const * const srcBuf, T * const dstBuf);
+};
+
+////////////////////////////////////
+// Plan construction
+////////////////////////////////////
+
+template<typename T>
+TransposePlan<T>::TransposePlan()
+: chosen_(0), measure_(false), empty_(true)
+{ }
+
+template<typename T>
+TransposePlan<T>::TransposePlan(const PackData& packData, bool measure)
+: chosen_(0), measure_(false), empty_(false)
+{
+    Setup(packData, measure);
+}
+
+template<typename T>
+TransposePlan<T>::TransposePlan(const Tensor<T>& A, const Tensor<T>& B, const Permutation& perm, bool measure)
+: chosen_(0), measure_(false), empty_(false)
+{
+#ifndef RELEASE
+    if(A.Order() != perm.size() || B.Order() != perm.size())
+        LogicError("TransposePlan: permutation does not match tensor orders");
+    if(B.Shape() != FilterVector(A.Shape(), perm.Entries()))
+        LogicError("TransposePlan: output shape is not the permuted input shape");
+#endif
+    PackData data;
+    data.loopShape = A.Shape();
+    data.srcBufStrides = A.Strides();
+    data.dstBufStrides = perm.InversePermutation().applyTo(B.Strides());
+    Setup(data, measure);
+}
+
+template<typename T>
+void TransposePlan<T>::Setup(const PackData& packData, bool measure)
+{
+    const Unsigned order = packData.loopShape.size();
+    Unsigned i, j;
+
+    //An order-0 tensor holds one entry, although its shape multiplies to 0
+    if(order > 0 && prod(packData.loopShape) == 0){
+        empty_ = true;
+        return;
+    }
+
+    //Drop unit modes and visit the rest in increasing source stride
+    std::vector<std::pair<Offset, Unsigned> > srcOrder;
+    for(i = 0; i < order; i++)
+        if(packData.loopShape[i] > 1)
+            srcOrder.push_back(std::make_pair(packData.srcBufStrides[i], i));
+    std::sort(srcOrder.begin(), srcOrder.end());
+
+    //Merge modes contiguous in both buffers, as long as the merged extent
+    //still fits in an Unsigned
+    PackData merged;
+    for(i = 0; i < srcOrder.size(); i++){
+        const Unsigned mode = srcOrder[i].second;
+        const Unsigned n = packData.loopShape[mode];
+        const Offset srcStride = packData.srcBufStrides[mode];
+        const Offset dstStride = packData.dstBufStrides[mode];
+        const Unsigned last = merged.loopShape.size();
+        if(last > 0 &&
+           merged.loopShape[last-1] <= std::numeric_limits<Unsigned>::max() / n &&
+           srcStride == merged.srcBufStrides[last-1] * merged.loopShape[last-1] &&
+           dstStride == merged.dstBufStrides[last-1] * merged.loopShape[last-1]){
+            merged.loopShape[last-1] *= n;
+        }else{
+            merged.loopShape.push_back(n);
+            merged.srcBufStrides.push_back(srcStride);
+            merged.dstBufStrides.push_back(dstStride);
+        }
+    }
+
+    const Unsigned newOrder = merged.loopShape.size();
+    if(newOrder == 0){
+        candidates_.push_back(MakeSchedule(merged, std::vector<Unsigned>(), 0));
+        return;
+    }
+
+    //Writes are innermost along the smallest destination stride.  If reads are
+    //strided along that mode, tile it against the smallest source stride
+    //(mode 0 after the sort above)
+    std::vector<std::pair<Offset, Unsigned> > dstOrder(newOrder);
+    for(i = 0; i < newOrder; i++)
+        dstOrder[i] = std::make_pair(merged.dstBufStrides[i], i);
+    std::sort(dstOrder.begin(), dstOrder.end());
+
+    const Unsigned innerMode = dstOrder[0].second;
+    const bool tile = innerMode != 0;
+    const Unsigned blkSize = std::max<Unsigned>(4, 256 / sizeof(T));
+
+    std::vector<Unsigned> heuristic;
+    heuristic.push_back(innerMode);
+    if(tile)
+        heuristic.push_back(0);
+    for(i = 1; i < newOrder; i++){
+        j = dstOrder[i].second;
+        if(!(tile && j == 0))
+            heuristic.push_back(j);
+    }
+    candidates_.push_back(MakeSchedule(merged, heuristic, tile ? blkSize : 0));
+
+    if(!measure || newOrder < 2)
+        return;
+
+    //Alternatives timed on the first Execute
+    std::vector<Unsigned> bySrc(newOrder);
+    for(i = 0; i < newOrder; i++)
+        bySrc[i] = i;
+    if(tile){
+        std::vector<Unsigned> byDst(newOrder);
+        for(i = 0; i < newOrder; i++)
+            byDst[i] = dstOrder[i].second;
+        candidates_.push_back(MakeSchedule(merged, heuristic, blkSize / 2));
+        candidates_.push_back(MakeSchedule(merged, heuristic, blkSize * 2));
+        candidates_.push_back(MakeSchedule(merged, byDst, 0));
+        candidates_.push_back(MakeSchedule(merged, bySrc, 0));
+    }else if(bySrc != heuristic){
+        candidates_.push_back(MakeSchedule(merged, bySrc, 0));
+    }
+    measure_ = candidates_.size() > 1;
+}
+
+template<typename T>
+typename TransposePlan<T>::Schedule
+TransposePlan<T>::MakeSchedule(const PackData& merged, const std::vector<Unsigned>& order, Unsigned blkSize)
+{
+    Schedule s;
+    s.blkSize = blkSize;
+    for(Unsigned i = 0; i < order.size(); i++){
+        s.loopShape.push_back(merged.loopShape[order[i]]);
+        s.srcStrides.push_back(merged.srcBufStrides[order[i]]);
+        s.dstStrides.push_back(merged.dstBufStrides[order[i]]);
+    }
+    return s;
+}
+
+////////////////////////////////////
+// Plan execution
+////////////////////////////////////
+
+template<typename T>
+void TransposePlan<T>::Execute(T const * const srcBuf, T * const dstBuf) const
+{
+    if(empty_)
+        return;
+
+    if(!measure_){
+        ExecuteSchedule(candidates_[chosen_], srcBuf, dstBuf);
+        return;
+    }
+
+    //Every candidate writes the full result, so timing them on the real
+    //buffers leaves dstBuf correct
+    double bestTime = 0;
+    for(Unsigned i = 0; i < candidates_.size(); i++){
+        const double startTime = mpi::Time();
+        ExecuteSchedule(candidates_[i], srcBuf, dstBuf);
+        const double elapsed = mpi::Time() - startTime;
+        if(i == 0 || elapsed < bestTime){
+            bestTime = elapsed;
+            chosen_ = i;
+        }
+    }
+    measure_ = false;
+}
+
+template<typename T>
+void TransposePlan<T>::ExecuteSchedule(const Schedule& s, T const * const srcBuf, T * const dstBuf)
+{
+    const Unsigned order = s.loopShape.size();
+    if(order == 0){
+        dstBuf[0] = srcBuf[0];
+        return;
+    }
+
+    //Outer loop nest: the tiles of loops 0 and 1 (if tiled) followed by
+    //the remaining loops
+    ObjShape outerShape;
+    std::vector<Offset> outerSrcStrides;
+    std::vector<Offset> outerDstStrides;
+    Unsigned firstOuter = 1;
+    if(s.blkSize > 0){
+        for(Unsigned i = 0; i < 2; i++){
+            outerShape.push_back((s.loopShape[i] + s.blkSize - 1) / s.blkSize);
+            outerSrcStrides.push_back(s.srcStrides[i] * s.blkSize);
+            outerDstStrides.push_back(s.dstStrides[i] * s.blkSize);
+        }
+        firstOuter = 2;
+    }
+    for(Unsigned i = firstOuter; i < order; i++){
+        outerShape.push_back(s.loopShape[i]);
+        outerSrcStrides.push_back(s.srcStrides[i]);
+        outerDstStrides.push_back(s.dstStrides[i]);
+    }
+    if(outerShape.size() == 0){
+        outerShape.push_back(1);
+        outerSrcStrides.push_back(0);
+        outerDstStrides.push_back(0);
+    }
+
+    const Unsigned nSplit = outerShape[outerShape.size() - 1];
+#ifdef HAVE_OPENMP
+    if(nSplit > 1 && prod(s.loopShape) >= TRANSPOSE_PARALLEL_THRESHOLD && !omp_in_parallel()){
+        //Contiguous static chunks of the outermost loop (largest destination
+        //stride): each thread writes one slab of dstBuf, so pages first
+        //touched by a statically scheduled loop stay on the writer's node
+        #pragma omp parallel
+        {
+            const Unsigned nThreads = omp_get_num_threads();
+            const Unsigned tid = omp_get_thread_num();
+            const Unsigned chunk = (nSplit + nThreads - 1) / nThreads;
+            const Unsigned begin = std::min(tid * chunk, nSplit);
+            const Unsigned end = std::min(begin + chunk, nSplit);
+            ExecuteChunk(s, outerShape, outerSrcStrides, outerDstStrides, begin, end, srcBuf, dstBuf);
+        }
+        return;
+    }
+#endif
+    ExecuteChunk(s, outerShape, outerSrcStrides, outerDstStrides, 0, nSplit, srcBuf, dstBuf);
+}
+
+template<typename T>
+void TransposePlan<T>::ExecuteChunk(const Schedule& s, const ObjShape& outerShape,
+                                    const std::vector<Offset>& outerSrcStrides, const std::vector<Offset>& outerDstStrides,
+                                    Unsigned begin, Unsigned end,
+                                    T const * const srcBuf, T * const dstBuf)
+{
+    if(begin >= end)
+        return;
+
+    const Unsigned nOuter = outerShape.size();
+    Location curLoc(nOuter, 0);
+    ObjShape loopEnd = outerShape;
+    curLoc[nOuter-1] = begin;
+    loopEnd[nOuter-1] = end;
+
+    const Unsigned blkSize = s.blkSize;
+    const Unsigned n0 = s.loopShape[0];
+    const Offset srcStride0 = s.srcStrides[0];
+    const Offset dstStride0 = s.dstStrides[0];
+    const Unsigned n1 = blkSize > 0 ? s.loopShape[1] : 1;
+    const Offset srcStride1 = blkSize > 0 ? s.srcStrides[1] : 0;
+    const Offset dstStride1 = blkSize > 0 ? s.dstStrides[1] : 0;
+
+    Offset srcBufPtr = begin * outerSrcStrides[nOuter-1];
+    Offset dstBufPtr = begin * outerDstStrides[nOuter-1];
+    Unsigned ptr;
+
+    while(true){
+        T const * const src = &(srcBuf[srcBufPtr]);
+        T * const dst = &(dstBuf[dstBufPtr]);
+        if(blkSize > 0){
+            const Unsigned e0 = std::min(blkSize, n0 - curLoc[0] * blkSize);
+            const Unsigned e1 = std::min(blkSize, n1 - curLoc[1] * blkSize);
+            for(Unsigned j = 0; j < e1; j++)
+                for(Unsigned i = 0; i < e0; i++)
+                    dst[i * dstStride0 + j * dstStride1] = src[i * srcStride0 + j * srcStride1];
+        }else if(srcStride0 == 1 && dstStride0 == 1){
+            MemCopy(dst, src, n0);
+        }else{
+            for(Unsigned i = 0; i < n0; i++)
+                dst[i * dstStride0] = src[i * srcStride0];
+        }
+
+        //Update
+        for(ptr = 0; ptr < nOuter; ptr++){
+            curLoc[ptr]++;
+            srcBufPtr += outerSrcStrides[ptr];
+            dstBufPtr += outerDstStrides[ptr];
+            if(curLoc[ptr] < loopEnd[ptr])
+                break;
+            if(ptr == nOuter - 1)
+                return;
+            srcBufPtr -= outerSrcStrides[ptr] * loopEnd[ptr];
+            dstBufPtr -= outerDstStrides[ptr] * loopEnd[ptr];
+            curLoc[ptr] = 0;
+        }
+    }
+}
+
+} // namespace rote
+
+#endif // ifndef ROTE_BTAS_TRANSPOSEPLAN_HPP
@@ -39,8 +39,8 @@ private:
 	static void runHelperPartitionAB(
 		Unsigned depth, BlkContractStatCInfo& contractInfo,
 		T alpha,
-		const DistTensor<T>& A, const IndexArray& indicesA,
-		const DistTensor<T>& B, const IndexArray& indicesB,
+		const DistTensorView<T>& A, const IndexArray& indicesA,
+		const DistTensorView<T>& B, const IndexArray& indicesB,
 		T beta,
 					DistTensor<T>& C, const IndexArray& indicesC
 	);
@@ -49,9 +49,9 @@ private:
 		Unsigned depth, BlkContractStatCInfo& contractInfo,
 		T alpha,
 		const DistTensor<T>& A, const IndexArray& indicesA,
-		const DistTensor<T>& B, const IndexArray& indicesB,
+		const DistTensorView<T>& B, const IndexArray& indicesB,
 		T beta,
-					DistTensor<T>& C, const IndexArray& indicesC
+		const DistTensorView<T>& C, const IndexArray& indicesC
 	);
 
 	// Internal interface
@@ -36,16 +36,16 @@ private:
   // Partition helpers
   static void runHelperPartitionBC(
     Unsigned depth, BlkHadamardStatCInfo& hadamardInfo,
-    const DistTensor<T>& A, const IndexArray& indicesA,
-    const DistTensor<T>& B, const IndexArray& indicesB,
-          DistTensor<T>& C, const IndexArray& indicesC
+    const DistTensorView<T>& A, const IndexArray& indicesA,
+    const DistTensorView<T>& B, const IndexArray& indicesB,
+    const DistTensorView<T>& C, const IndexArray& indicesC
   );
 
   static void runHelperPartitionAC(
     Unsigned depth, BlkHadamardStatCInfo& hadamardInfo,
-    const DistTensor<T>& A, const IndexArray& indicesA,
-    const DistTensor<T>& B, const IndexArray& indicesB,
-          DistTensor<T>& C, const IndexArray& indicesC
+    const DistTensorView<T>& A, const IndexArray& indicesA,
+    const DistTensorView<T>& B, const IndexArray& indicesB,
+    const DistTensorView<T>& C, const IndexArray& indicesC
   );
 
   // Internal interface
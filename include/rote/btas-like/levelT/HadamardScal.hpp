@@ -20,8 +20,8 @@ template<typename T>
 inline void
 HadamardScalBC_fast(T const * const bufA, T const * const bufB,  T * const bufC, const HadamardScalData& data) {
     const std::vector<Unsigned> loopBCEnd = data.loopShapeBC;
-    const std::vector<Unsigned> bufBCBStrides = data.stridesBCB;
-    const std::vector<Unsigned> bufBCCStrides = data.stridesBCC;
+    const std::vector<Offset> bufBCBStrides = data.stridesBCB;
+    const std::vector<Offset> bufBCCStrides = data.stridesBCC;
 
     ElemScalData elemScalData;
     elemScalData.loopShape = data.loopShapeABC;
@@ -74,8 +74,8 @@ template<typename T>
 inline void
 HadamardScalAC_fast(T const * const bufA, T const * const bufB,  T * const bufC, const HadamardScalData& data) {
     const std::vector<Unsigned> loopACEnd = data.loopShapeAC;
-    const std::vector<Unsigned> bufACAStrides = data.stridesACA;
-    const std::vector<Unsigned> bufACCStrides = data.stridesACC;
+    const std::vector<Offset> bufACAStrides = data.stridesACA;
+    const std::vector<Offset> bufACCStrides = data.stridesACC;
 
     Unsigned bufAPtr = 0;
     Unsigned bufCPtr = 0;
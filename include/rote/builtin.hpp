@@ -45,9 +45,12 @@
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
+#include <climits>
 #include <ctime>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <sstream>
@@ -58,7 +61,9 @@
 #include <utility>
 #include <vector>
 #include <list>
+#include <mutex>
 #include <time.h>
+#include <type_traits>
 
 #ifdef __MACH__
 #include <mach/mach_time.h>
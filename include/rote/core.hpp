@@ -32,6 +32,11 @@
 #include "core/indexing.hpp"
 #include "core/imports.hpp"
 #include "core/environment.hpp"
+#include "core/alloc_policy.hpp"
+#include "core/memory_pool.hpp"
+#include "core/memory_accounting.hpp"
+#include "core/workspace.hpp"
+#include "core/out_of_core.hpp"
 #include "core/memory.hpp"
 #include "core/complex.hpp"
 #include "core/mode_distribution.hpp"
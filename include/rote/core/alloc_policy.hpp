@@ -0,0 +1,69 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ROTE_CORE_ALLOC_POLICY_HPP
+#define ROTE_CORE_ALLOC_POLICY_HPP
+
+namespace rote {
+
+// How the memory pool obtains blocks from the system.  Every block is
+// aligned to 'alignment' bytes.  Blocks of at least hugePageThreshold bytes
+// may additionally be backed by huge pages, and any block can be placed
+// across NUMA nodes.  Requests the platform cannot honour (no madvise, no
+// huge pages reserved, a single NUMA node) quietly fall back to ordinary
+// pages.
+
+enum HugePageMode
+{
+    HUGE_PAGES_NONE,        // Ordinary pages
+    HUGE_PAGES_TRANSPARENT, // madvise(MADV_HUGEPAGE) on a huge-page aligned map
+    HUGE_PAGES_EXPLICIT     // MAP_HUGETLB, falling back to transparent
+};
+
+enum NumaPlacement
+{
+    NUMA_DEFAULT,     // Whatever the process policy says
+    NUMA_INTERLEAVE,  // Pages round-robin over all online nodes
+    NUMA_FIRST_TOUCH  // Pages touched by a static OpenMP loop on allocation
+};
+
+struct AllocationPolicy
+{
+    std::size_t alignment;         // Power of two, at least sizeof(void*)
+    HugePageMode hugePages;
+    NumaPlacement numa;
+    std::size_t hugePageThreshold; // Smallest block given huge pages
+
+    // 64-byte aligned, ordinary pages, default placement
+    AllocationPolicy();
+};
+
+bool operator==( const AllocationPolicy& a, const AllocationPolicy& b );
+bool operator!=( const AllocationPolicy& a, const AllocationPolicy& b );
+bool operator<( const AllocationPolicy& a, const AllocationPolicy& b );
+
+// Policy used by every Memory<G> that has not been given its own
+void SetDefaultAllocationPolicy( const AllocationPolicy& policy );
+AllocationPolicy DefaultAllocationPolicy();
+
+// Throws a LogicError if the alignment is not a usable power of two
+void AssertValidAllocationPolicy( const AllocationPolicy& policy );
+
+// Size of the huge pages used for HUGE_PAGES_EXPLICIT (typically 2 MiB)
+std::size_t HugePageSize();
+
+// Uncached allocation following the policy; throws std::bad_alloc on
+// failure.  The block must be returned with the same bytes and policy.
+void* SystemAllocate( std::size_t bytes, const AllocationPolicy& policy );
+void SystemDeallocate
+( void* ptr, std::size_t bytes, const AllocationPolicy& policy );
+
+} // namespace rote
+
+#endif // ifndef ROTE_CORE_ALLOC_POLICY_HPP
@@ -23,5 +23,6 @@
 // New
 #include "dist_tensor/redist_tensor.hpp"
 #include "dist_tensor/dist_tensor.hpp"
+#include "dist_tensor/dist_tensor_view.hpp"
 
 #endif // ifndef ROTE_CORE_DISTTENSOR_HPP
@@ -31,9 +31,6 @@ public:
 
     //Constructors
 
-    void ClearCommMap();
-    Unsigned CommMapSize();
-
     // Create a 0 distributed tensor
     DistTensorBase( const rote::Grid& g=DefaultGrid() );
 
@@ -54,17 +51,17 @@ public:
     // Create a "shape" distributed tensor with specified alignments
     // and leading dimension
     DistTensorBase
-    ( const ObjShape& shape, const TensorDistribution& dist, const std::vector<Unsigned>& modeAligns, const std::vector<Unsigned>& strides, const rote::Grid& g );
+    ( const ObjShape& shape, const TensorDistribution& dist, const std::vector<Unsigned>& modeAligns, const std::vector<Offset>& strides, const rote::Grid& g );
 
     // View a constant distributed tensor's buffer
     DistTensorBase
     ( const ObjShape& shape, const TensorDistribution& dist, const std::vector<Unsigned>& modeAligns,
-      const T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g );
+      const T* buffer, const std::vector<Offset>& strides, const rote::Grid& g );
 
     // View a mutable distributed tensor's buffer
     DistTensorBase
     ( const ObjShape& shape, const TensorDistribution& dist, const std::vector<Unsigned>& modeAligns,
-      T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g );
+      T* buffer, const std::vector<Offset>& strides, const rote::Grid& g );
 
     //////////////////////////////////
     /// String distribution versions
@@ -84,17 +81,17 @@ public:
     // Create a "shape" distributed tensor with specified alignments
     // and leading dimension
     DistTensorBase
-    ( const ObjShape& shape, const std::string& dist, const std::vector<Unsigned>& modeAligns, const std::vector<Unsigned>& strides, const rote::Grid& g );
+    ( const ObjShape& shape, const std::string& dist, const std::vector<Unsigned>& modeAligns, const std::vector<Offset>& strides, const rote::Grid& g );
 
     // View a constant distributed tensor's buffer
     DistTensorBase
     ( const ObjShape& shape, const std::string& dist, const std::vector<Unsigned>& modeAligns,
-      const T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g );
+      const T* buffer, const std::vector<Offset>& strides, const rote::Grid& g );
 
     // View a mutable distributed tensor's buffer
     DistTensorBase
     ( const ObjShape& shape, const std::string& dist, const std::vector<Unsigned>& modeAligns,
-      T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g );
+      T* buffer, const std::vector<Offset>& strides, const rote::Grid& g );
 
     // Create a copy of distributed matrix A
     DistTensorBase( const DistTensorBase<T>& A );
@@ -102,10 +99,11 @@ public:
     virtual ~DistTensorBase();
 
 #ifndef SWIG
-    // Move constructor
-    //DistTensor( DistTensor<T>&& A );
-    // Move assignment
-    //DistTensor<T>& operator=( DistTensor<T>&& A );
+    // Move constructor; takes over A's distribution, alignments, grid view
+    // and storage, leaving A empty
+    DistTensorBase( DistTensorBase<T>&& A );
+    // Move assignment; falls back to copying for views and across grids
+    DistTensorBase<T>& operator=( DistTensorBase<T>&& A );
 #endif
 
     const DistTensorBase<T>& operator=( const DistTensorBase<T>& A );
@@ -117,16 +115,16 @@ public:
     ObjShape MaxLocalShape() const;
     ObjShape LocalShape() const;
     Unsigned LocalDimension(Mode mode) const;
-    std::vector<Unsigned> LocalStrides() const;
-    Unsigned LocalModeStride(Mode mode) const;
+    std::vector<Offset> LocalStrides() const;
+    Offset LocalModeStride(Mode mode) const;
 
     TensorDistribution TensorDist() const;
     ModeDistribution ModeDist(Mode mode) const;
 
     void SetDistribution(const TensorDistribution& tenDist);
 
-    std::vector<Unsigned> Strides() const;
-    Unsigned Stride(Mode mode) const;
+    std::vector<Offset> Strides() const;
+    Offset Stride(Mode mode) const;
 
     size_t AllocatedMemory() const;
 
@@ -206,6 +204,27 @@ public:
     mpi::Comm GetParticipatingComm() const;
     void Empty();
     void EmptyData();
+    // Policy for the local storage (see Tensor::SetAllocationPolicy)
+    void SetAllocationPolicy( const AllocationPolicy& policy );
+    AllocationPolicy GetAllocationPolicy() const;
+    // Out-of-core local storage (see Tensor::SetOutOfCore)
+    void SetOutOfCore( const std::string& dir="" );
+    void SetInCore();
+    bool OutOfCore() const;
+    // Node-shared local storage: processes on one node that hold the same
+    // entries, i.e. that differ only along grid modes the distribution
+    // replicates over, keep a single copy in a shared-memory window.
+    // Collective over the grid, as are later resizes and destruction.
+    // Redistributions into the tensor write it once per node and publish
+    // the result.  Set/Update only write on the NodeLeader; these and all
+    // other local writes, also through views, must be followed by NodeSync
+    // on every process before the entries are read elsewhere on the node.
+    void SetNodeShared();
+    void SetNodePrivate();
+    bool NodeShared() const;
+    bool NodeLeader() const;
+    void NodeSync() const;
+    mpi::Comm GetNodeCommunicatorForModes(const ModeArray& modes, const rote::Grid& grid);
     void SetGrid( const rote::Grid& grid );
 
     void Swap( DistTensorBase<T>& A );
@@ -237,9 +256,17 @@ public:
     void Set( const Location& loc, T alpha );
     void Update( const Location& loc, T alpha );
 
+    // Bulk versions, collective over the grid: each process passes its own
+    // (possibly empty) list of global locations and exchanges them with the
+    // owners in one all-to-all.  SetMany writes every copy of an entry;
+    // UpdateMany sums all contributions to an entry into it.
+    std::vector<T> GetMany( const std::vector<Location>& locs ) const;
+    void SetMany( const std::vector<Location>& locs, const std::vector<T>& values );
+    void UpdateMany( const std::vector<Location>& locs, const std::vector<T>& values );
+
     void ResizeTo( const DistTensorBase<T>& A);
     void ResizeTo( const ObjShape& shape );
-    void ResizeTo( const ObjShape& shape, const std::vector<Unsigned>& strides );
+    void ResizeTo( const ObjShape& shape, const std::vector<Offset>& strides );
 
     // Distribution alignment
     void AlignWith( const DistTensorBase<T>& A );
@@ -275,13 +302,13 @@ public:
     // (Immutable) view of a distributed matrix's buffer
     void Attach
     ( const ObjShape& shape, const std::vector<Unsigned>& modeAligns,
-      T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& grid );
+      T* buffer, const std::vector<Offset>& strides, const rote::Grid& grid );
     void LockedAttach
     ( const ObjShape& shape, const std::vector<Unsigned>& modeAligns,
-      const T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& grid );
+      const T* buffer, const std::vector<Offset>& strides, const rote::Grid& grid );
     void LockedAttach
         ( const ObjShape& shape, const std::vector<Unsigned>& modeAligns,
-          const T* buffer, const Permutation& perm, const std::vector<Unsigned>& strides, const rote::Grid& grid );
+          const T* buffer, const Permutation& perm, const std::vector<Offset>& strides, const rote::Grid& grid );
 
     //
     // Though the following routines are meant for complex data, all
@@ -317,7 +344,6 @@ protected:
 
     //Grid information
     const rote::Grid* grid_;
-    rote::mpi::CommMap* commMap_;
     rote::GridView gridView_;
     mpi::Comm participatingComm_;
 
@@ -334,6 +360,11 @@ private:
 
     void ComplainIfReal() const;
 
+    // Common part of SetMany and UpdateMany
+    void ScatterMany
+    ( const std::vector<Location>& locs, const std::vector<T>& values,
+      bool update );
+
     void SetAlignmentsAndResize
     ( const std::vector<Unsigned>& aligns, const ObjShape& shape );
     void ForceAlignmentsAndResize
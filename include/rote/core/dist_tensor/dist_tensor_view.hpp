@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ROTE_CORE_DISTTENSOR_DISTTENSORVIEW_HPP
+#define ROTE_CORE_DISTTENSOR_DISTTENSORVIEW_HPP
+
+namespace rote {
+
+// Non-owning window [offsets, offsets+shape) of a DistTensor for blocked
+// partition loops.  It refers to the tensor the outermost view was taken
+// of and only stores the window, so (Locked)PartitionDown, RepartitionDown
+// and SlidePartitionDown on views neither allocate storage nor look up
+// distributions, grid views or communicators.  A full DistTensor view is
+// only set up when the window is actually read or written, by View /
+// LockedView or the redistribution routines accepting views.
+//
+// Views are handles: a const DistTensorView may still be written through
+// unless it was taken with LockedView (or from a const DistTensor), and it
+// must not outlive the tensor it refers to.
+template<typename T>
+class DistTensorView
+{
+public:
+    // Views nothing until assigned by one of the view routines
+    DistTensorView();
+    // The whole of A
+    DistTensorView( DistTensor<T>& A );
+    DistTensorView( const DistTensor<T>& A );
+
+    Unsigned Order() const;
+    const ObjShape& Shape() const;
+    Unsigned Dimension( Mode mode ) const;
+    // Location of the window's first entry in Parent()
+    const Location& Offsets() const;
+    bool Locked() const;
+
+    const DistTensor<T>& Parent() const;
+    const rote::Grid& Grid() const;
+    TensorDistribution TensorDist() const;
+    bool OutOfCore() const;
+
+    //
+    // Redistribution into the window (see DistTensor::RedistFrom)
+    //
+    void RedistFrom(const DistTensor<T>& A, const ModeArray& reduceModes, const T alpha=T(1), const T beta=T(0)) const;
+    void RedistFrom(const DistTensor<T>& A) const;
+    void RedistributeFrom(const DistTensor<T>& A) const;
+    void ReduceFrom(const DistTensor<T>& A, const ModeArray& reduceModes, const T alpha=T(1), const T beta=T(0)) const;
+    void ReduceFrom(const DistTensor<T>& A, const Mode& reduceMode, const T alpha=T(1), const T beta=T(0)) const;
+
+private:
+    DistTensor<T>* parent_;
+    bool locked_;
+    Location offsets_;
+    ObjShape shape_;
+
+#ifndef SWIG
+    template<typename S>
+    friend void ViewHelper
+    ( DistTensorView<S>& A, const DistTensorView<S>& B,
+      const Location& loc, const ObjShape& shape, bool isLocked );
+    template<typename S>
+    friend void View2x1Helper
+    ( DistTensorView<S>& A, const DistTensorView<S>& BT,
+      const DistTensorView<S>& BB, Mode mode, bool isLocked );
+    template<typename S>
+    friend void View( DistTensor<S>& A, const DistTensorView<S>& B );
+#endif // ifndef SWIG
+};
+
+} // namespace rote
+
+#endif // ifndef ROTE_CORE_DISTTENSOR_DISTTENSORVIEW_HPP
@@ -42,17 +42,17 @@ public:
     // Create a "shape" distributed tensor with specified alignments
     // and leading dimension
     DistTensor
-    ( const ObjShape& shape, const TensorDistribution& dist, const std::vector<Unsigned>& modeAligns, const std::vector<Unsigned>& strides, const rote::Grid& g );
+    ( const ObjShape& shape, const TensorDistribution& dist, const std::vector<Unsigned>& modeAligns, const std::vector<Offset>& strides, const rote::Grid& g );
 
     // View a constant distributed tensor's buffer
     DistTensor
     ( const ObjShape& shape, const TensorDistribution& dist, const std::vector<Unsigned>& modeAligns,
-      const T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g );
+      const T* buffer, const std::vector<Offset>& strides, const rote::Grid& g );
 
     // View a mutable distributed tensor's buffer
     DistTensor
     ( const ObjShape& shape, const TensorDistribution& dist, const std::vector<Unsigned>& modeAligns,
-      T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g );
+      T* buffer, const std::vector<Offset>& strides, const rote::Grid& g );
 
     //////////////////////////////////
     /// String distribution versions
@@ -72,23 +72,34 @@ public:
     // Create a "shape" distributed tensor with specified alignments
     // and leading dimension
     DistTensor
-    ( const ObjShape& shape, const std::string& dist, const std::vector<Unsigned>& modeAligns, const std::vector<Unsigned>& strides, const rote::Grid& g );
+    ( const ObjShape& shape, const std::string& dist, const std::vector<Unsigned>& modeAligns, const std::vector<Offset>& strides, const rote::Grid& g );
 
     // View a constant distributed tensor's buffer
     DistTensor
     ( const ObjShape& shape, const std::string& dist, const std::vector<Unsigned>& modeAligns,
-      const T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g );
+      const T* buffer, const std::vector<Offset>& strides, const rote::Grid& g );
 
     // View a mutable distributed tensor's buffer
     DistTensor
     ( const ObjShape& shape, const std::string& dist, const std::vector<Unsigned>& modeAligns,
-      T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g );
+      T* buffer, const std::vector<Offset>& strides, const rote::Grid& g );
 
     // Create a copy of distributed matrix A
-//    DistTensor( const DistTensor<T>& A );
+    DistTensor( const DistTensor<T>& A );
+    const DistTensor<T>& operator=( const DistTensor<T>& A );
+
+#ifndef SWIG
+    // Take over A's contents (see DistTensorBase)
+    DistTensor( DistTensor<T>&& A );
+    DistTensor<T>& operator=( DistTensor<T>&& A );
+#endif
 
     ~DistTensor();
 
+    // Evaluate an elementwise expression (see btas-like/level1/Expr.hpp)
+    template<typename E>
+    DistTensor<T>& operator=( const ExprBase<T, E>& expr );
+
 
     ///////////////////////////////////////
     //
@@ -100,6 +111,13 @@ public:
     void ReduceFrom(const DistTensor<T>& A, const ModeArray& reduceModes, const T alpha=T(1), const T beta=T(0));
     void ReduceFrom(const DistTensor<T>& A, const Mode& reduceMode, const T alpha=T(1), const T beta=T(0));
 
+    // Redistribute from a window (see DistTensorView)
+    void RedistFrom(const DistTensorView<T>& A, const ModeArray& reduceModes, const T alpha=T(1), const T beta=T(0));
+    void RedistFrom(const DistTensorView<T>& A);
+    void RedistributeFrom(const DistTensorView<T>& A);
+    void ReduceFrom(const DistTensorView<T>& A, const ModeArray& reduceModes, const T alpha=T(1), const T beta=T(0));
+    void ReduceFrom(const DistTensorView<T>& A, const Mode& reduceMode, const T alpha=T(1), const T beta=T(0));
+
     //
     // All-to-all interface routines
     //
@@ -173,6 +191,12 @@ public:
     //
     void ScatterRedistFrom(const DistTensor<T>& A, const ModeArray& commModes, const T alpha=T(1), const T beta=T(0));
 
+    //
+    // Block-cyclic interface routines (any redistribution where either side
+    // has a mode with block size > 1)
+    //
+    void BlockCyclicRedistFrom(const DistTensor<T>& A, const ModeArray& reduceModes, const T alpha=T(1), const T beta=T(0));
+
 private:
     //
     // All-to-all workhorse routines
@@ -181,6 +205,12 @@ private:
     void AllToAllCommRedist(const DistTensor<T>& A, const ModeArray& commModes, const T alpha=T(1), const T beta=T(0));
     void PackA2ACommSendBuf(const DistTensor<T>& A, const ModeArray& commModes, const ObjShape& sendShape, T * const sendBuf);
     void UnpackA2ACommRecvBuf(const T * const recvBuf, const ModeArray& commModes, const ObjShape& sendShape, const DistTensor<T>& A, const T alpha=T(0), const T beta=T(0));
+    // Whether the process at recvGridLoc unpacks anything from rank i of the
+    // all-to-all communicator, and if so the first entry it gets
+    bool A2ACommRecvFirstLoc(const DistTensor<T>& A, const ModeArray& commModes, const Location& recvGridLoc, Unsigned i, Location& firstRecvLoc) const;
+    // Delivers the blocks of sendBuf with one-sided puts into the processes
+    // unpacking them; false if the pattern is too dense for that
+    bool AllToAllRMA(const DistTensor<T>& A, const ModeArray& commModes, const T* sendBuf, T* recvBuf, Offset blockSize, mpi::Comm comm);
 
     //
     // Allgather workhorse routines
@@ -236,7 +266,13 @@ private:
     bool CheckScatterCommRedist(const DistTensor<T>& A);
     void ScatterCommRedist(const DistTensor<T>& A, const ModeArray& commModes, const T alpha=T(1), const T beta=T(0));
 
-    bool AlignCommBufRedist(const DistTensor<T>& A, const T* unalignedSendBuf, const Unsigned sendSize, T* alignedSendBuf, const Unsigned recvSize);
+    //
+    // Block-cyclic workhorse routines
+    //
+    bool CheckBlockCyclicCommRedist(const DistTensor<T>& A);
+    void BlockCyclicCommRedist(const DistTensor<T>& A, const T alpha=T(1), const T beta=T(0));
+
+    bool AlignCommBufRedist(const DistTensor<T>& A, const T* unalignedSendBuf, const Offset sendSize, T* alignedSendBuf, const Offset recvSize);
 
 };
 
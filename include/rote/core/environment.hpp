@@ -90,6 +90,21 @@ void PrintInputReport(){ GetArgs().PrintReport(); };
 Int Blocksize();
 void SetBlocksize( Int blocksize );
 
+// Whether Contract keeps the intermediates it only reads, when replicated,
+// in node-shared storage (see DistTensor::SetNodeShared); off by default
+bool NodeSharedIntermediates();
+void SetNodeSharedIntermediates( bool share );
+
+// Whether all-to-all redistributions in which every process exchanges
+// blocks with at most maxPeerFraction of the communicator put the blocks
+// straight into the receive buffers of the processes unpacking them,
+// completed by fences or by post/start/complete/wait epochs, instead of
+// running a dense all-to-all; off by default
+enum RMAEpoch { RMA_OFF, RMA_FENCE, RMA_PSCW };
+RMAEpoch AllToAllRMA();
+double AllToAllRMAPeerFraction();
+void SetAllToAllRMA( RMAEpoch epoch, double maxPeerFraction=0.25 );
+
 //std::mt19937& Generator();
 
 inline Unsigned IntCeil(Unsigned m, Unsigned n)
@@ -12,13 +12,108 @@
 #define ROTE_CORE_GRID_HPP
 
 #include "imports.hpp"
+#include "tensor_distribution.hpp"
 
 namespace rote {
 
+// Representative work of an application, used to rank grid shapes (see
+// Grid::Suggest).  Distributions refer to the modes of a grid of the given
+// order; counts weigh how often each item occurs.
+class GridWorkload
+{
+public:
+    explicit GridWorkload( Unsigned gridOrder );
+
+    Unsigned GridOrder() const;
+
+    // A tensor kept for the whole run
+    void AddTensor( const ObjShape& shape, const TensorDistribution& dist );
+    // A redistribution of a tensor of the given shape
+    void AddRedist
+    ( const ObjShape& shape, const TensorDistribution& from,
+      const TensorDistribution& to, double count=1 );
+    // C = A * B as performed by Contract: the larger operand stays put
+    // (the smaller too when C is the largest), the other is redistributed
+    // to match it, and the local partial results are reduced into C
+    void AddContraction
+    ( const ObjShape& shapeA, const TensorDistribution& distA, const IndexArray& indicesA,
+      const ObjShape& shapeB, const TensorDistribution& distB, const IndexArray& indicesB,
+      const ObjShape& shapeC, const TensorDistribution& distC, const IndexArray& indicesC,
+      double count=1 );
+
+    struct Tensor
+    {
+        ObjShape shape;
+        TensorDistribution dist;
+    };
+    struct Redist
+    {
+        ObjShape shape;
+        TensorDistribution from;
+        TensorDistribution to;
+        double count;
+    };
+    // A is the stationary operand and B the one moved to match it
+    struct Contraction
+    {
+        Redist redistB;
+        // The partial sums of the intermediate reduced into C
+        Redist reduceT;
+        ObjShape shapeA;
+        TensorDistribution distA;
+        // Modes of B not contracted, as redistributed
+        ObjShape shapeBC;
+        TensorDistribution distBC;
+        double count;
+    };
+
+    const std::vector<Tensor>& Tensors() const;
+    const std::vector<Redist>& Redists() const;
+    const std::vector<Contraction>& Contractions() const;
+
+private:
+    Unsigned gridOrder_;
+    std::vector<Tensor> tensors_;
+    std::vector<Redist> redists_;
+    std::vector<Contraction> contractions_;
+};
+
+// Machine parameters of the model used by Grid::Suggest.  A collective over
+// k processes costs latency*log2(k) + perEntry*(entries received), and a
+// local contraction perFlop per flop.  Sizes are counted in entries.
+struct GridCostModel
+{
+    double latency;
+    double perEntry;
+    double perFlop;
+    // Candidates needing more entries per process than this rank after the
+    // ones that fit; 0 for no limit
+    double memoryLimit;
+
+    GridCostModel()
+    : latency(2e-6), perEntry(1e-9), perFlop(1e-10), memoryLimit(0)
+    { }
+};
+
+struct GridCandidate
+{
+    ObjShape shape;
+    // Modeled time of the workload
+    double time;
+    // Peak entries held per process
+    double memory;
+};
+
 class Grid
 {
 public:
     explicit Grid( mpi::Comm comm, const ObjShape& shape );
+    // Topology-aware placement: the processes of comm are laid out node by
+    // node with the grid modes of largest weight (e.g. the communication
+    // volume expected along them) varying fastest, so that those modes stay
+    // within a node as far as the node size allows.  Grid ranks then differ
+    // from the ranks in comm.
+    Grid( mpi::Comm comm, const ObjShape& shape, const std::vector<double>& modeWeights );
     ~Grid();
 
     // Simple interface (simpler version of distributed-based interface)
@@ -37,7 +132,21 @@ public:
     bool InGrid() const;
     mpi::Comm OwningComm() const;
 
+    // The processes that differ from us only along the given grid modes,
+    // ranked by their location over those modes (the first varying
+    // fastest).  Built for every subset of modes when the grid is set up,
+    // so looking one up is not collective.  COMM_NULL outside the grid.
+    mpi::Comm SubComm( const ModeArray& modes ) const;
+    // SubComm split into the processes sharing our node; collective over
+    // the grid the first time a set of modes is asked for
+    mpi::Comm NodeSubComm( const ModeArray& modes ) const;
+
     static int FindFactor( int p );
+    // Every factorisation of numProcs into a grid of the workload's order,
+    // best first under the given model
+    static std::vector<GridCandidate> Suggest
+    ( Unsigned numProcs, const GridWorkload& workload,
+      const GridCostModel& model=GridCostModel() );
 
     // Utils
     Location ToGridViewLoc(const Location& loc, const GridView& gv) const;
@@ -59,7 +168,9 @@ private:
     mpi::Comm cartComm_;  // the processes that are in the grid
     mpi::Comm owningComm_;
 
-    //std::map<ModeArray, mpi::Comm> comms_;
+    // Indexed by the bitmask of the modes they span
+    std::vector<mpi::Comm> subComms_;
+    mutable std::vector<mpi::Comm> nodeSubComms_;
 
     void SetUpGrid();
 
@@ -75,7 +186,6 @@ bool operator!= ( const Grid& A, const Grid& B );
 
 // Return a grid constructed using mpi::COMM_WORLD.
 const Grid& DefaultGrid();
-mpi::CommMap& DefaultCommMap();
 
 } // namespace rote
 
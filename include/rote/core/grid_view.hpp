@@ -20,7 +20,6 @@ class GridView
 {
 public:
     explicit GridView( const rote::Grid* g, const TensorDistribution& dist );
-    ~GridView();
 
     // Simple interface (simpler version of distributed-based interface)
     Unsigned ParticipatingOrder() const;
@@ -18,5 +18,6 @@
 #include "imports/choice.hpp"
 #include "imports/blas.hpp"
 #include "imports/mpi.hpp"
+#include "imports/mpi_hierarchical.hpp"
 
 #endif // ifndef ROTE_CORE_IMPORTS_HPP
@@ -39,8 +39,9 @@ typedef MPI_Op Op;
 typedef MPI_Request Request;
 typedef MPI_Status Status;
 typedef MPI_User_function UserFunction;
-
-typedef std::map<ModeArray, mpi::Comm> CommMap;
+typedef MPI_Win Window;
+typedef MPI_File File;
+typedef MPI_Info Info;
 
 // Standard constants
 const int ANY_SOURCE = MPI_ANY_SOURCE;
@@ -63,6 +64,14 @@ const ErrorHandler ERRORS_RETURN = MPI_ERRORS_RETURN;
 const ErrorHandler ERRORS_ARE_FATAL = MPI_ERRORS_ARE_FATAL;
 const Group GROUP_EMPTY = MPI_GROUP_EMPTY;
 const Request REQUEST_NULL = MPI_REQUEST_NULL;
+const Comm COMM_NULL = MPI_COMM_NULL;
+const Window WINDOW_NULL = MPI_WIN_NULL;
+const Info INFO_NULL = MPI_INFO_NULL;
+const Datatype BYTE = MPI_BYTE;
+const int MODE_RDONLY = MPI_MODE_RDONLY;
+const int MODE_WRONLY = MPI_MODE_WRONLY;
+const int MODE_RDWR = MPI_MODE_RDWR;
+const int MODE_CREATE = MPI_MODE_CREATE;
 const Op MAX = MPI_MAX;
 const Op MIN = MPI_MIN;
 const Op MAXLOC = MPI_MAXLOC;
@@ -79,6 +88,11 @@ const Op BINARY_XOR = MPI_BXOR;
 // Added constant(s)
 const int MIN_COLL_MSG = 1; // minimum message size for collectives
 inline int Pad( int count ) { return std::max(count,MIN_COLL_MSG); }
+// Largest count handed to a single MPI call; point-to-point and reduction
+// routines taking an Offset count split larger messages into chunks, while
+// fixed-size collectives use the MPI-4 large-count interface when available
+// (HAVE_MPI_LARGE_COUNT) and a derived datatype otherwise
+const int MAX_MSG_COUNT = INT_MAX;
 
 // Environment routines
 void Initialize( int& argc, char**& argv );
@@ -109,6 +123,62 @@ void CartCreate
 void CartSub
 ( Comm comm, const int* remainingDims, Comm& subComm );
 
+// Shared-memory windows (MPI-3, HAVE_MPI3_SHARED_MEMORY); without them these
+// throw a LogicError
+// The processes of comm that can share memory with us
+void CommSplitShared( Comm comm, int key, Comm& sharedComm );
+// Allocates 'bytes' bytes on each process of a shared-memory comm and
+// returns the start of the segment of process 0; the window is held in a
+// passive-target epoch until it is freed
+void* WindowAllocateShared( Aint bytes, Comm comm, Window& win );
+void WindowFreeShared( Window& win );
+// Makes the stores of every process of comm to win visible to the others
+void WindowSync( Window win, Comm comm );
+
+// One-sided communication
+// Exposes 'bytes' bytes at base to the processes of comm; target
+// displacements are counted in units of dispUnit bytes
+void WindowCreate( void* base, Aint bytes, int dispUnit, Comm comm, Window& win );
+void WindowFree( Window& win );
+// Active-target epochs: a fence is collective over the window's group,
+// while post/wait expose the window to the given origins only and
+// start/complete access the given targets only
+void WindowFence( Window win );
+void WindowPost( Group origins, Window win );
+void WindowWait( Window win );
+void WindowStart( Group targets, Window win );
+void WindowComplete( Window win );
+// targetDispl is in entries of a window with dispUnit sizeof(R)
+template<typename R>
+void Put
+( const R* sbuf, Offset count, int target, Aint targetDispl, Window win );
+
+// Derived datatypes
+void TypeCreateHvector
+( int count, int blockLength, Aint stride, Datatype oldType,
+  Datatype& newType );
+void TypeCommit( Datatype& type );
+void TypeFree( Datatype& type );
+
+// Info objects, e.g. for MPI-IO hints
+void InfoCreate( Info& info );
+void InfoSet( Info info, const std::string& key, const std::string& value );
+void InfoFree( Info& info );
+
+// MPI-IO; offsets are in bytes and views have MPI_BYTE as their etype
+void FileOpen
+( Comm comm, const std::string& filename, int amode, Info info, File& fh );
+void FileClose( File& fh );
+Offset FileSize( File fh );
+void FileSetSize( File fh, Offset bytes );
+void FileSetView( File fh, Offset disp, Datatype fileType, Info info=INFO_NULL );
+void FileReadAt( File fh, Offset offset, void* buf, int count, Datatype type );
+void FileWriteAt
+( File fh, Offset offset, const void* buf, int count, Datatype type );
+// Collective over the processes that opened fh
+void FileReadAll( File fh, void* buf, int count, Datatype type );
+void FileWriteAll( File fh, const void* buf, int count, Datatype type );
+
 // Group manipulation
 int GroupRank( Group group );
 int GroupSize( Group group );
@@ -138,12 +208,12 @@ int GetCount( Status& status );
 // Send
 // ----
 template<typename R>
-void TaggedSend( const R* buf, int count, int to, int tag, Comm comm );
+void TaggedSend( const R* buf, Offset count, int to, int tag, Comm comm );
 template<typename R>
-void TaggedSend( const std::complex<R>* buf, int count, int to, int tag, Comm comm );
+void TaggedSend( const std::complex<R>* buf, Offset count, int to, int tag, Comm comm );
 // If the tag is irrelevant
 template<typename T>
-void Send( const T* buf, int count, int to, Comm comm );
+void Send( const T* buf, Offset count, int to, Comm comm );
 // If the send-count is one
 template<typename T>
 void TaggedSend( T b, int to, int tag, Comm comm );
@@ -192,12 +262,12 @@ void ISSend( T b, int to, Comm comm, Request& request );
 // Recv
 // ----
 template<typename R>
-void TaggedRecv( R* buf, int count, int from, int tag, Comm comm );
+void TaggedRecv( R* buf, Offset count, int from, int tag, Comm comm );
 template<typename R>
-void TaggedRecv( std::complex<R>* buf, int count, int from, int tag, Comm comm );
+void TaggedRecv( std::complex<R>* buf, Offset count, int from, int tag, Comm comm );
 // If the tag is irrelevant
 template<typename T>
-void Recv( T* buf, int count, int from, Comm comm );
+void Recv( T* buf, Offset count, int from, Comm comm );
 // If the recv count is one
 template<typename T>
 T TaggedRecv( int from, int tag, Comm comm );
@@ -227,17 +297,17 @@ T IRecv( int from, Comm comm, Request& request );
 // --------
 template<typename R>
 void TaggedSendRecv
-( const R* sbuf, int sc, int to,   int stag,
-        R* rbuf, int rc, int from, int rtag, Comm comm );
+( const R* sbuf, Offset sc, int to,   int stag,
+        R* rbuf, Offset rc, int from, int rtag, Comm comm );
 template<typename R>
 void TaggedSendRecv
-( const std::complex<R>* sbuf, int sc, int to,   int stag,
-        std::complex<R>* rbuf, int rc, int from, int rtag, Comm comm );
+( const std::complex<R>* sbuf, Offset sc, int to,   int stag,
+        std::complex<R>* rbuf, Offset rc, int from, int rtag, Comm comm );
 // If the tags are irrelevant
 template<typename T>
 void SendRecv
-( const T* sbuf, int sc, int to,
-        T* rbuf, int rc, int from, Comm comm );
+( const T* sbuf, Offset sc, int to,
+        T* rbuf, Offset rc, int from, Comm comm );
 // If the send and recv counts are one
 template<typename T>
 T TaggedSendRecv( T sb, int to, int stag, int from, int rtag, Comm comm );
@@ -263,9 +333,9 @@ void SendRecv( T* buf, int count, int to, int from, Comm comm );
 // Broadcast
 // ---------
 template<typename R>
-void Broadcast( R* buf, int count, int root, Comm comm );
+void Broadcast( R* buf, Offset count, int root, Comm comm );
 template<typename R>
-void Broadcast( std::complex<R>* buf, int count, int root, Comm comm );
+void Broadcast( std::complex<R>* buf, Offset count, int root, Comm comm );
 // If the message length is one
 template<typename T>
 void Broadcast( T& b, int root, Comm comm );
@@ -288,12 +358,12 @@ void IBroadcast( T& b, int root, Comm comm, Request& request );
 // ------
 template<typename R>
 void Gather
-( const R* sbuf, int sc,
-        R* rbuf, int rc, int root, Comm comm );
+( const R* sbuf, Offset sc,
+        R* rbuf, Offset rc, int root, Comm comm );
 template<typename R>
 void  Gather
-( const std::complex<R>* sbuf, int sc,
-        std::complex<R>* rbuf, int rc, int root, Comm comm );
+( const std::complex<R>* sbuf, Offset sc,
+        std::complex<R>* rbuf, Offset rc, int root, Comm comm );
 
 #ifdef HAVE_NONBLOCKING_COLLECTIVES
 // Non-blocking gather
@@ -324,12 +394,12 @@ void Gather
 // ---------
 template<typename R>
 void AllGather
-( const R* sbuf, int sc,
-        R* rbuf, int rc, Comm comm );
+( const R* sbuf, Offset sc,
+        R* rbuf, Offset rc, Comm comm );
 template<typename R>
 void AllGather
-( const std::complex<R>* sbuf, int sc,
-        std::complex<R>* rbuf, int rc, Comm comm );
+( const std::complex<R>* sbuf, Offset sc,
+        std::complex<R>* rbuf, Offset rc, Comm comm );
 
 // AllGather with variable recv sizes
 // ----------------------------------
@@ -346,28 +416,41 @@ void AllGather
 // -------
 template<typename R>
 void Scatter
-( const R* sbuf, int sc,
-        R* rbuf, int rc, int root, Comm comm );
+( const R* sbuf, Offset sc,
+        R* rbuf, Offset rc, int root, Comm comm );
 template<typename R>
 void Scatter
-( const std::complex<R>* sbuf, int sc,
-        std::complex<R>* rbuf, int rc, int root, Comm comm );
+( const std::complex<R>* sbuf, Offset sc,
+        std::complex<R>* rbuf, Offset rc, int root, Comm comm );
 // In-place option
 template<typename R>
 void Scatter( R* buf, int sc, int rc, int root, Comm comm );
 template<typename R>
 void Scatter( std::complex<R>* buf, int sc, int rc, int root, Comm comm );
 
+#if HAVE_NONBLOCKING
+// Non-blocking scatter
+// --------------------
+template<typename R>
+void IScatter
+( const R* sbuf, int sc,
+        R* rbuf, int rc, int root, Comm comm, Request& request );
+template<typename R>
+void IScatter
+( const std::complex<R>* sbuf, int sc,
+        std::complex<R>* rbuf, int rc, int root, Comm comm, Request& request );
+#endif
+
 // AllToAll
 // --------
 template<typename R>
 void AllToAll
-( const R* sbuf, int sc,
-        R* rbuf, int rc, Comm comm );
+( const R* sbuf, Offset sc,
+        R* rbuf, Offset rc, Comm comm );
 template<typename R>
 void AllToAll
-( const std::complex<R>* sbuf, int sc,
-        std::complex<R>* rbuf, int rc, Comm comm );
+( const std::complex<R>* sbuf, Offset sc,
+        std::complex<R>* rbuf, Offset rc, Comm comm );
 
 // AllToAll with non-uniform send/recv sizes
 // -----------------------------------------
@@ -379,19 +462,24 @@ template<typename R>
 void AllToAll
 ( const std::complex<R>* sbuf, const int* scs, const int* sds,
         std::complex<R>* rbuf, const int* rcs, const int* rds, Comm comm );
+// With counts and displacements too large for an int
+template<typename R>
+void AllToAll
+( const R* sbuf, const Offset* scs, const Offset* sds,
+        R* rbuf, const Offset* rcs, const Offset* rds, Comm comm );
 
 // Reduce
 // ------
 template<typename T>
 void Reduce
-( const T* sbuf, T* rbuf, int count, Op op, int root, Comm comm );
+( const T* sbuf, T* rbuf, Offset count, Op op, int root, Comm comm );
 template<typename R>
 void Reduce
-( const std::complex<R>* sbuf, std::complex<R>* rbuf, int count, Op op,
+( const std::complex<R>* sbuf, std::complex<R>* rbuf, Offset count, Op op,
   int root, Comm comm );
 // Default to mpi::SUM
 template<typename T>
-void Reduce( const T* sbuf, T* rbuf, int count, int root, Comm comm );
+void Reduce( const T* sbuf, T* rbuf, Offset count, int root, Comm comm );
 // With a message-size of one
 template<typename T>
 T Reduce( T sb, Op op, int root, Comm comm );
@@ -412,13 +500,13 @@ void Reduce( T* buf, int count, int root, Comm comm );
 // AllReduce
 // ---------
 template<typename T>
-void AllReduce( const T* sbuf, T* rbuf, int count, Op op, Comm comm );
+void AllReduce( const T* sbuf, T* rbuf, Offset count, Op op, Comm comm );
 template<typename R>
 void AllReduce
-( const std::complex<R>* sbuf, std::complex<R>* rbuf, int count, Op op, Comm comm );
+( const std::complex<R>* sbuf, std::complex<R>* rbuf, Offset count, Op op, Comm comm );
 // Default to mpi::SUM
 template<typename T>
-void AllReduce( const T* sbuf, T* rbuf, int count, Comm comm );
+void AllReduce( const T* sbuf, T* rbuf, Offset count, Comm comm );
 // If the message-length is one
 template<typename T>
 T AllReduce( T sb, Op op, Comm comm );
@@ -440,13 +528,13 @@ void AllReduce( T* buf, int count, Comm comm );
 // -------------
 template<typename R>
 void ReduceScatter
-( R* sbuf, R* rbuf, int rc, Op op, Comm comm );
+( R* sbuf, R* rbuf, Offset rc, Op op, Comm comm );
 template<typename R>
 void ReduceScatter
-( std::complex<R>* sbuf, std::complex<R>* rbuf, int rc, Op op, Comm comm );
+( std::complex<R>* sbuf, std::complex<R>* rbuf, Offset rc, Op op, Comm comm );
 // Default to mpi::SUM
 template<typename T>
-void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm );
+void ReduceScatter( T* sbuf, T* rbuf, Offset rc, Comm comm );
 
 // Single-buffer ReduceScatter
 // ---------------------------
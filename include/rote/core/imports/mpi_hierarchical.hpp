@@ -0,0 +1,67 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ROTE_CORE_MPI_HIERARCHICAL_HPP
+#define ROTE_CORE_MPI_HIERARCHICAL_HPP
+
+namespace rote {
+namespace mpi {
+
+// Two-level versions of the collectives used by the redistributions: the
+// data is combined within each node, exchanged between one leader per node
+// and then handed back out within the node.  Each call below falls back to
+// the flat collective unless the two-level scheme is enabled for its kind
+// and message size, the processes of comm span several nodes and every
+// node holds the same number (more than one) of them.
+//
+// Which calls use it is chosen per collective, either with
+// SetHierarchical or through the environment, e.g.
+// ROTE_HIERARCHICAL_ALLGATHER=65536 or ROTE_HIERARCHICAL_ALLTOALL=4096:1048576
+// for the bytes each process contributes, as minimum[:maximum].
+enum Collective
+{
+    ALLGATHER,
+    ALLTOALL,
+    REDUCESCATTER,
+    ALLREDUCE,
+    NUM_COLLECTIVES
+};
+
+// Use the two-level scheme when each process contributes between minBytes
+// and maxBytes (inclusive)
+void SetHierarchical
+( Collective coll, std::size_t minBytes,
+  std::size_t maxBytes=std::numeric_limits<std::size_t>::max() );
+void UnsetHierarchical( Collective coll );
+// Treats every nodeSize consecutive processes of a communicator as one
+// node (0 for the actual nodes), so the two-level scheme can be tested on
+// a single node.  With interleaved, node n instead holds the processes
+// whose rank is n modulo the number of nodes, as under round-robin
+// placement.  Only affects communicators not yet asked about.
+void SetHierarchicalNodeSize( int nodeSize, bool interleaved=false );
+// Whether a call contributing the given bytes per process would be
+// two-level; collective over comm the first time comm is asked about
+bool Hierarchical( Collective coll, std::size_t bytes, Comm comm );
+
+template<typename T>
+void HierarchicalAllGather
+( const T* sbuf, Offset sc, T* rbuf, Offset rc, Comm comm );
+template<typename T>
+void HierarchicalAllToAll
+( const T* sbuf, Offset sc, T* rbuf, Offset rc, Comm comm );
+// Sums, like the default ReduceScatter and AllReduce
+template<typename T>
+void HierarchicalReduceScatter( T* sbuf, T* rbuf, Offset rc, Comm comm );
+template<typename T>
+void HierarchicalAllReduce( const T* sbuf, T* rbuf, Offset count, Comm comm );
+
+} // mpi
+} // rote
+
+#endif // ifndef ROTE_CORE_MPI_HIERARCHICAL_HPP
@@ -21,6 +21,14 @@ Unsigned Length( Unsigned n, Unsigned shift, Unsigned wrap );
 Unsigned Length( Unsigned n, Int rank, Unsigned alignment, Unsigned wrap );
 Unsigned MaxLength( Unsigned n, Unsigned wrap );
 Unsigned Shift( Int rank, Unsigned alignment, Unsigned wrap );
+// Block-cyclic versions: blocks of blockSize consecutive indices are dealt
+// out cyclically, so the process with the given shift owns block k when
+// k = shift (mod wrap)
+Unsigned BlockLength( Unsigned n, Unsigned shift, Unsigned wrap, Unsigned blockSize );
+Unsigned MaxBlockLength( Unsigned n, Unsigned wrap, Unsigned blockSize );
+Unsigned BlockOwner( Unsigned index, Unsigned alignment, Unsigned wrap, Unsigned blockSize );
+Unsigned BlockGlobal2Local( Unsigned index, Unsigned wrap, Unsigned blockSize );
+Unsigned BlockLocal2Global( Unsigned index, Unsigned shift, Unsigned wrap, Unsigned blockSize );
 
 //
 // Vector
@@ -28,14 +36,16 @@ Unsigned Shift( Int rank, Unsigned alignment, Unsigned wrap );
 std::vector<Unsigned> LCMs( const std::vector<Unsigned>& a, const std::vector<Unsigned>& b );
 std::vector<Unsigned> Lengths(const ObjShape& objShape, const std::vector<Unsigned>& shifts, const ObjShape& wrapShape);
 std::vector<Unsigned> MaxLengths(const ObjShape& objShape, const ObjShape& wrapShape);
+std::vector<Unsigned> BlockLengths(const ObjShape& objShape, const std::vector<Unsigned>& shifts, const ObjShape& wrapShape, const std::vector<Unsigned>& blockSizes);
+std::vector<Unsigned> MaxBlockLengths(const ObjShape& objShape, const ObjShape& wrapShape, const std::vector<Unsigned>& blockSizes);
 std::vector<Unsigned> Shifts( const std::vector<Unsigned>& modeRanks, const std::vector<Unsigned> alignments, const std::vector<Unsigned>& wrapShape);
 std::vector<Unsigned> IntCeils(const std::vector<Unsigned>& ms, const std::vector<Unsigned>& ns);
 
 // Other
-std::vector<Unsigned> Dimensions2Strides(const ObjShape& objShape);
-Unsigned Loc2LinearLoc(const Location& loc, const ObjShape& shape);
-Location LinearLoc2Loc(Unsigned linearLoc, const ObjShape& objShape);
-Unsigned LinearLocFromStrides(const Location& loc, const std::vector<Unsigned>& strides);
+std::vector<Offset> Dimensions2Strides(const ObjShape& objShape);
+Offset Loc2LinearLoc(const Location& loc, const ObjShape& shape);
+Location LinearLoc2Loc(Offset linearLoc, const ObjShape& objShape);
+Offset LinearLocFromStrides(const Location& loc, const std::vector<Offset>& strides);
 
 } // namespace rote
 
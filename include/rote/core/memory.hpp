@@ -12,21 +12,91 @@
 
 namespace rote {
 
+// Storage for size_ entries of G drawn from the memory pool
+// (see memory_pool.hpp); bytes_ is the size class actually held.
+// Allocations follow the default allocation policy unless SetPolicy has
+// been called; changing the policy moves the held entries to a block
+// allocated under the new one.  The bytes held are reported to the memory
+// accounting under category_ (see memory_accounting.hpp).  Objects
+// constructed inside a WorkspaceMark take their storage from the current
+// workspace while that mark is the innermost one (see workspace.hpp).
+// Out-of-core objects instead map a scratch file for each allocation (see
+// out_of_core.hpp), and node-shared objects allocate a shared-memory window
+// holding one copy for all the processes of their node communicator.
 template<typename G>
 class Memory
 {
     std::size_t size_;
+    std::size_t bytes_;
     G* buffer_;
+    bool customPolicy_;
+    AllocationPolicy policy_;
+    // Policy buffer_ was allocated under
+    AllocationPolicy bufferPolicy_;
+    MemoryCategory category_;
+    // Workspace and mark current at construction, and whether buffer_ was
+    // carved out of it
+    std::shared_ptr<WorkspaceArena> workspace_;
+    std::size_t workspaceMark_;
+    bool fromWorkspace_;
+    // Scratch directory of out-of-core storage; empty when in core
+    std::string scratchDir_;
+    bool fromFile_;
+    // Processes sharing buffer_ (not owned); COMM_NULL when private.  The
+    // window buffer_ lies in, and whether we allocated its memory.
+    mpi::Comm sharedComm_;
+    mpi::Window window_;
+    bool windowLeader_;
+
+    void Allocate( std::size_t bytes, const AllocationPolicy& policy );
+    void Deallocate();
+    void FreeBlock
+    ( G* buffer, std::size_t bytes, const AllocationPolicy& policy,
+      bool fromWorkspace, bool fromFile, mpi::Window& window,
+      bool windowLeader );
+    void Rebind( const AllocationPolicy& policy );
+    void Reallocate();
 public:
     Memory();
     Memory( std::size_t size );
+    explicit Memory( MemoryCategory category );
     ~Memory();
 
+    // Moves leave the source empty; blocks are never shared, so there is no
+    // copying
+    Memory( Memory<G>&& mem );
+    Memory<G>& operator=( Memory<G>&& mem );
+
     void Swap( Memory<G>& mem );
 
     G* Buffer() const;
     std::size_t Size()   const;
 
+    void SetPolicy( const AllocationPolicy& policy );
+    void UseDefaultPolicy();
+    AllocationPolicy Policy() const;
+
+    // Moves the held entries to a scratch file in dir (the default scratch
+    // directory if empty) or back into memory
+    void SetOutOfCore( const std::string& dir="" );
+    void SetInCore();
+    bool OutOfCore() const;
+
+    // Keeps a single copy of the held entries for all processes of comm,
+    // which must be able to share memory and hold identical entries, or
+    // goes back to private storage for MPI_COMM_NULL.  Collective over comm,
+    // as are all later (re)allocations and the destructor.  Only the
+    // leader (process 0 of comm) should write the entries, followed by a
+    // NodeSync on every process.
+    void SetNodeShared( mpi::Comm comm );
+    bool NodeShared() const;
+    mpi::Comm NodeComm() const;
+    bool NodeLeader() const;
+    void NodeSync() const;
+
+    void SetCategory( MemoryCategory category );
+    MemoryCategory Category() const;
+
     G* Require( std::size_t size );
     void Release();
     void Empty();
@@ -0,0 +1,92 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ROTE_CORE_MEMORY_ACCOUNTING_HPP
+#define ROTE_CORE_MEMORY_ACCOUNTING_HPP
+
+namespace rote {
+
+// Per-rank bookkeeping of the bytes held by Memory<G> objects, split by
+// what the storage is for and by the PROFILE_SECTIONs active while it was
+// allocated.  An optional soft budget does not fail allocations; instead
+// planners (contraction block sizes, the memory pool's cache) consult
+// MemoryHeadroom() and pick leaner strategies when it runs short.
+
+enum MemoryCategory
+{
+    TENSOR_MEMORY,   // Local storage of Tensor and DistTensor
+    COMM_MEMORY,     // Redistribution buffers (auxMemory_)
+    CONTRACT_MEMORY, // Intermediates of contractions and Hadamard products
+    IO_MEMORY,       // Staging buffers of the readers and writers
+    MemoryCategory_MAX
+};
+
+std::string MemoryCategoryName( MemoryCategory category );
+
+struct MemoryUsage
+{
+    std::size_t bytesInUse;
+    std::size_t peakBytesInUse;
+    std::size_t numAllocations;
+};
+
+struct MemorySectionUsage
+{
+    std::string name;
+    std::size_t peakBytesInUse; // Total in use at any point inside it
+    std::size_t bytesAllocated; // Allocated while it was active
+};
+
+// Memory<G> objects constructed without an explicit category take the one
+// of the innermost live scope (TENSOR_MEMORY outside of any)
+class MemoryCategoryScope
+{
+public:
+    explicit MemoryCategoryScope( MemoryCategory category );
+    ~MemoryCategoryScope();
+private:
+    MemoryCategory previous_;
+
+    MemoryCategoryScope( const MemoryCategoryScope& );
+    MemoryCategoryScope& operator=( const MemoryCategoryScope& );
+};
+
+MemoryCategory CurrentMemoryCategory();
+
+// Fed by Memory<G>
+void TrackAllocation( MemoryCategory category, std::size_t bytes );
+void TrackDeallocation( MemoryCategory category, std::size_t bytes );
+
+// Sections nest; PROFILE_SECTION pushes and PROFILE_STOP pops its name
+void PushMemorySection( const std::string& name );
+void PopMemorySection();
+
+MemoryUsage GetMemoryUsage( MemoryCategory category );
+MemoryUsage GetTotalMemoryUsage();
+std::vector<MemorySectionUsage> GetMemorySectionUsage();
+// Restart the high-water marks from the current usage and drop the
+// section statistics
+void ResetMemoryPeaks();
+
+// Soft per-rank budget in bytes; zero (the default) means unlimited
+void SetMemoryBudget( std::size_t bytes );
+std::size_t MemoryBudget();
+// Bytes that may still be allocated before the budget is exceeded
+std::size_t MemoryHeadroom();
+// Number of allocations that took the usage past the budget
+std::size_t MemoryBudgetOverruns();
+
+void PrintMemoryUsage( std::ostream& os=std::cout );
+// Collective: the min/avg/max peaks over the ranks of comm, printed on
+// its root
+void ReportMemoryUsage( mpi::Comm comm, std::ostream& os=std::cout );
+
+} // namespace rote
+
+#endif // ifndef ROTE_CORE_MEMORY_ACCOUNTING_HPP
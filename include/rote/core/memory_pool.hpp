@@ -0,0 +1,64 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ROTE_CORE_MEMORY_POOL_HPP
+#define ROTE_CORE_MEMORY_POOL_HPP
+
+namespace rote {
+
+// Caching allocator backing Memory<G> (and hence Tensor<T> storage and the
+// redistribution buffers).  Requests are rounded up to a size class (four
+// classes per power of two, at least 64 bytes) and released blocks are kept
+// per class for reuse until the cached total would exceed the capacity.
+// Fresh blocks come from SystemAllocate (see alloc_policy.hpp) and are only
+// reused for requests made under the same allocation policy.  Blocks are
+// not cached beyond the headroom left by the memory budget.
+// All routines are safe to call from multiple threads.
+
+struct MemoryPoolStats
+{
+    std::size_t numRequests;    // Blocks handed out
+    std::size_t numHits;        // ...of which came from the cache
+    std::size_t numReleases;    // Blocks handed back
+    std::size_t numFrees;       // Blocks returned to the system
+    std::size_t bytesInUse;     // Bytes currently handed out
+    std::size_t peakBytesInUse;
+    std::size_t bytesCached;    // Bytes held for reuse
+};
+
+// Caching can be switched off at runtime; blocks released while disabled
+// go straight back to the system
+void SetMemoryPoolEnabled( bool enabled );
+bool MemoryPoolEnabled();
+
+// Upper bound on the bytes held in the cache (default 1 GiB)
+void SetMemoryPoolCapacity( std::size_t maxCachedBytes );
+std::size_t MemoryPoolCapacity();
+
+// Size class a request of the given number of bytes is rounded up to
+std::size_t MemoryPoolClassSize( std::size_t bytes );
+
+// Allocate at least 'bytes' bytes; on return 'bytes' holds the usable size.
+// Throws std::bad_alloc if the system is out of memory even after trimming.
+void* PoolAllocate( std::size_t& bytes, const AllocationPolicy& policy );
+// Return a block obtained from PoolAllocate along with its usable size and
+// the policy it was allocated under
+void PoolDeallocate
+( void* ptr, std::size_t bytes, const AllocationPolicy& policy );
+
+// Free cached blocks until at most maxCachedBytes remain cached
+void TrimMemoryPool( std::size_t maxCachedBytes=0 );
+
+MemoryPoolStats GetMemoryPoolStats();
+void ResetMemoryPoolStats();
+void PrintMemoryPoolStats( std::ostream& os=std::cout );
+
+} // namespace rote
+
+#endif // ifndef ROTE_CORE_MEMORY_POOL_HPP
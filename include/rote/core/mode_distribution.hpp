@@ -28,6 +28,11 @@ public:
     Unsigned size() const;
     std::vector<Unsigned> Entries() const;
 
+    // Number of consecutive indices dealt to a process at a time
+    // (1 for element-cyclic wrapping); written "(0,1:64)"
+    Unsigned BlockSize() const;
+    void SetBlockSize(Unsigned blockSize);
+
     ModeDistribution& operator=(const ModeDistribution& rhs);
     ModeDistribution& operator+=(const ModeDistribution& rhs);
     ModeDistribution& operator+=(const Mode& rhs);
@@ -54,6 +59,7 @@ public:
     friend bool operator!= ( const ModeDistribution& A, const ModeDistribution& B );
 private:
     std::vector<Unsigned> entries_;
+    Unsigned blockSize_;
     void CheckIsValid();
 };
 
@@ -0,0 +1,42 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ROTE_CORE_OUT_OF_CORE_HPP
+#define ROTE_CORE_OUT_OF_CORE_HPP
+
+namespace rote {
+
+// Out-of-core storage: blocks backed by a shared mapping of an (already
+// unlinked) file in a scratch directory, so that the kernel pages them in
+// and out as they are touched.  Such blocks are neither pooled nor counted
+// by the memory accounting.
+
+// Directory new scratch files are created in; defaults to $ROTE_SCRATCH_DIR,
+// then $TMPDIR, then /tmp.  Should be node-local.
+void SetScratchDirectory( const std::string& dir );
+std::string ScratchDirectory();
+
+// Maps a fresh zero-filled scratch file of at least 'bytes' bytes in dir
+// and rounds bytes up to the mapped length.  Throws a RuntimeError on
+// failure.
+void* MapScratchFile( const std::string& dir, std::size_t& bytes );
+void UnmapScratchFile( void* ptr, std::size_t bytes );
+
+// Whether ptr lies in a block returned by MapScratchFile
+bool IsOutOfCore( const void* ptr );
+
+// Hints for the pages of [ptr,ptr+bytes); no-ops outside scratch mappings.
+// Prefetch starts reading them in, Evict starts writing back the dirty
+// ones and lets all of them be dropped from memory.
+void PrefetchOutOfCore( const void* ptr, std::size_t bytes );
+void EvictOutOfCore( const void* ptr, std::size_t bytes );
+
+} // namespace rote
+
+#endif // ifndef ROTE_CORE_OUT_OF_CORE_HPP
@@ -44,6 +44,7 @@ struct BlkContractStatCInfo
 	Permutation permC; // Stat C
 	ModeArray partModesC; // Stat A
 	std::vector<Unsigned> blkSizes;
+	Offset workspaceBytes; // Initial size of the block-loop workspace
 };
 
 struct BlkHadamardStatCInfo
@@ -77,71 +78,77 @@ struct BlkHadamardStatCInfo
 struct PackData
 {
     ObjShape loopShape;
-    std::vector<Unsigned> srcBufStrides;
-    std::vector<Unsigned> dstBufStrides;
+    std::vector<Offset> srcBufStrides;
+    std::vector<Offset> dstBufStrides;
     Permutation permutation;
 };
 
 struct YAxpPxData{
     ObjShape loopShape;
-    std::vector<Unsigned> srcStrides;
-    std::vector<Unsigned> permSrcStrides;
-    std::vector<Unsigned> dstStrides;
+    std::vector<Offset> srcStrides;
+    std::vector<Offset> permSrcStrides;
+    std::vector<Offset> dstStrides;
 };
 
 struct YAxpByData{
     ObjShape loopShape;
-    std::vector<Unsigned> srcStrides;
-    std::vector<Unsigned> dstStrides;
+    std::vector<Offset> srcStrides;
+    std::vector<Offset> dstStrides;
 };
 
 struct ScalData{
     ObjShape loopShape;
-    std::vector<Unsigned> srcStrides;
+    std::vector<Offset> srcStrides;
 };
 
 struct DiffData{
     ObjShape loopShape;
-    std::vector<Unsigned> src1Strides;
-    std::vector<Unsigned> src2Strides;
-    std::vector<Unsigned> dstStrides;
+    std::vector<Offset> src1Strides;
+    std::vector<Offset> src2Strides;
+    std::vector<Offset> dstStrides;
 };
 
 struct ElemScalData{
     ObjShape loopShape;
-    std::vector<Unsigned> src1Strides;
-    std::vector<Unsigned> src2Strides;
-    std::vector<Unsigned> dstStrides;
+    std::vector<Offset> src1Strides;
+    std::vector<Offset> src2Strides;
+    std::vector<Offset> dstStrides;
 };
 
 struct HadamardScalData{
     ObjShape loopShapeAC;
-    std::vector<Unsigned> stridesACA;
-    std::vector<Unsigned> stridesACC;
+    std::vector<Offset> stridesACA;
+    std::vector<Offset> stridesACC;
 
 		ObjShape loopShapeBC;
-    std::vector<Unsigned> stridesBCB;
-    std::vector<Unsigned> stridesBCC;
+    std::vector<Offset> stridesBCB;
+    std::vector<Offset> stridesBCC;
 
 		ObjShape loopShapeABC;
-    std::vector<Unsigned> stridesABCA;
-		std::vector<Unsigned> stridesABCB;
-    std::vector<Unsigned> stridesABCC;
+    std::vector<Offset> stridesABCA;
+		std::vector<Offset> stridesABCB;
+    std::vector<Offset> stridesABCC;
 };
 
 struct ZAxpByData{
     ObjShape loopShape;
-    std::vector<Unsigned> src1Strides;
-    std::vector<Unsigned> src2Strides;
-    std::vector<Unsigned> dstStrides;
+    std::vector<Offset> src1Strides;
+    std::vector<Offset> src2Strides;
+    std::vector<Offset> dstStrides;
 };
 
 struct ZAxpBypPxData{
     ObjShape loopShape;
-    std::vector<Unsigned> src1Strides;
-    std::vector<Unsigned> src2Strides;
-    std::vector<Unsigned> permSrcStrides;
-    std::vector<Unsigned> dstStrides;
+    std::vector<Offset> src1Strides;
+    std::vector<Offset> src2Strides;
+    std::vector<Offset> permSrcStrides;
+    std::vector<Offset> dstStrides;
+};
+
+struct ExprData{
+    ObjShape loopShape;
+    std::vector<std::vector<Offset> > srcStrides;
+    std::vector<Offset> dstStrides;
 };
 }
 
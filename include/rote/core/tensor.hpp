@@ -23,7 +23,7 @@ public:
     // Assertions
     //
 
-    void AssertValidDimensions( const ObjShape& shape, const std::vector<Unsigned>& strides ) const;
+    void AssertValidDimensions( const ObjShape& shape, const std::vector<Offset>& strides ) const;
     void AssertValidEntry( const Location& loc ) const;
     void AssertMergeableModes( const std::vector<ModeArray>& oldModes ) const;
 
@@ -34,17 +34,17 @@ public:
     Tensor( bool fixed=false );
     Tensor( const Unsigned order, bool fixed = false);
     Tensor( const ObjShape& shape, bool fixed=false );
-    Tensor( const ObjShape& shape, const std::vector<Unsigned>& strides, bool fixed=false );
+    Tensor( const ObjShape& shape, const std::vector<Offset>& strides, bool fixed=false );
     Tensor
-    ( const ObjShape& shape, const T* buffer, const std::vector<Unsigned>& strides, bool fixed=false );
-    Tensor( const ObjShape& shape, T* buffer, const std::vector<Unsigned>& strides, bool fixed=false );
+    ( const ObjShape& shape, const T* buffer, const std::vector<Offset>& strides, bool fixed=false );
+    Tensor( const ObjShape& shape, T* buffer, const std::vector<Offset>& strides, bool fixed=false );
     Tensor( const Tensor<T>& A );
 
-    // Move constructor
-    //Tensor( Tensor<T>&& A );
+    // Move constructor; views stay views of the same buffer
+    Tensor( Tensor<T>&& A );
 
-    // Move assignment
-    //Tensor<T>& operator=( Tensor<T>&& A );
+    // Move assignment; falls back to copying when either side is a view
+    Tensor<T>& operator=( Tensor<T>&& A );
 
     // Swap
     void Swap( Tensor<T>& A );
@@ -63,10 +63,34 @@ public:
     ObjShape Shape() const;
     Unsigned Dimension(Mode mode) const;
 
-    std::vector<Unsigned> Strides() const;
-    Unsigned Stride(Mode mode) const;
-
-    Unsigned MemorySize() const;
+    std::vector<Offset> Strides() const;
+    Offset Stride(Mode mode) const;
+
+    Offset MemorySize() const;
+
+    // Policy for this tensor's storage (alignment, huge pages, NUMA
+    // placement); owned entries are moved to storage following it
+    void SetAllocationPolicy( const AllocationPolicy& policy );
+    AllocationPolicy GetAllocationPolicy() const;
+
+    // Back the owned entries with a scratch file in dir (the default
+    // scratch directory if empty), or bring them back into memory (see
+    // out_of_core.hpp).  OutOfCore also holds for views of such storage.
+    void SetOutOfCore( const std::string& dir="" );
+    void SetInCore();
+    bool OutOfCore() const;
+    // Paging hints for the entries spanned by this tensor (or view); no-ops
+    // unless it is out of core
+    void Prefetch() const;
+    void Evict() const;
+
+    // Keep one copy of the owned entries for all processes of comm, or
+    // private entries again for MPI_COMM_NULL (see Memory::SetNodeShared).
+    // Only the NodeLeader writes shared entries; NodeSync publishes them.
+    void SetNodeShared( mpi::Comm comm );
+    bool NodeShared() const;
+    bool NodeLeader() const;
+    void NodeSync() const;
 
     T* Buffer();
     T* Buffer( const Location& loc );
@@ -135,9 +159,9 @@ public:
     bool Viewing()     const;
     bool Locked()      const;
 
-    void Attach( const ObjShape& shape, T* buffer, const std::vector<Unsigned>& strides );
+    void Attach( const ObjShape& shape, T* buffer, const std::vector<Offset>& strides );
     void LockedAttach
-    ( const ObjShape& shape, const T* buffer, const std::vector<Unsigned>& strides );
+    ( const ObjShape& shape, const T* buffer, const std::vector<Offset>& strides );
 
     // Use this memory *as if it were not a view*, but do not take control of
     // its deallocation. If Resize() forces reallocation, this buffer is
@@ -150,16 +174,20 @@ public:
 
     const Tensor<T>& operator=( const Tensor<T>& A );
 
+    // Evaluate an elementwise expression (see btas-like/level1/Expr.hpp)
+    template<typename E>
+    Tensor<T>& operator=( const ExprBase<T, E>& expr );
+
     void Empty();
     void ResizeTo( const ObjShape& shape );
-    void ResizeTo( const ObjShape& shape, const std::vector<Unsigned>& strides );
+    void ResizeTo( const ObjShape& shape, const std::vector<Offset>& strides );
 
     void CopyBuffer(const Tensor& A);
     void CopyBuffer(const Tensor& A, const Permutation& srcPerm, const Permutation& dstPerm);
 
 private:
     ObjShape shape_;
-    std::vector<Unsigned> strides_;
+    std::vector<Offset> strides_;
 
     ViewType viewType_;
 
@@ -175,10 +203,10 @@ private:
     void Empty_();
     void ResizeTo( const Tensor<T>& A);
     void ResizeTo_( const ObjShape& shape );
-    void ResizeTo_( const ObjShape& shape, const std::vector<Unsigned>& strides );
-    void Control_( const ObjShape& shape, T* buffer, const std::vector<Unsigned>& strides );
-    void Attach_( const ObjShape& shape, T* buffer, const std::vector<Unsigned>& strides );
-    void LockedAttach_( const ObjShape& shape, const T* buffer, const std::vector<Unsigned>& strides );
+    void ResizeTo_( const ObjShape& shape, const std::vector<Offset>& strides );
+    void Control_( const ObjShape& shape, T* buffer, const std::vector<Offset>& strides );
+    void Attach_( const ObjShape& shape, T* buffer, const std::vector<Offset>& strides );
+    void LockedAttach_( const ObjShape& shape, const T* buffer, const std::vector<Offset>& strides );
 
     template <typename F>
     friend class Tensor;
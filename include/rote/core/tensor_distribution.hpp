@@ -31,6 +31,12 @@ public:
     ModeDistribution UnusedModes() const;
     ModeDistribution UsedModes() const;
 
+    // Block sizes of the tensor modes (see ModeDistribution::BlockSize)
+    std::vector<Unsigned> BlockSizes() const;
+    bool IsBlockCyclic() const;
+    // Same distribution with element-cyclic wrapping in every mode
+    TensorDistribution ElementCyclic() const;
+
     TensorDistribution& operator=(const TensorDistribution& rhs);
     TensorDistribution& operator+=(const TensorDistribution& rhs);
     TensorDistribution& operator-=(const TensorDistribution& rhs);
@@ -120,7 +120,11 @@ class Timer
 
         static Timer& timer(const std::string& name);
 
-        void start() { tic(); }
+        void start()
+        {
+            rote::PushMemorySection(name);
+            tic();
+        }
 
         void stop()
         {
@@ -137,6 +141,7 @@ class Timer
                 interval += toc();
                 count++;
   //          }
+            rote::PopMemorySection();
         }
 
         static void printTimers();
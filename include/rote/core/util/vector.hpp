@@ -18,6 +18,9 @@ T sum(const std::vector<T>& a);
 template<typename T>
 T prod(const std::vector<T>& a, const Unsigned startIndex = 0);
 
+// Number of elements in a shape (accumulated as an Offset)
+Offset prod(const ObjShape& shape, const Unsigned startIndex = 0);
+
 template<typename T>
 std::vector<T> ElemwiseSum(const std::vector<T>& src1, const std::vector<T>& src2);
 
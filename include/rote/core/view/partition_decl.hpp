@@ -15,6 +15,7 @@ namespace rote {
 // To make our life easier. Undef'd at the bottom of the header
 #define TEN  Tensor<T>
 #define DTEN DistTensor<T>
+#define DVIEW DistTensorView<T>
 
 //
 // PartitionUp
@@ -30,6 +31,11 @@ void PartitionUp
 ( DTEN& A, DTEN& AT,
            DTEN& AB, Mode mode, Unsigned dimensionAB=Blocksize() );
 
+template<typename T>
+void PartitionUp
+( const DVIEW& A, DVIEW& AT,
+           DVIEW& AB, Mode mode, Unsigned dimensionAB=Blocksize() );
+
 template<typename T>
 void LockedPartitionUp
 ( const TEN& A, TEN& AT,
@@ -40,6 +46,11 @@ void LockedPartitionUp
 ( const DTEN& A, DTEN& AT,
                  DTEN& AB, Mode mode, Unsigned dimensionAB=Blocksize() );
 
+template<typename T>
+void LockedPartitionUp
+( const DVIEW& A, DVIEW& AT,
+                 DVIEW& AB, Mode mode, Unsigned dimensionAB=Blocksize() );
+
 //
 // PartitionDown
 //
@@ -54,6 +65,11 @@ void PartitionDown
 ( DTEN& A, DTEN& AT,
            DTEN& AB, Mode mode, Unsigned dimensionAT=Blocksize() );
 
+template<typename T>
+void PartitionDown
+( const DVIEW& A, DVIEW& AT,
+           DVIEW& AB, Mode mode, Unsigned dimensionAT=Blocksize() );
+
 template<typename T>
 void LockedPartitionDown
 ( const TEN& A, TEN& AT,
@@ -64,6 +80,33 @@ void LockedPartitionDown
 ( const DTEN& A, DTEN& AT,
                  DTEN& AB, Mode mode, Unsigned dimensionAT=Blocksize() );
 
+template<typename T>
+void LockedPartitionDown
+( const DVIEW& A, DVIEW& AT,
+                 DVIEW& AB, Mode mode, Unsigned dimensionAT=Blocksize() );
+
+// Start partitioning a DistTensor into lightweight views
+template<typename T>
+void PartitionUp
+( DTEN& A, DVIEW& AT,
+           DVIEW& AB, Mode mode, Unsigned dimensionAB=Blocksize() );
+
+template<typename T>
+void LockedPartitionUp
+( const DTEN& A, DVIEW& AT,
+                 DVIEW& AB, Mode mode, Unsigned dimensionAB=Blocksize() );
+
+template<typename T>
+void PartitionDown
+( DTEN& A, DVIEW& AT,
+           DVIEW& AB, Mode mode, Unsigned dimensionAT=Blocksize() );
+
+template<typename T>
+void LockedPartitionDown
+( const DTEN& A, DVIEW& AT,
+                 DVIEW& AB, Mode mode, Unsigned dimensionAT=Blocksize() );
+
+#undef DVIEW
 #undef DTEN
 #undef TEN
 
@@ -15,6 +15,7 @@ namespace rote {
 // To make our life easier. Undef'd at the bottom of the header
 #define TEN  Tensor<T>
 #define DTEN DistTensor<T>
+#define DVIEW DistTensorView<T>
 
 //
 // PartitionUp
@@ -38,6 +39,15 @@ PartitionUp
     PartitionDown( A, AT, AB, A.Dimension(mode)-dimensionAB );
 }
 
+template<typename T>
+inline void
+PartitionUp
+( const DVIEW& A, DVIEW& AT,
+         DVIEW& AB, Mode mode, Unsigned dimensionAB )
+{
+    PartitionDown( A, AT, AB, mode, A.Dimension(mode)-dimensionAB );
+}
+
 template<typename T>
 inline void
 LockedPartitionUp
@@ -56,6 +66,15 @@ LockedPartitionUp
     LockedPartitionDown( A, AT, AB, A.Dimension(mode)-dimensionAB );
 }
 
+template<typename T>
+inline void
+LockedPartitionUp
+( const DVIEW& A, DVIEW& AT,
+               DVIEW& AB, Mode mode, Unsigned dimensionAB )
+{
+    LockedPartitionDown( A, AT, AB, mode, A.Dimension(mode)-dimensionAB );
+}
+
 //
 // PartitionDown
 //
@@ -102,6 +121,27 @@ PartitionDown
     View( AB, A, viewLoc, viewShape );
 }
 
+template<typename T>
+inline void
+PartitionDown
+( const DVIEW& A, DVIEW& AT,
+         DVIEW& AB, Mode mode, Unsigned dimensionAT )
+{
+    ObjShape viewShape = A.Shape();
+    Location viewLoc(A.Order());
+
+    dimensionAT = Max(Min(dimensionAT,A.Dimension(mode)),0);
+    const Unsigned dimensionAB = A.Dimension(mode) - dimensionAT;
+
+    viewShape[mode] = dimensionAT;
+    std::fill(viewLoc.begin(), viewLoc.end(), 0);
+    View( AT, A, viewLoc, viewShape );
+
+    viewLoc[mode] = dimensionAT;
+    viewShape[mode] = dimensionAB;
+    View( AB, A, viewLoc, viewShape );
+}
+
 template<typename T>
 inline void
 LockedPartitionDown
@@ -144,6 +184,60 @@ LockedPartitionDown
     LockedView( AB, A, viewLoc, viewShape );
 }
 
+template<typename T>
+inline void
+LockedPartitionDown
+( const DVIEW& A, DVIEW& AT,
+               DVIEW& AB, Mode mode, Unsigned dimensionAT )
+{
+    ObjShape viewShape = A.Shape();
+    Location viewLoc(A.Order());
+
+    dimensionAT = Max(Min(dimensionAT,A.Dimension(mode)),0);
+    const Unsigned dimensionAB = A.Dimension(mode)-dimensionAT;
+
+    viewShape[mode] = dimensionAT;
+    std::fill(viewLoc.begin(), viewLoc.end(), 0);
+    LockedView( AT, A, viewLoc, viewShape );
+
+    viewLoc[mode] = dimensionAT;
+    viewShape[mode] = dimensionAB;
+    LockedView( AB, A, viewLoc, viewShape );
+}
+
+//
+// Partitioning a DistTensor into lightweight views
+//
+
+template<typename T>
+inline void
+PartitionUp
+( DTEN& A, DVIEW& AT,
+           DVIEW& AB, Mode mode, Unsigned dimensionAB )
+{ PartitionUp( DVIEW(A), AT, AB, mode, dimensionAB ); }
+
+template<typename T>
+inline void
+LockedPartitionUp
+( const DTEN& A, DVIEW& AT,
+                 DVIEW& AB, Mode mode, Unsigned dimensionAB )
+{ LockedPartitionUp( DVIEW(A), AT, AB, mode, dimensionAB ); }
+
+template<typename T>
+inline void
+PartitionDown
+( DTEN& A, DVIEW& AT,
+           DVIEW& AB, Mode mode, Unsigned dimensionAT )
+{ PartitionDown( DVIEW(A), AT, AB, mode, dimensionAT ); }
+
+template<typename T>
+inline void
+LockedPartitionDown
+( const DTEN& A, DVIEW& AT,
+                 DVIEW& AB, Mode mode, Unsigned dimensionAT )
+{ LockedPartitionDown( DVIEW(A), AT, AB, mode, dimensionAT ); }
+
+#undef DVIEW
 #undef DTEN
 #undef TEN
 
@@ -15,6 +15,7 @@ namespace rote {
 // To make our life easier. Undef'd at the bottom of the header
 #define TEN  Tensor<T>
 #define DTEN DistTensor<T>
+#define DVIEW DistTensorView<T>
 
 //
 // RepartitionUp
@@ -32,6 +33,12 @@ void RepartitionUp
           DTEN& A1,
   DTEN& AB, DTEN& A2, Mode mode, Unsigned bsize=Blocksize() );
 
+template<typename T>
+void RepartitionUp
+( DVIEW& AT, DVIEW& A0,
+          DVIEW& A1,
+  DVIEW& AB, DVIEW& A2, Mode mode, Unsigned bsize=Blocksize() );
+
 template<typename T>
 void LockedRepartitionUp
 ( const TEN& AT, TEN& A0,
@@ -44,6 +51,12 @@ void LockedRepartitionUp
                 DTEN& A1,
   const DTEN& AB, DTEN& A2, Mode mode, Unsigned bsize=Blocksize() );
 
+template<typename T>
+void LockedRepartitionUp
+( const DVIEW& AT, DVIEW& A0,
+                DVIEW& A1,
+  const DVIEW& AB, DVIEW& A2, Mode mode, Unsigned bsize=Blocksize() );
+
 //
 // RepartitionDown
 //
@@ -60,6 +73,12 @@ void RepartitionDown
           DTEN& A1,
   DTEN& AB, DTEN& A2, Mode mode, Unsigned bsize=Blocksize() );
 
+template<typename T>
+void RepartitionDown
+( DVIEW& AT, DVIEW& A0,
+          DVIEW& A1,
+  DVIEW& AB, DVIEW& A2, Mode mode, Unsigned bsize=Blocksize() );
+
 template<typename T>
 void LockedRepartitionDown
 ( const TEN& AT, TEN& A0,
@@ -72,6 +91,13 @@ void LockedRepartitionDown
                 DTEN& A1,
   const DTEN& AB, DTEN& A2, Mode mode, Unsigned bsize=Blocksize() );
 
+template<typename T>
+void LockedRepartitionDown
+( const DVIEW& AT, DVIEW& A0,
+                DVIEW& A1,
+  const DVIEW& AB, DVIEW& A2, Mode mode, Unsigned bsize=Blocksize() );
+
+#undef DVIEW
 #undef DTEN
 #undef TEN
 
@@ -15,6 +15,7 @@ namespace rote {
 // To make our life easier. Undef'd at the bottom of the header
 #define TEN  Tensor<T>
 #define DTEN DistTensor<T>
+#define DVIEW DistTensorView<T>
 
 //
 // RepartitionUp
@@ -42,6 +43,17 @@ RepartitionUp
     View( A2, AB );
 }
 
+template<typename T>
+inline void
+RepartitionUp
+( DVIEW& AT, DVIEW& A0,
+          DVIEW& A1,
+  DVIEW& AB, DVIEW& A2, Mode mode, Unsigned A1Dimension )
+{
+    PartitionUp( AT, A0, A1, mode, A1Dimension );
+    View( A2, AB );
+}
+
 template<typename T>
 inline void
 LockedRepartitionUp
@@ -64,6 +76,17 @@ LockedRepartitionUp
     LockedView( A2, AB );
 }
 
+template<typename T>
+inline void
+LockedRepartitionUp
+( const DVIEW& AT, DVIEW& A0,
+                DVIEW& A1,
+  const DVIEW& AB, DVIEW& A2, Mode mode, Unsigned A1Dimension )
+{
+    LockedPartitionUp( AT, A0, A1, mode, A1Dimension );
+    LockedView( A2, AB );
+}
+
 //
 // RepartitionDown
 //
@@ -90,6 +113,17 @@ RepartitionDown
     PartitionDown( AB, A1, A2, mode, A1Dimension );
 }
 
+template<typename T>
+inline void
+RepartitionDown
+( DVIEW& AT, DVIEW& A0,
+          DVIEW& A1,
+  DVIEW& AB, DVIEW& A2, Mode mode, Unsigned A1Dimension )
+{
+    View( A0, AT );
+    PartitionDown( AB, A1, A2, mode, A1Dimension );
+}
+
 template<typename T>
 inline void
 LockedRepartitionDown
@@ -112,6 +146,18 @@ LockedRepartitionDown
     LockedPartitionDown( AB, A1, A2, mode, A1Dimension );
 }
 
+template<typename T>
+inline void
+LockedRepartitionDown
+( const DVIEW& AT, DVIEW& A0,
+                DVIEW& A1,
+  const DVIEW& AB, DVIEW& A2, Mode mode, Unsigned A1Dimension )
+{
+    LockedView( A0, AT );
+    LockedPartitionDown( AB, A1, A2, mode, A1Dimension );
+}
+
+#undef DVIEW
 #undef DTEN
 #undef TEN
 
@@ -15,6 +15,7 @@ namespace rote {
 // To make our life easier. Undef'd at the bottom of the header
 #define TEN  Tensor<T>
 #define DTEN DistTensor<T>
+#define DVIEW DistTensorView<T>
 
 //
 // SlidePartitionUp
@@ -32,6 +33,12 @@ void SlidePartitionUp
           DTEN& A1,
   DTEN& AB, DTEN& A2, Mode mode );
 
+template<typename T>
+void SlidePartitionUp
+( DVIEW& AT, DVIEW& A0,
+          DVIEW& A1,
+  DVIEW& AB, DVIEW& A2, Mode mode );
+
 template<typename T>
 void SlideLockedPartitionUp
 ( TEN& AT, const TEN& A0,
@@ -44,6 +51,12 @@ void SlideLockedPartitionUp
           const DTEN& A1,
   DTEN& AB, const DTEN& A2, Mode mode );
 
+template<typename T>
+void SlideLockedPartitionUp
+( DVIEW& AT, const DVIEW& A0,
+          const DVIEW& A1,
+  DVIEW& AB, const DVIEW& A2, Mode mode );
+
 //
 // SlidePartitionDown
 //
@@ -60,6 +73,12 @@ void SlidePartitionDown
           DTEN& A1,
   DTEN& AB, DTEN& A2, Mode mode );
 
+template<typename T>
+void SlidePartitionDown
+( DVIEW& AT, DVIEW& A0,
+          DVIEW& A1,
+  DVIEW& AB, DVIEW& A2, Mode mode );
+
 template<typename T>
 void SlideLockedPartitionDown
 ( TEN& AT, const TEN& A0,
@@ -72,6 +91,13 @@ void SlideLockedPartitionDown
           const DTEN& A1,
   DTEN& AB, const DTEN& A2, Mode mode );
 
+template<typename T>
+void SlideLockedPartitionDown
+( DVIEW& AT, const DVIEW& A0,
+          const DVIEW& A1,
+  DVIEW& AB, const DVIEW& A2, Mode mode );
+
+#undef DVIEW
 #undef DTEN
 #undef TEN
 
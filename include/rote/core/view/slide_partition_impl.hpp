@@ -15,6 +15,7 @@ namespace rote {
 // To make our life easier. Undef'd at the bottom of the header
 #define TEN  Tensor<T>
 #define DTEN DistTensor<T>
+#define DVIEW DistTensorView<T>
 
 //
 // SlidePartitionUp
@@ -42,6 +43,17 @@ SlidePartitionUp
     View2x1( AB, A1, A2, mode );
 }
 
+template<typename T>
+inline void
+SlidePartitionUp
+( DVIEW& AT, DVIEW& A0,
+          DVIEW& A1,
+  DVIEW& AB, DVIEW& A2, Mode mode )
+{
+    View( AT, A0 );
+    View2x1( AB, A1, A2, mode );
+}
+
 template<typename T>
 inline void
 SlideLockedPartitionUp
@@ -64,6 +76,17 @@ SlideLockedPartitionUp
     LockedView2x1( AB, A1, A2, mode );
 }
 
+template<typename T>
+inline void
+SlideLockedPartitionUp
+( DVIEW& AT, const DVIEW& A0,
+          const DVIEW& A1,
+  DVIEW& AB, const DVIEW& A2, Mode mode )
+{
+    LockedView( AT, A0 );
+    LockedView2x1( AB, A1, A2, mode );
+}
+
 //
 // SlidePartitionDown
 //
@@ -90,6 +113,17 @@ SlidePartitionDown
     View( AB, A2 );
 }
 
+template<typename T>
+inline void
+SlidePartitionDown
+( DVIEW& AT, DVIEW& A0,
+          DVIEW& A1,
+  DVIEW& AB, DVIEW& A2, Mode mode )
+{
+    View2x1( AT, A0, A1, mode );
+    View( AB, A2 );
+}
+
 template<typename T>
 inline void
 SlideLockedPartitionDown
@@ -112,6 +146,18 @@ SlideLockedPartitionDown
     LockedView( AB, A2 );
 }
 
+template<typename T>
+inline void
+SlideLockedPartitionDown
+( DVIEW& AT, const DVIEW& A0,
+          const DVIEW& A1,
+  DVIEW& AB, const DVIEW& A2, Mode mode )
+{
+    LockedView2x1( AT, A0, A1, mode );
+    LockedView( AB, A2 );
+}
+
+#undef DVIEW
 #undef DTEN
 #undef TEN
 
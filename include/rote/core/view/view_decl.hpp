@@ -118,6 +118,49 @@ template<typename T>
 DistTensor<T> LockedView2x1
 ( const DistTensor<T>& BT, const DistTensor<T>& BB, Mode mode );
 
+//
+// Lightweight views of windows of a DistTensor (see DistTensorView)
+//
+
+template<typename T>
+void ViewHelper
+( DistTensorView<T>& A, const DistTensorView<T>& B,
+  const Location& loc, const ObjShape& shape, bool isLocked );
+template<typename T>
+void View2x1Helper
+(       DistTensorView<T>& A,
+  const DistTensorView<T>& BT,
+  const DistTensorView<T>& BB, Mode mode, bool isLocked );
+
+template<typename T>
+void View( DistTensorView<T>& A, const DistTensorView<T>& B );
+template<typename T>
+void LockedView( DistTensorView<T>& A, const DistTensorView<T>& B );
+template<typename T>
+void View
+( DistTensorView<T>& A, const DistTensorView<T>& B,
+  const Location& loc, const ObjShape& shape );
+template<typename T>
+void LockedView
+( DistTensorView<T>& A, const DistTensorView<T>& B,
+  const Location& loc, const ObjShape& shape );
+template<typename T>
+void View2x1
+(       DistTensorView<T>& A,
+  const DistTensorView<T>& BT,
+  const DistTensorView<T>& BB, Mode mode );
+template<typename T>
+void LockedView2x1
+(       DistTensorView<T>& A,
+  const DistTensorView<T>& BT,
+  const DistTensorView<T>& BB, Mode mode );
+
+// Set up a DistTensor viewing the window
+template<typename T>
+void View( DistTensor<T>& A, const DistTensorView<T>& B );
+template<typename T>
+void LockedView( DistTensor<T>& A, const DistTensorView<T>& B );
+
 //
 // View object as lower order object
 //
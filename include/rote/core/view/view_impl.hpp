@@ -119,8 +119,14 @@ inline void ViewHelper
     A.shape_ = shape;
     A.dist_ = B.dist_;
     A.localPerm_ = B.localPerm_;
+    const std::vector<Unsigned> blockSizes = B.dist_.BlockSizes();
+#ifndef RELEASE
+    for(i = 0; i < order; i++)
+        if(loc[i] % blockSizes[i] != 0)
+            LogicError("Views of block-cyclic tensors must start on a block boundary");
+#endif
     for(i = 0; i < order; i++)
-        A.modeAlignments_[i] = (B.ModeAlignment(i) + loc[i]) % modeWrapStrides[i];
+        A.modeAlignments_[i] = (B.ModeAlignment(i) + loc[i] / blockSizes[i]) % modeWrapStrides[i];
 
     if(isLocked)
         A.viewType_ = LOCKED_VIEW;
@@ -293,7 +299,7 @@ inline void ViewAsMatrixHelper
         A.memory_.Empty();
 
         ObjShape shapeB = B.Shape();
-        ObjShape stridesB = B.Strides();
+        std::vector<Offset> stridesB = B.Strides();
 
         //Update the shape, strides_, maps_
         A.shape_.resize(2);
@@ -465,8 +471,9 @@ inline void View
     //Set the data we can't set in helper
     if(A.Participating()){
         const std::vector<Unsigned> modeWrapStrides = B.GridViewShape();
-        const std::vector<Unsigned> localShapeBehind = Lengths(loc, B.ModeShifts(), modeWrapStrides);
-        const std::vector<Unsigned> localShape = Lengths(shape, A.ModeShifts(), modeWrapStrides);
+        const std::vector<Unsigned> blockSizes = B.TensorDist().BlockSizes();
+        const std::vector<Unsigned> localShapeBehind = BlockLengths(loc, B.ModeShifts(), modeWrapStrides, blockSizes);
+        const std::vector<Unsigned> localShape = BlockLengths(shape, A.ModeShifts(), modeWrapStrides, blockSizes);
 
         View( A.Tensor(), B.Tensor(), localShapeBehind, localShape );
     }
@@ -509,8 +516,9 @@ inline void LockedView
     //Set the data we can't set in helper
     if(A.Participating()){
         const std::vector<Unsigned> modeWrapStrides = B.GridViewShape();
-        const std::vector<Unsigned> localShapeBehind = Lengths(loc, B.ModeShifts(), modeWrapStrides);
-        const std::vector<Unsigned> localShape = Lengths(shape, A.ModeShifts(), modeWrapStrides);
+        const std::vector<Unsigned> blockSizes = B.TensorDist().BlockSizes();
+        const std::vector<Unsigned> localShapeBehind = BlockLengths(loc, B.ModeShifts(), modeWrapStrides, blockSizes);
+        const std::vector<Unsigned> localShape = BlockLengths(shape, A.ModeShifts(), modeWrapStrides, blockSizes);
 
         LockedView( A.Tensor(), B.LockedTensor(), localShapeBehind, localShape );
     }
@@ -726,6 +734,102 @@ inline Tensor<T> LockedViewAsMatrix
    return A;
 }
 
+////////////////////////////
+// Lightweight views
+////////////////////////////
+
+template<typename T>
+inline void ViewHelper
+( DistTensorView<T>& A, const DistTensorView<T>& B,
+  const Location& loc, const ObjShape& shape, bool isLocked )
+{
+    const Unsigned order = B.Order();
+#ifndef RELEASE
+    if( loc.size() != order || shape.size() != order )
+        LogicError("View location and shape must match the order of the viewed object");
+    if( AnyElemwiseGreaterThan(ElemwiseSum(loc, shape), B.shape_) )
+        LogicError("Trying to view outside of a DistTensorView");
+    if( !isLocked && B.locked_ )
+        LogicError("Cannot take a mutable view of a locked view");
+#endif
+    // Assign element-wise so that the window reuses its storage
+    A.parent_ = B.parent_;
+    A.locked_ = isLocked;
+    A.offsets_.resize(order);
+    for(Unsigned i = 0; i < order; i++)
+        A.offsets_[i] = B.offsets_[i] + loc[i];
+    A.shape_ = shape;
+}
+
+template<typename T>
+inline void View2x1Helper
+(       DistTensorView<T>& A,
+  const DistTensorView<T>& BT,
+  const DistTensorView<T>& BB, Mode mode, bool isLocked )
+{
+#ifndef RELEASE
+    if( BT.parent_ != BB.parent_ )
+        LogicError("2x1 must view the same tensor to combine");
+    if( BB.offsets_[mode] != BT.offsets_[mode] + BT.shape_[mode] )
+        LogicError("2x1 must be adjacent to combine");
+    if( !isLocked && (BT.locked_ || BB.locked_) )
+        LogicError("Cannot take a mutable view of a locked view");
+#endif
+    A.parent_ = BT.parent_;
+    A.locked_ = isLocked;
+    A.offsets_ = BT.offsets_;
+    A.shape_ = BT.shape_;
+    A.shape_[mode] += BB.shape_[mode];
+}
+
+template<typename T>
+inline void View( DistTensorView<T>& A, const DistTensorView<T>& B )
+{ A = B; }
+
+template<typename T>
+inline void LockedView( DistTensorView<T>& A, const DistTensorView<T>& B )
+{ ViewHelper(A, B, Location(B.Order(), 0), B.Shape(), true); }
+
+template<typename T>
+inline void View
+( DistTensorView<T>& A, const DistTensorView<T>& B,
+  const Location& loc, const ObjShape& shape )
+{ ViewHelper(A, B, loc, shape, false); }
+
+template<typename T>
+inline void LockedView
+( DistTensorView<T>& A, const DistTensorView<T>& B,
+  const Location& loc, const ObjShape& shape )
+{ ViewHelper(A, B, loc, shape, true); }
+
+template<typename T>
+inline void View2x1
+(       DistTensorView<T>& A,
+  const DistTensorView<T>& BT,
+  const DistTensorView<T>& BB, Mode mode )
+{ View2x1Helper(A, BT, BB, mode, false); }
+
+template<typename T>
+inline void LockedView2x1
+(       DistTensorView<T>& A,
+  const DistTensorView<T>& BT,
+  const DistTensorView<T>& BB, Mode mode )
+{ View2x1Helper(A, BT, BB, mode, true); }
+
+template<typename T>
+inline void View( DistTensor<T>& A, const DistTensorView<T>& B )
+{
+#ifndef RELEASE
+    if( B.Locked() )
+        LogicError("Cannot take a mutable view of a locked view");
+#endif
+    View( A, *B.parent_, B.Offsets(), B.Shape() );
+}
+
+template<typename T>
+inline void LockedView( DistTensor<T>& A, const DistTensorView<T>& B )
+{ LockedView( A, B.Parent(), B.Offsets(), B.Shape() ); }
+
 } // namespace rote
 
 #endif // ifndef ROTE_CORE_VIEW_IMPL_HPP
@@ -0,0 +1,144 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ROTE_CORE_WORKSPACE_HPP
+#define ROTE_CORE_WORKSPACE_HPP
+
+namespace rote {
+
+// Bump allocator for the short-lived intermediates of an operation.
+// While a WorkspaceScope has made a workspace current on this thread, every
+// Memory<G> constructed inside the innermost WorkspaceMark carves its
+// storage out of the workspace instead of the memory pool; when the mark
+// is destroyed everything carved out since it was opened is reclaimed at
+// once.  Requests that do not fit fall back to the pool, and the workspace
+// grows to its high-water mark the next time it is completely unwound, so
+// a loop that opens a mark per iteration does no heap traffic after its
+// first pass.  A block moved out of its mark keeps its storage: the mark
+// then does not rewind past it, and a workspace destroyed while such blocks
+// are alive leaves its buffer to them.  Workspaces are not shared between
+// threads.
+class Workspace
+{
+public:
+    explicit Workspace( std::size_t bytes=0 );
+    ~Workspace();
+
+    // Only grows the block while nothing is carved out of it
+    void Reserve( std::size_t bytes );
+
+    std::size_t Capacity() const;
+    std::size_t BytesInUse() const;
+    // Largest amount that would have been in use had everything fit
+    std::size_t HighWater() const;
+    // Requests that had to go to the memory pool
+    std::size_t NumMisses() const;
+
+    // The state Memory objects carve their blocks from; it lives on until
+    // the last of them is gone
+    const std::shared_ptr<WorkspaceArena>& Arena() const;
+
+private:
+    std::shared_ptr<WorkspaceArena> arena_;
+
+    friend class WorkspaceMark;
+
+    Workspace( const Workspace& );
+    Workspace& operator=( const Workspace& );
+};
+
+class WorkspaceArena
+{
+public:
+    explicit WorkspaceArena( std::size_t bytes );
+    ~WorkspaceArena();
+
+    void Reserve( std::size_t bytes );
+
+    std::size_t Capacity() const;
+    std::size_t BytesInUse() const;
+    std::size_t HighWater() const;
+    std::size_t NumMisses() const;
+
+    // Carves out of the innermost mark; returns 0 when the request does
+    // not fit.  Blocks are given back with the mark they were carved in.
+    void* Allocate( std::size_t bytes, std::size_t alignment );
+    void Deallocate( void* ptr, std::size_t bytes, std::size_t mark );
+
+    // Serial number of the innermost open mark (0 if none)
+    std::size_t CurrentMark() const;
+
+    void OpenMark();
+    void CloseMark();
+    // The owning Workspace is gone: nothing more is carved out, and the
+    // buffer is freed once no block is left in it
+    void Close();
+
+private:
+    struct Frame
+    {
+        std::size_t offset;
+        std::size_t serial;
+        std::size_t numLive;
+        // Closed inner marks whose surviving blocks count in numLive
+        std::vector<std::size_t> retired;
+
+        bool Holds( std::size_t mark ) const;
+    };
+
+    char* buffer_;
+    AllocationPolicy policy_;
+    std::size_t capacity_, offset_, highWater_, numMisses_, lastSerial_;
+    std::vector<Frame> frames_;
+    // Blocks that outlived the outermost mark; nothing below offset_ is
+    // reused until they are all released
+    Frame unwound_;
+    bool closed_;
+
+    void Free();
+
+    WorkspaceArena( const WorkspaceArena& );
+    WorkspaceArena& operator=( const WorkspaceArena& );
+};
+
+// Makes a workspace current on this thread for the lifetime of the scope
+class WorkspaceScope
+{
+public:
+    explicit WorkspaceScope( Workspace& workspace );
+    ~WorkspaceScope();
+private:
+    Workspace* previous_;
+
+    WorkspaceScope( const WorkspaceScope& );
+    WorkspaceScope& operator=( const WorkspaceScope& );
+};
+
+// Everything carved out of the current workspace while the mark is alive
+// is reclaimed when it is destroyed.  A no-op without a current workspace.
+class WorkspaceMark
+{
+public:
+    WorkspaceMark();
+    ~WorkspaceMark();
+private:
+    Workspace* workspace_;
+
+    WorkspaceMark( const WorkspaceMark& );
+    WorkspaceMark& operator=( const WorkspaceMark& );
+};
+
+// Workspace made current by the innermost live WorkspaceScope, if any
+Workspace* CurrentWorkspace();
+// Its arena, or null
+std::shared_ptr<WorkspaceArena> CurrentWorkspaceArena();
+
+} // namespace rote
+
+#endif // ifndef ROTE_CORE_WORKSPACE_HPP
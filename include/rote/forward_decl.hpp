@@ -30,12 +30,21 @@ class TensorDistribution;
 
 class Permutation;
 
+class Workspace;
+class WorkspaceArena;
+
 template<typename T>
 class Memory;
 
 template<typename T>
 class Tensor;
 
+template<typename T>
+class DistTensorView;
+
+template<typename T, typename E>
+class ExprBase;
+
 } // namespace rote
 
 #endif // ifndef ROTE_FORWARD_DECL_HPP
@@ -16,6 +16,9 @@
 // New
 #include "io/write.hpp"
 #include "io/print.hpp"
+#include "io/ascii.hpp"
 #include "io/read.hpp"
+#include "io/file_view.hpp"
+#include "io/checkpoint.hpp"
 
 #endif // ifndef ROTE_IO_HPP
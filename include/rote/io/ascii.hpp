@@ -0,0 +1,64 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ROTE_IO_ASCII_HPP
+#define ROTE_IO_ASCII_HPP
+
+namespace rote {
+
+#define ASCII_CHUNK_BYTES (1 << 24)
+
+  // Parses the whitespace-separated entries in [begin,end), appending them
+  // to values; the range is split at whitespace and parsed across threads.
+  // Complex entries are re or (re,im), as std::istream reads them.
+  template<typename T>
+  void ParseAscii( const char* begin, const char* end, std::vector<T>& values );
+
+  // Streams the entries of the data line of an ASCII tensor file, parsing
+  // ASCII_CHUNK_BYTES of text at a time with ParseAscii
+  template<typename T>
+  class AsciiReader
+  {
+  public:
+      // file must be positioned at the start of the data line, or of an
+      // entry in it; at most maxBytes of text are read
+      AsciiReader( std::istream& file, Offset maxBytes=~Offset(0) );
+
+      T Next()
+      {
+          if( pos_ == values_.size() )
+              Refill();
+          return values_[pos_++];
+      }
+
+      // Skips n entries without copying them out
+      void Skip( Offset n );
+
+      // Appends every remaining entry to values
+      void ReadAll( std::vector<T>& values );
+
+      // Whether the text read so far reached the end of the data line
+      bool SawNewline() const { return sawNewline_; }
+
+  private:
+      void Refill();
+      bool ReadChunk();
+
+      std::istream& file_;
+      std::vector<char> text_;
+      std::vector<T> values_;
+      Offset pos_;
+      Offset bytesLeft_;
+      bool lineDone_;
+      bool sawNewline_;
+  };
+
+} // namespace rote
+
+#endif // ifndef ROTE_IO_ASCII_HPP
@@ -0,0 +1,34 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ROTE_IO_CHECKPOINT_HPP
+#define ROTE_IO_CHECKPOINT_HPP
+
+namespace rote {
+
+  // Saves A as prefix.meta, recording its shape, distribution, alignments,
+  // local permutation and grid shape, plus one shard prefix.<rank> of raw
+  // local entries per distinct piece; replicated copies are written once.
+  // Collective over A's grid.
+  template<typename T>
+  void Checkpoint( const DistTensor<T>& A, const std::string& prefix );
+
+  // Loads a checkpoint into A, keeping A's distribution.  On the grid shape
+  // it was written from, every process reads its own shard; with the same
+  // distribution A also takes over the saved alignments and permutation and
+  // nothing is communicated, otherwise the shards are read into a copy and
+  // redistributed with RedistFrom.  On another grid every process reads the
+  // entries it owns straight out of the shards that hold them, which needs
+  // an element-cyclic checkpoint.  Collective over A's grid.
+  template<typename T>
+  void Restart( DistTensor<T>& A, const std::string& prefix );
+
+} // namespace rote
+
+#endif // ifndef ROTE_IO_CHECKPOINT_HPP
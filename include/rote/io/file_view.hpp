@@ -0,0 +1,34 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ROTE_IO_FILE_VIEW_HPP
+#define ROTE_IO_FILE_VIEW_HPP
+
+namespace rote {
+
+  // A committed datatype of counts[i] items strideBytes[i] apart for every
+  // mode i, mode 0 innermost, each item one entry; free with mpi::TypeFree
+  mpi::Datatype StridedType
+  ( const std::vector<Unsigned>& counts, const std::vector<Offset>& strideBytes,
+    mpi::Datatype entry );
+
+  // Collective MPI-IO transfers between A and a file holding the whole
+  // tensor column-major (mode 0 fastest) from byte offset disp on.  Every
+  // process of A's grid must call these; each sets a file view picking out
+  // the entries it owns, so all of them move their local data at once.
+  // Only one copy of a replicated tensor is written.  A must be
+  // element-cyclic.
+  template<typename T>
+  void ReadFileView( DistTensor<T>& A, mpi::File fh, Offset disp );
+  template<typename T>
+  void WriteFileView( const DistTensor<T>& A, mpi::File fh, Offset disp );
+
+} // namespace rote
+
+#endif // ifndef ROTE_IO_FILE_VIEW_HPP
@@ -39,7 +39,7 @@ PrintData
 template<typename T>
 void
 PrintArray
-( const T* dataBuf, const ObjShape& shape, const ObjShape strides, std::string title="");
+( const T* dataBuf, const ObjShape& shape, const std::vector<Offset> strides, std::string title="");
 
 template<typename T>
 void
@@ -14,11 +14,20 @@ namespace rote {
   std::ifstream::pos_type FileSize( std::ifstream& file );
   FileFormat DetectFormat( const std::string filename );
 
+  // BINARY and BINARY_FLAT files are read collectively with MPI-IO;
+  // sequential picks between the readers for ASCII files
   template<typename T>
   void Read
   ( DistTensor<T>& A, const std::string filename, FileFormat format,
     bool sequential );
 
+  // Maps a BINARY or BINARY_FLAT file read-only on every process, which
+  // copies its own entries straight out of the mapping without any MPI
+  // traffic; meant for files in node-local storage or the page cache
+  template<typename T>
+  void ReadMapped
+  ( DistTensor<T>& A, const std::string filename, FileFormat format );
+
 } // namespace rote
 
 #endif // ifndef ROTE_IO_READ_HPP
@@ -20,6 +20,16 @@ namespace rote {
   Write
   ( const DistTensor<T>& A, std::string title="",
     std::string filename="DistTensor" );
+
+  // Writes A as a BINARY or BINARY_FLAT file, in the layout Read expects,
+  // with every process writing its own entries through collective MPI-IO.
+  // A nonzero numAggregators asks the MPI-IO layer to funnel the writes
+  // through that many processes (the cb_nodes hint).
+  template<typename T>
+  void
+  Write
+  ( const DistTensor<T>& A, const std::string filename, FileFormat format,
+    Unsigned numAggregators=0 );
 } // namespace rote
 
 #endif // ifndef ROTE_IO_WRITE_HPP
@@ -18,6 +18,10 @@ typedef unsigned char byte;
 // existing MPI datatypes. This is only sometimes true for 'long long'
 typedef int Int;
 typedef unsigned Unsigned;
+// Element counts, strides and buffer offsets.  Mode counts, per-mode
+// dimensions and indices stay Unsigned; anything that can reach the number
+// of elements in a (local or global) tensor must be an Offset
+typedef unsigned long long Offset;
 
 typedef char Index;
 typedef Unsigned Mode;
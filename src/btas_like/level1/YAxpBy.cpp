@@ -13,10 +13,10 @@ template<typename T>
 inline void
 YAxpBy_fast(T alpha, T beta, T const * const srcBuf, T * const dstBuf, const YAxpByData& data ){
   const std::vector<Unsigned> loopEnd = data.loopShape;
-  const std::vector<Unsigned> srcBufStrides = data.srcStrides;
-  const std::vector<Unsigned> dstBufStrides = data.dstStrides;
-  Unsigned srcBufPtr = 0;
-  Unsigned dstBufPtr = 0;
+  const std::vector<Offset> srcBufStrides = data.srcStrides;
+  const std::vector<Offset> dstBufStrides = data.dstStrides;
+  Offset srcBufPtr = 0;
+  Offset dstBufPtr = 0;
   Unsigned order = loopEnd.size();
   Location curLoc(order, 0);
   Unsigned ptr = 0;
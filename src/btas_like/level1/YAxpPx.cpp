@@ -14,12 +14,12 @@ template<typename T>
 void
 YAxpPx_fast(T alpha, T beta, T const * const srcBuf, T const * const permSrcBuf, T * const dstBuf, const YAxpPxData& data ){
     const std::vector<Unsigned> loopEnd = data.loopShape;
-    const std::vector<Unsigned> srcBufStrides = data.srcStrides;
-    const std::vector<Unsigned> permBufStrides = data.permSrcStrides;
-    const std::vector<Unsigned> dstBufStrides = data.dstStrides;
-    Unsigned srcBufPtr = 0;
-    Unsigned permBufPtr = 0;
-    Unsigned dstBufPtr = 0;
+    const std::vector<Offset> srcBufStrides = data.srcStrides;
+    const std::vector<Offset> permBufStrides = data.permSrcStrides;
+    const std::vector<Offset> dstBufStrides = data.dstStrides;
+    Offset srcBufPtr = 0;
+    Offset permBufPtr = 0;
+    Offset dstBufPtr = 0;
     Unsigned order = loopEnd.size();
     Location curLoc(order, 0);
     Unsigned ptr = 0;
@@ -14,14 +14,14 @@ template<typename T>
 inline void
 ZAxpBypPx_fast(T alpha, T beta, T const * const src1Buf, T const * const src2Buf,  T const * const permSrcBuf, T * const dstBuf, const ZAxpBypPxData& data ){
     const std::vector<Unsigned> loopEnd = data.loopShape;
-    const std::vector<Unsigned> src1BufStrides = data.src1Strides;
-    const std::vector<Unsigned> src2BufStrides = data.src2Strides;
-    const std::vector<Unsigned> permSrcBufStrides = data.permSrcStrides;
-    const std::vector<Unsigned> dstBufStrides = data.dstStrides;
-    Unsigned src1BufPtr = 0;
-    Unsigned src2BufPtr = 0;
-    Unsigned permSrcBufPtr = 0;
-    Unsigned dstBufPtr = 0;
+    const std::vector<Offset> src1BufStrides = data.src1Strides;
+    const std::vector<Offset> src2BufStrides = data.src2Strides;
+    const std::vector<Offset> permSrcBufStrides = data.permSrcStrides;
+    const std::vector<Offset> dstBufStrides = data.dstStrides;
+    Offset src1BufPtr = 0;
+    Offset src2BufPtr = 0;
+    Offset permSrcBufPtr = 0;
+    Offset dstBufPtr = 0;
     Unsigned order = loopEnd.size();
     Location curLoc(order, 0);
     Unsigned ptr = 0;
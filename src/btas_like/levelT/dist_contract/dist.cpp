@@ -35,9 +35,9 @@ void Contract<T>::run(
     indC[i] = indicesC[i];
 
   //Determine Stationary variant.
-  const Unsigned numElemA = prod(A.Shape());
-  const Unsigned numElemB = prod(B.Shape());
-  const Unsigned numElemC = prod(C.Shape());
+  const Offset numElemA = prod(A.Shape());
+  const Offset numElemB = prod(B.Shape());
+  const Offset numElemC = prod(C.Shape());
 
   bool isBiggerAB = numElemA > numElemB;
   bool isBiggerAC = numElemA > numElemC;
@@ -102,6 +102,9 @@ void Contract<T>::run(
 	      DistTensor<T>& C, const IndexArray& indicesC,
 	const std::vector<Unsigned>& blkSizes, bool isStatC
 ) {
+  // Everything allocated below is an intermediate of the operation
+  MemoryCategoryScope scope( CONTRACT_MEMORY );
+
   //Determine how to partition
 	BlkContractStatCInfo contractInfo;
 	Contract<T>::setContractInfo(
@@ -112,6 +115,11 @@ void Contract<T>::run(
 		contractInfo
 	);
 
+	// Intermediates of each block are carved out of this and reclaimed
+	// at the block boundary (see the marks in the partition helpers)
+	Workspace workspace(contractInfo.workspaceBytes);
+	WorkspaceScope workspaceScope(workspace);
+
 	if (isStatC) {
 		if(contractInfo.permC != C.LocalPermutation()){
 			DistTensor<T> tmpC(C.TensorDist(), C.Grid());
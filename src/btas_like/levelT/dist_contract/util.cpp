@@ -11,25 +11,100 @@
 
 namespace rote{
 
+namespace {
+
+// Bytes a rank holds of a tensor of the given shape distributed as dist
+template<typename T>
+Offset LocalBytes
+( const ObjShape& shape, const TensorDistribution& dist, const Grid& g )
+{
+    Offset nElem = 1;
+    for( Unsigned i = 0; i < shape.size(); i++ ){
+        Unsigned wrap = 1;
+        for( Unsigned j = 0; j < dist[i].size(); j++ )
+            wrap *= g.Dimension(dist[i][j]);
+        nElem *= MaxBlockLength(shape[i], wrap, dist[i].BlockSize());
+    }
+    return nElem * sizeof(T);
+}
+
+// Shape with the given modes cut down to blocks of the given sizes
+ObjShape BlockedShape
+( const ObjShape& shape, const ModeArray& partModes,
+  const std::vector<Unsigned>& blkSizes )
+{
+    ObjShape blocked = shape;
+    for( Unsigned i = 0; i < partModes.size(); i++ )
+        blocked[partModes[i]] = Min(blocked[partModes[i]], blkSizes[i]);
+    return blocked;
+}
+
+// Bytes a rank holds of the intermediates of the innermost block
+template<typename T>
+Offset IntermediateBytes
+( const ObjShape& shapeA, const ObjShape& shapeB, const ObjShape& shapeT,
+  const BlkContractStatCInfo& info, bool isStatC,
+  const std::vector<Unsigned>& blkSizes, const Grid& g )
+{
+    if( isStatC )
+        return LocalBytes<T>(BlockedShape(shapeA, info.partModesA, blkSizes), info.distIntA, g)
+             + LocalBytes<T>(BlockedShape(shapeB, info.partModesB, blkSizes), info.distIntB, g);
+    else
+        return LocalBytes<T>(BlockedShape(shapeB, info.partModesB, blkSizes), info.distIntB, g)
+             + LocalBytes<T>(BlockedShape(shapeT, info.partModesC, blkSizes), info.distT, g);
+}
+
+// Start paging in the next block of an out-of-core operand
+template<typename T>
+void PrefetchNextBlock( const DistTensorView<T>& A_2, Mode mode, Unsigned blkSize )
+{
+    if( A_2.Dimension(mode) == 0 || !A_2.OutOfCore() )
+        return;
+    DistTensorView<T> A_next, A_rest;
+    LockedPartitionDown(A_2, A_next, A_rest, mode, blkSize);
+    DistTensor<T> A(A_2.TensorDist(), A_2.Grid());
+    LockedView(A, A_next);
+    A.LockedTensor().Prefetch();
+}
+
+// Let a finished block of an out-of-core operand be paged out
+template<typename T>
+void EvictBlock( const DistTensorView<T>& A_1 )
+{
+    if( !A_1.OutOfCore() )
+        return;
+    DistTensor<T> A(A_1.TensorDist(), A_1.Grid());
+    LockedView(A, A_1);
+    A.LockedTensor().Evict();
+}
+
+} // anonymous namespace
+
 // Partition helpers
 template <typename T>
 void Contract<T>::runHelperPartitionAB(
 	Unsigned depth, BlkContractStatCInfo& contractInfo,
 	T alpha,
-  const DistTensor<T>& A, const IndexArray& indicesA,
-	const DistTensor<T>& B, const IndexArray& indicesB,
+  const DistTensorView<T>& A, const IndexArray& indicesA,
+	const DistTensorView<T>& B, const IndexArray& indicesB,
 	T beta,
         DistTensor<T>& C, const IndexArray& indicesC
 ) {
+  //Everything this block allocates is released when it returns
+  WorkspaceMark workspaceMark;
   if(depth == contractInfo.partModesA.size()){
 		DistTensor<T> intA(contractInfo.distIntA, A.Grid());
 		intA.SetLocalPermutation(contractInfo.permA);
 		intA.AlignModesWith(contractInfo.alignModesA, C, contractInfo.alignModesATo);
+		if(NodeSharedIntermediates())
+			intA.SetNodeShared();
 		intA.RedistFrom(A);
 
 		DistTensor<T> intB(contractInfo.distIntB, B.Grid());
 		intB.AlignModesWith(contractInfo.alignModesB, C, contractInfo.alignModesBTo);
 		intB.SetLocalPermutation(contractInfo.permB);
+		if(NodeSharedIntermediates())
+			intB.SetNodeShared();
 		intB.RedistFrom(B);
 
 		Contract<T>::run(
@@ -47,17 +122,8 @@ void Contract<T>::runHelperPartitionAB(
 	Unsigned blkSize = contractInfo.blkSizes[depth];
 	Mode partModeA = contractInfo.partModesA[depth];
 	Mode partModeB = contractInfo.partModesB[depth];
-	DistTensor<T> A_T(A.TensorDist(), A.Grid());
-	DistTensor<T> A_B(A.TensorDist(), A.Grid());
-	DistTensor<T> A_0(A.TensorDist(), A.Grid());
-	DistTensor<T> A_1(A.TensorDist(), A.Grid());
-	DistTensor<T> A_2(A.TensorDist(), A.Grid());
-
-	DistTensor<T> B_T(B.TensorDist(), B.Grid());
-	DistTensor<T> B_B(B.TensorDist(), B.Grid());
-	DistTensor<T> B_0(B.TensorDist(), B.Grid());
-	DistTensor<T> B_1(B.TensorDist(), B.Grid());
-	DistTensor<T> B_2(B.TensorDist(), B.Grid());
+	DistTensorView<T> A_T, A_B, A_0, A_1, A_2;
+	DistTensorView<T> B_T, B_B, B_0, B_1, B_2;
 
 	//Do the partitioning and looping
 	int count = 0;
@@ -73,10 +139,15 @@ void Contract<T>::runHelperPartitionAB(
 							 B_1,
 						B_B, B_2, partModeB, blkSize);
 
+		PrefetchNextBlock(A_2, partModeA, blkSize);
+		PrefetchNextBlock(B_2, partModeB, blkSize);
 		/*----------------------------------------------------------------*/
 		Contract<T>::runHelperPartitionAB(depth+1, contractInfo, alpha, A_1, indicesA, B_1, indicesB, beta, C, indicesC);
 		count++;
 		/*----------------------------------------------------------------*/
+		//Done with this block: let it be paged out
+		EvictBlock(A_1);
+		EvictBlock(B_1);
 		SlideLockedPartitionDown(A_T, A_0,
 				                A_1,
 						   /**/ /**/
@@ -93,10 +164,12 @@ void Contract<T>::runHelperPartitionBC(
 	Unsigned depth, BlkContractStatCInfo& contractInfo,
 	T alpha,
   const DistTensor<T>& A, const IndexArray& indicesA,
-	const DistTensor<T>& B, const IndexArray& indicesB,
+	const DistTensorView<T>& B, const IndexArray& indicesB,
 	T beta,
-        DistTensor<T>& C, const IndexArray& indicesC
+  const DistTensorView<T>& C, const IndexArray& indicesC
 ) {
+  //Everything this block allocates is released when it returns
+  WorkspaceMark workspaceMark;
   if(depth == contractInfo.partModesB.size()){
 		//Perform the distributed computation
 		DistTensor<T> intB(contractInfo.distIntB, B.Grid());
@@ -113,6 +186,8 @@ void Contract<T>::runHelperPartitionBC(
 
 		intB.AlignModesWith(contractInfo.alignModesB, A, contractInfo.alignModesBTo);
 		intB.SetLocalPermutation(contractInfo.permB);
+		if(NodeSharedIntermediates())
+			intB.SetNodeShared();
 		intB.RedistFrom(B);
 
 		intT.AlignModesWith(contractInfo.alignModesT, A, contractInfo.alignModesTTo);
@@ -135,17 +210,8 @@ void Contract<T>::runHelperPartitionBC(
 	Unsigned blkSize = contractInfo.blkSizes[depth];
 	Mode partModeB = contractInfo.partModesB[depth];
 	Mode partModeC = contractInfo.partModesC[depth];
-	DistTensor<T> B_T(B.TensorDist(), B.Grid());
-	DistTensor<T> B_B(B.TensorDist(), B.Grid());
-	DistTensor<T> B_0(B.TensorDist(), B.Grid());
-	DistTensor<T> B_1(B.TensorDist(), B.Grid());
-	DistTensor<T> B_2(B.TensorDist(), B.Grid());
-
-	DistTensor<T> C_T(C.TensorDist(), C.Grid());
-	DistTensor<T> C_B(C.TensorDist(), C.Grid());
-	DistTensor<T> C_0(C.TensorDist(), C.Grid());
-	DistTensor<T> C_1(C.TensorDist(), C.Grid());
-	DistTensor<T> C_2(C.TensorDist(), C.Grid());
+	DistTensorView<T> B_T, B_B, B_0, B_1, B_2;
+	DistTensorView<T> C_T, C_B, C_0, C_1, C_2;
 
 	//Do the partitioning and looping
 	LockedPartitionDown(B, B_T, B_B, partModeB, 0);
@@ -161,9 +227,14 @@ void Contract<T>::runHelperPartitionBC(
 				        C_B, C_2, partModeC, blkSize);
 
 
+		PrefetchNextBlock(B_2, partModeB, blkSize);
+		PrefetchNextBlock(C_2, partModeC, blkSize);
 		/*----------------------------------------------------------------*/
 		Contract<T>::runHelperPartitionBC(depth+1, contractInfo, alpha, A, indicesA, B_1, indicesB, beta, C_1, indicesC);
 		/*----------------------------------------------------------------*/
+		//Done with this block: write it back and let it be paged out
+		EvictBlock(B_1);
+		EvictBlock(C_1);
 		SlideLockedPartitionDown(B_T, B_0,
 				                B_1,
 						   /**/ /**/
@@ -213,6 +284,9 @@ void Contract<T>::setContractInfo(
 	} else {
 		distIntB.SetToMatch(distA, indicesA, indicesB);
 		distT.SetToMatch(distA, indicesA, indicesT);
+		//The contracted modes of T hold one partial sum per process
+		for(i = indicesC.size(); i < indicesT.size(); i++)
+			distT[i].SetBlockSize(1);
 	}
 
 
@@ -275,13 +349,37 @@ void Contract<T>::setContractInfo(
 
 	//Set the Block-size info
 	//NOTE: There are better ways to do this
+	const Grid& g = C.Grid();
+	ObjShape shapeT(indicesT.size());
+	SetTensorShapeToMatch(A.Shape(), indicesA, shapeT, indicesT);
+	SetTensorShapeToMatch(C.Shape(), indicesC, shapeT, indicesT);
 	if(blkSizes.size() == 0){
-		contractInfo.blkSizes.resize(isStatC ? indicesAB.size() : indicesBC.size());
-		for(i = 0; i < contractInfo.blkSizes.size(); i++)
-			contractInfo.blkSizes[i] = 32;
+		//Halve the default block size while the innermost intermediates
+		//would not fit in what is left of the memory budget
+		const Offset headroom = MemoryHeadroom();
+		const Unsigned nBlkModes = isStatC ? indicesAB.size() : indicesBC.size();
+		contractInfo.blkSizes.assign(nBlkModes, 32);
+		while(contractInfo.blkSizes.size() > 0 && contractInfo.blkSizes[0] > 1 &&
+		      IntermediateBytes<T>(A.Shape(), B.Shape(), shapeT, contractInfo, isStatC, contractInfo.blkSizes, g) > headroom){
+			for(i = 0; i < nBlkModes; i++)
+				contractInfo.blkSizes[i] /= 2;
+		}
 	}else{
 		contractInfo.blkSizes = blkSizes;
 	}
+	//Views of block-cyclic tensors start on block boundaries, so step
+	//through the partitioned modes in whole blocks of both operands
+	for(i = 0; i < contractInfo.blkSizes.size(); i++){
+		const Unsigned distBlkSize = isStatC ?
+		  LCM(distA[contractInfo.partModesA[i]].BlockSize(), distB[contractInfo.partModesB[i]].BlockSize()) :
+		  LCM(distB[contractInfo.partModesB[i]].BlockSize(), distC[contractInfo.partModesC[i]].BlockSize());
+		contractInfo.blkSizes[i] = MaxLength(contractInfo.blkSizes[i], distBlkSize) * distBlkSize;
+	}
+
+	//Size the workspace for the largest block: the intermediates plus as
+	//much again for the communication buffers of their redistributions
+	contractInfo.workspaceBytes =
+	  2 * IntermediateBytes<T>(A.Shape(), B.Shape(), shapeT, contractInfo, isStatC, contractInfo.blkSizes, g);
 
 	//Set the local permutation info
 	std::cout << "permA\n";
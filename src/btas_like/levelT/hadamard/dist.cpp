@@ -33,9 +33,9 @@ void Hadamard<T>::run(
 		indC[i] = indicesC[i];
 
   //Determine Stationary variant.
-  const Unsigned numElemA = prod(A.Shape());
-  const Unsigned numElemB = prod(B.Shape());
-  const Unsigned numElemC = prod(C.Shape());
+  const Offset numElemA = prod(A.Shape());
+  const Offset numElemB = prod(B.Shape());
+  const Offset numElemC = prod(C.Shape());
 
   bool isBiggerAB = numElemA > numElemB;
   bool isBiggerAC = numElemA > numElemC;
@@ -92,6 +92,9 @@ void Hadamard<T>::run(
 	      DistTensor<T>& C, const IndexArray& indicesC,
 	const std::vector<Unsigned>& blkSizes, bool isStatC
 ) {
+	// Everything allocated below is an intermediate of the operation
+	MemoryCategoryScope scope( CONTRACT_MEMORY );
+
 	//Determine how to partition
 	BlkHadamardStatCInfo hadamardInfo;
 	Hadamard<T>::setHadamardInfo(
@@ -15,64 +15,60 @@ namespace rote{
 template <typename T>
 void Hadamard<T>::runHelperPartitionBC(
 	Unsigned depth, BlkHadamardStatCInfo& hadamardInfo,
-	const DistTensor<T>& A, const IndexArray& indicesA,
-	const DistTensor<T>& B, const IndexArray& indicesB,
-	      DistTensor<T>& C, const IndexArray& indicesC
+	const DistTensorView<T>& A, const IndexArray& indicesA,
+	const DistTensorView<T>& B, const IndexArray& indicesB,
+	const DistTensorView<T>& C, const IndexArray& indicesC
 ) {
 	if(depth == hadamardInfo.partModesBCB.size()){
+		//Only the blocks the kernel touches are set up as full tensors
+		DistTensor<T> blkA(A.TensorDist(), A.Grid());
+		DistTensor<T> blkC(C.TensorDist(), C.Grid());
+		LockedView(blkA, A);
+		View(blkC, C);
 		if(hadamardInfo.isStatC) {
 			DistTensor<T> intA(hadamardInfo.distIntA, A.Grid());
 			intA.SetLocalPermutation(hadamardInfo.permA);
-			intA.AlignModesWith(hadamardInfo.alignModesA, C, hadamardInfo.alignModesATo);
-			intA.RedistFrom(A);
+			intA.AlignModesWith(hadamardInfo.alignModesA, blkC, hadamardInfo.alignModesATo);
+			intA.RedistFrom(blkA);
 
 			DistTensor<T> intB(hadamardInfo.distIntB, B.Grid());
-			intB.AlignModesWith(hadamardInfo.alignModesB, C, hadamardInfo.alignModesBTo);
+			intB.AlignModesWith(hadamardInfo.alignModesB, blkC, hadamardInfo.alignModesBTo);
 			intB.SetLocalPermutation(hadamardInfo.permB);
 			intB.RedistFrom(B);
 
 			Hadamard<T>::run(
 				intA.LockedTensor(), hadamardInfo.permA.applyTo(indicesA),
 				intB.LockedTensor(), hadamardInfo.permB.applyTo(indicesB),
-				C.Tensor(), indicesC
+				blkC.Tensor(), indicesC
 			);
 		} else {
 			DistTensor<T> intC(hadamardInfo.distIntC, C.Grid());
 			intC.SetLocalPermutation(hadamardInfo.permC);
-			intC.AlignModesWith(hadamardInfo.alignModesC, A, hadamardInfo.alignModesCTo);
-			intC.RedistFrom(C);
+			intC.AlignModesWith(hadamardInfo.alignModesC, blkA, hadamardInfo.alignModesCTo);
+			intC.RedistFrom(blkC);
 
 			DistTensor<T> intB(hadamardInfo.distIntB, B.Grid());
-			intB.AlignModesWith(hadamardInfo.alignModesB, A, hadamardInfo.alignModesBTo);
+			intB.AlignModesWith(hadamardInfo.alignModesB, blkA, hadamardInfo.alignModesBTo);
 			intB.SetLocalPermutation(hadamardInfo.permB);
 			intB.RedistFrom(B);
 
 			Hadamard<T>::run(
-				A.LockedTensor(), indicesA,
+				blkA.LockedTensor(), indicesA,
 				intB.LockedTensor(), hadamardInfo.permB.applyTo(indicesB),
 				intC.Tensor(), hadamardInfo.permB.applyTo(indicesC)
 			);
-			C.RedistFrom(intC);
+			blkC.RedistFrom(intC);
 		}
 		return;
 	}
 
 	//Must partition and recur
 	//Note: pull logic out
-	Unsigned blkSize = hadamardInfo.blkSizes[depth];
+	Unsigned blkSize = hadamardInfo.blkSizes[hadamardInfo.partModesACA.size() + depth];
 	Mode partModeB = hadamardInfo.partModesBCB[depth];
 	Mode partModeC = hadamardInfo.partModesBCC[depth];
-	DistTensor<T> B_T(B.TensorDist(), B.Grid());
-	DistTensor<T> B_B(B.TensorDist(), B.Grid());
-	DistTensor<T> B_0(B.TensorDist(), B.Grid());
-	DistTensor<T> B_1(B.TensorDist(), B.Grid());
-	DistTensor<T> B_2(B.TensorDist(), B.Grid());
-
-	DistTensor<T> C_T(C.TensorDist(), C.Grid());
-	DistTensor<T> C_B(C.TensorDist(), C.Grid());
-	DistTensor<T> C_0(C.TensorDist(), C.Grid());
-	DistTensor<T> C_1(C.TensorDist(), C.Grid());
-	DistTensor<T> C_2(C.TensorDist(), C.Grid());
+	DistTensorView<T> B_T, B_B, B_0, B_1, B_2;
+	DistTensorView<T> C_T, C_B, C_0, C_1, C_2;
 
 	//Do the partitioning and looping
 	int count = 0;
@@ -107,9 +103,9 @@ void Hadamard<T>::runHelperPartitionBC(
 template <typename T>
 void Hadamard<T>::runHelperPartitionAC(
 	Unsigned depth, BlkHadamardStatCInfo& hadamardInfo,
-	const DistTensor<T>& A, const IndexArray& indicesA,
-	const DistTensor<T>& B, const IndexArray& indicesB,
-	      DistTensor<T>& C, const IndexArray& indicesC
+	const DistTensorView<T>& A, const IndexArray& indicesA,
+	const DistTensorView<T>& B, const IndexArray& indicesB,
+	const DistTensorView<T>& C, const IndexArray& indicesC
 ) {
 	if(depth == hadamardInfo.partModesACA.size()){
 		Hadamard<T>::runHelperPartitionBC(0, hadamardInfo, A, indicesA, B, indicesB, C, indicesC);
@@ -121,17 +117,8 @@ void Hadamard<T>::runHelperPartitionAC(
 	Unsigned blkSize = hadamardInfo.blkSizes[depth];
 	Mode partModeA = hadamardInfo.partModesACA[depth];
 	Mode partModeC = hadamardInfo.partModesACC[depth];
-	DistTensor<T> A_T(A.TensorDist(), A.Grid());
-	DistTensor<T> A_B(A.TensorDist(), A.Grid());
-	DistTensor<T> A_0(A.TensorDist(), A.Grid());
-	DistTensor<T> A_1(A.TensorDist(), A.Grid());
-	DistTensor<T> A_2(A.TensorDist(), A.Grid());
-
-	DistTensor<T> C_T(C.TensorDist(), C.Grid());
-	DistTensor<T> C_B(C.TensorDist(), C.Grid());
-	DistTensor<T> C_0(C.TensorDist(), C.Grid());
-	DistTensor<T> C_1(C.TensorDist(), C.Grid());
-	DistTensor<T> C_2(C.TensorDist(), C.Grid());
+	DistTensorView<T> A_T, A_B, A_0, A_1, A_2;
+	DistTensorView<T> C_T, C_B, C_0, C_1, C_2;
 
 	//Do the partitioning and looping
 	int count = 0;
@@ -257,6 +244,14 @@ void Hadamard<T>::setHadamardInfo(
 	}else{
 		hadamardInfo.blkSizes = blkSizes;
 	}
+	//Views of block-cyclic tensors start on block boundaries, so step
+	//through the partitioned modes in whole blocks of both operands
+	for(i = 0; i < indicesCA.size() + indicesCB.size(); i++){
+		const Unsigned distBlkSize = i < indicesCA.size() ?
+		  LCM(distA[hadamardInfo.partModesACA[i]].BlockSize(), distC[hadamardInfo.partModesACC[i]].BlockSize()) :
+		  LCM(distB[hadamardInfo.partModesBCB[i - indicesCA.size()]].BlockSize(), distC[hadamardInfo.partModesBCC[i - indicesCA.size()]].BlockSize());
+		hadamardInfo.blkSizes[i] = MaxLength(hadamardInfo.blkSizes[i], distBlkSize) * distBlkSize;
+	}
 
 	//Set the local permutation info
 	Permutation permA(indicesA, ConcatenateVectors(indicesCA, indicesCBA));
@@ -0,0 +1,289 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "rote.hpp"
+
+#ifdef HAVE_SYS_MMAN_H
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+#ifdef HAVE_MBIND
+# include <sys/syscall.h>
+# include <linux/mempolicy.h>
+#endif
+
+namespace {
+
+std::size_t RoundUp( std::size_t n, std::size_t multiple )
+{ return ((n + multiple - 1) / multiple) * multiple; }
+
+struct DefaultPolicy
+{
+    std::mutex mutex;
+    rote::AllocationPolicy policy;
+};
+
+DefaultPolicy& GetDefaultPolicy()
+{
+    static DefaultPolicy defaultPolicy;
+    return defaultPolicy;
+}
+
+#ifdef HAVE_SYS_MMAN_H
+
+std::size_t SystemPageSize()
+{
+    static const std::size_t pageSize = sysconf( _SC_PAGESIZE );
+    return pageSize;
+}
+
+bool UsesHugePages( std::size_t bytes, const rote::AllocationPolicy& policy )
+{
+    return policy.hugePages != rote::HUGE_PAGES_NONE &&
+           bytes >= policy.hugePageThreshold;
+}
+
+// Blocks needing page-level control are mapped directly instead of malloc'd
+bool UsesMapping( std::size_t bytes, const rote::AllocationPolicy& policy )
+{ return UsesHugePages( bytes, policy ) || policy.numa != rote::NUMA_DEFAULT; }
+
+std::size_t MappedLength
+( std::size_t bytes, const rote::AllocationPolicy& policy )
+{
+    return RoundUp
+    ( bytes, UsesHugePages( bytes, policy ) ? rote::HugePageSize()
+                                            : SystemPageSize() );
+}
+
+// Map 'length' bytes starting on a multiple of 'align' by over-mapping and
+// unmapping the slack on either side
+void* MapAligned( std::size_t length, std::size_t align )
+{
+    const std::size_t slack =
+        align > SystemPageSize() ? align - SystemPageSize() : 0;
+    void* raw = mmap
+    ( 0, length+slack, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0 );
+    if( raw == MAP_FAILED )
+        return 0;
+    char* base = static_cast<char*>(raw);
+    const std::size_t head =
+        RoundUp( reinterpret_cast<std::size_t>(base), align ) -
+        reinterpret_cast<std::size_t>(base);
+    if( head != 0 )
+        munmap( base, head );
+    if( slack - head != 0 )
+        munmap( base + head + length, slack - head );
+    return base + head;
+}
+
+#ifdef HAVE_MBIND
+// Bit mask of the online nodes, empty when there is only one
+const std::vector<unsigned long>& OnlineNodeMask()
+{
+    static std::vector<unsigned long> mask;
+    static bool initialized = false;
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock( mutex );
+    if( initialized )
+        return mask;
+    initialized = true;
+
+    // The file holds a list of ranges such as "0-3,6"
+    std::ifstream file( "/sys/devices/system/node/online" );
+    std::string line;
+    if( !std::getline( file, line ) )
+        return mask;
+    const std::size_t bitsPerWord = 8*sizeof(unsigned long);
+    std::size_t numNodes = 0;
+    std::istringstream ranges( line );
+    std::string range;
+    while( std::getline( ranges, range, ',' ) )
+    {
+        const std::size_t dash = range.find( '-' );
+        const unsigned long first = std::strtoul( range.c_str(), 0, 10 );
+        const unsigned long last = dash == std::string::npos ? first :
+            std::strtoul( range.c_str()+dash+1, 0, 10 );
+        for( unsigned long node=first; node<=last; ++node )
+        {
+            if( node/bitsPerWord >= mask.size() )
+                mask.resize( node/bitsPerWord+1, 0 );
+            mask[node/bitsPerWord] |= 1ul << (node % bitsPerWord);
+            ++numNodes;
+        }
+    }
+    if( numNodes < 2 )
+        mask.clear();
+    return mask;
+}
+#endif // ifdef HAVE_MBIND
+
+// Spread the (not yet touched) pages of a fresh mapping over all nodes.
+// Failure leaves the default placement in effect.
+void Interleave( void* ptr, std::size_t length )
+{
+#ifdef HAVE_MBIND
+    const std::vector<unsigned long>& mask = OnlineNodeMask();
+    if( mask.empty() )
+        return;
+    const unsigned long maxNode = mask.size()*8*sizeof(unsigned long) + 1;
+    syscall( SYS_mbind, ptr, length, MPOL_INTERLEAVE, &mask[0], maxNode, 0 );
+#endif
+}
+
+// Fault each page in from the thread that a static PARALLEL_FOR over the
+// block would give it to, so that each thread's slice lands on its own node
+void FirstTouch( void* ptr, std::size_t length, std::size_t pageSize )
+{
+    char* bytes = static_cast<char*>(ptr);
+    const rote::Offset numPages = (length + pageSize - 1) / pageSize;
+    PARALLEL_FOR
+    for( rote::Offset page=0; page<numPages; ++page )
+        bytes[page*pageSize] = 0;
+}
+
+#endif // ifdef HAVE_SYS_MMAN_H
+
+} // anonymous namespace
+
+namespace rote {
+
+AllocationPolicy::AllocationPolicy()
+: alignment(64), hugePages(HUGE_PAGES_NONE), numa(NUMA_DEFAULT),
+  hugePageThreshold(std::size_t(2) << 20)
+{ }
+
+bool operator==( const AllocationPolicy& a, const AllocationPolicy& b )
+{
+    return a.alignment == b.alignment && a.hugePages == b.hugePages &&
+           a.numa == b.numa && a.hugePageThreshold == b.hugePageThreshold;
+}
+
+bool operator!=( const AllocationPolicy& a, const AllocationPolicy& b )
+{ return !(a == b); }
+
+bool operator<( const AllocationPolicy& a, const AllocationPolicy& b )
+{
+    if( a.alignment != b.alignment )
+        return a.alignment < b.alignment;
+    if( a.hugePages != b.hugePages )
+        return a.hugePages < b.hugePages;
+    if( a.numa != b.numa )
+        return a.numa < b.numa;
+    return a.hugePageThreshold < b.hugePageThreshold;
+}
+
+void AssertValidAllocationPolicy( const AllocationPolicy& policy )
+{
+    const std::size_t align = policy.alignment;
+    if( align < sizeof(void*) || (align & (align-1)) != 0 )
+    {
+        std::ostringstream msg;
+        msg << "Alignment must be a power of two of at least "
+            << sizeof(void*) << " bytes, not " << align;
+        LogicError( msg.str() );
+    }
+}
+
+void SetDefaultAllocationPolicy( const AllocationPolicy& policy )
+{
+    AssertValidAllocationPolicy( policy );
+    DefaultPolicy& defaultPolicy = GetDefaultPolicy();
+    std::lock_guard<std::mutex> lock( defaultPolicy.mutex );
+    defaultPolicy.policy = policy;
+}
+
+AllocationPolicy DefaultAllocationPolicy()
+{
+    DefaultPolicy& defaultPolicy = GetDefaultPolicy();
+    std::lock_guard<std::mutex> lock( defaultPolicy.mutex );
+    return defaultPolicy.policy;
+}
+
+std::size_t HugePageSize()
+{
+    static std::size_t hugePageSize = 0;
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock( mutex );
+    if( hugePageSize == 0 )
+    {
+        hugePageSize = std::size_t(2) << 20;
+        std::ifstream meminfo( "/proc/meminfo" );
+        std::string key;
+        std::size_t kiB;
+        while( meminfo >> key )
+        {
+            if( key == "Hugepagesize:" && meminfo >> kiB )
+            {
+                hugePageSize = kiB << 10;
+                break;
+            }
+            meminfo.ignore( std::numeric_limits<std::streamsize>::max(), '\n' );
+        }
+    }
+    return hugePageSize;
+}
+
+void* SystemAllocate( std::size_t bytes, const AllocationPolicy& policy )
+{
+#ifdef HAVE_SYS_MMAN_H
+    if( UsesMapping( bytes, policy ) )
+    {
+        const bool huge = UsesHugePages( bytes, policy );
+        const std::size_t pageSize = huge ? HugePageSize() : SystemPageSize();
+        const std::size_t length = MappedLength( bytes, policy );
+        void* ptr = 0;
+#ifdef MAP_HUGETLB
+        if( huge && policy.hugePages == HUGE_PAGES_EXPLICIT &&
+            policy.alignment <= pageSize )
+        {
+            ptr = mmap
+            ( 0, length, PROT_READ|PROT_WRITE,
+              MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0 );
+            if( ptr == MAP_FAILED )
+                ptr = 0;
+        }
+#endif
+        if( ptr == 0 )
+        {
+            ptr = MapAligned( length, std::max( policy.alignment, pageSize ) );
+            if( ptr == 0 )
+                throw std::bad_alloc();
+#if defined(HAVE_MADVISE) && defined(MADV_HUGEPAGE)
+            if( huge )
+                madvise( ptr, length, MADV_HUGEPAGE );
+#endif
+        }
+        if( policy.numa == NUMA_INTERLEAVE )
+            Interleave( ptr, length );
+        else if( policy.numa == NUMA_FIRST_TOUCH )
+            FirstTouch( ptr, length, pageSize );
+        return ptr;
+    }
+#endif
+    void* ptr = 0;
+    if( posix_memalign( &ptr, policy.alignment, bytes ) != 0 )
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void SystemDeallocate
+( void* ptr, std::size_t bytes, const AllocationPolicy& policy )
+{
+    if( ptr == 0 )
+        return;
+#ifdef HAVE_SYS_MMAN_H
+    if( UsesMapping( bytes, policy ) )
+    {
+        munmap( ptr, MappedLength( bytes, policy ) );
+        return;
+    }
+#endif
+    std::free( ptr );
+}
+
+} // namespace rote
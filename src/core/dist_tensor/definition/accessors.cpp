@@ -32,7 +32,7 @@ DistTensorBase<T>::Shape() const
 template<typename T>
 ObjShape
 DistTensorBase<T>::MaxLocalShape() const
-{ return MaxLengths(Shape(), gridView_.ParticipatingShape()); }
+{ return MaxBlockLengths(Shape(), gridView_.ParticipatingShape(), dist_.BlockSizes()); }
 
 template<typename T>
 ModeDistribution
@@ -183,22 +183,22 @@ DistTensorBase<T>::LocalShape() const
 { return tensor_.Shape(); }
 
 template<typename T>
-std::vector<Unsigned>
+std::vector<Offset>
 DistTensorBase<T>::LocalStrides() const
 { return tensor_.Strides(); }
 
 template<typename T>
-Unsigned
+Offset
 DistTensorBase<T>::LocalModeStride(Mode mode) const
 { return tensor_.Stride(mode); }
 
 template<typename T>
-Unsigned
+Offset
 DistTensorBase<T>::Stride(Mode mode) const
 { return tensor_.Stride(mode); }
 
 template<typename T>
-std::vector<Unsigned>
+std::vector<Offset>
 DistTensorBase<T>::Strides() const
 { return tensor_.Strides(); }
 
@@ -0,0 +1,287 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "rote.hpp"
+
+namespace rote {
+
+namespace {
+
+// Owner and local-index computations for a distribution, set up once per
+// list of locations rather than per entry
+class EntryRouter
+{
+public:
+    EntryRouter
+    ( const TensorDistribution& dist, const std::vector<Unsigned>& alignments,
+      const std::vector<Offset>& localModeStrides, const rote::Grid& g )
+    : gridShape_(g.Shape()), myGridLoc_(g.Loc()),
+      alignments_(alignments), localModeStrides_(localModeStrides)
+    {
+        const Unsigned order = dist.size() - 1;
+        gridModes_.resize(order);
+        modeGridShapes_.resize(order);
+        wraps_.resize(order);
+        blockSizes_.resize(order);
+        for(Unsigned i = 0; i < order; i++){
+            gridModes_[i] = dist[i].Entries();
+            modeGridShapes_[i] = FilterVector(gridShape_, gridModes_[i]);
+            wraps_[i] = gridModes_[i].empty() ? 1 : prod(modeGridShapes_[i]);
+            blockSizes_[i] = dist[i].BlockSize();
+        }
+
+        //Owners only live where the ignored grid modes are 0
+        const ModeArray ignoredModes = dist.UnusedModes().Entries();
+        for(Unsigned i = 0; i < ignoredModes.size(); i++)
+            myGridLoc_[ignoredModes[i]] = 0;
+
+        const ModeDistribution boundModes = dist.UsedModes();
+        for(Unsigned i = 0; i < gridShape_.size(); i++)
+            if(!boundModes.Contains(i) && !Contains(ignoredModes, i))
+                replicatedModes_.push_back(i);
+        numCopies_ = replicatedModes_.empty() ? 1 : prod(FilterVector(gridShape_, replicatedModes_));
+    }
+
+    // Grid ranks owning the entry at loc: every copy if allCopies, else the
+    // one sharing our coordinates along the replicated grid modes
+    void OwnerRanks
+    ( const Location& loc, bool allCopies, std::vector<Unsigned>& ranks ) const
+    {
+        Location ownerLoc = myGridLoc_;
+        for(Unsigned i = 0; i < loc.size(); i++){
+            if(gridModes_[i].empty())
+                continue;
+            const Unsigned modeOwner = BlockOwner(loc[i], alignments_[i], wraps_[i], blockSizes_[i]);
+            const Location modeOwnerLoc = LinearLoc2Loc(modeOwner, modeGridShapes_[i]);
+            for(Unsigned j = 0; j < gridModes_[i].size(); j++)
+                ownerLoc[gridModes_[i][j]] = modeOwnerLoc[j];
+        }
+        ranks.clear();
+        if(!allCopies){
+            ranks.push_back(Loc2LinearLoc(ownerLoc, gridShape_));
+            return;
+        }
+        const ObjShape replicatedShape = FilterVector(gridShape_, replicatedModes_);
+        for(Unsigned c = 0; c < numCopies_; c++){
+            if(!replicatedModes_.empty()){
+                const Location copyLoc = LinearLoc2Loc(c, replicatedShape);
+                for(Unsigned j = 0; j < replicatedModes_.size(); j++)
+                    ownerLoc[replicatedModes_[j]] = copyLoc[j];
+            }
+            ranks.push_back(Loc2LinearLoc(ownerLoc, gridShape_));
+        }
+    }
+
+    // Offset in our local buffer of the entry at loc, which we own
+    Offset LocalOffset( const Unsigned* loc ) const
+    {
+        Offset offset = 0;
+        for(Unsigned i = 0; i < localModeStrides_.size(); i++)
+            offset += BlockGlobal2Local(loc[i], wraps_[i], blockSizes_[i]) * localModeStrides_[i];
+        return offset;
+    }
+
+private:
+    ObjShape gridShape_;
+    Location myGridLoc_;
+    std::vector<Unsigned> alignments_;
+    std::vector<Offset> localModeStrides_;
+    std::vector<ModeArray> gridModes_;
+    std::vector<ObjShape> modeGridShapes_;
+    std::vector<Unsigned> wraps_;
+    std::vector<Unsigned> blockSizes_;
+    ModeArray replicatedModes_;
+    Unsigned numCopies_;
+};
+
+void Displacements
+( const std::vector<int>& counts, std::vector<int>& displs, int scale=1 )
+{
+    displs.resize(counts.size());
+    int displ = 0;
+    for(Unsigned p = 0; p < counts.size(); p++){
+        displs[p] = displ;
+        displ += counts[p] * scale;
+    }
+}
+
+} // anonymous namespace
+
+template<typename T>
+std::vector<T>
+DistTensorBase<T>::GetMany( const std::vector<Location>& locs ) const
+{
+    const rote::Grid& g = Grid();
+    const mpi::Comm comm = g.OwningComm();
+    const Unsigned nProcs = g.Size();
+    const Unsigned order = Order();
+#ifndef RELEASE
+    for(Unsigned i = 0; i < locs.size(); i++)
+        AssertValidEntry(locs[i]);
+#endif
+    const EntryRouter router
+    ( dist_, modeAlignments_,
+      localPerm_.InversePermutation().applyTo(LocalStrides()), g );
+
+    //Bucket the requests by owner
+    std::vector<Unsigned> owners(locs.size());
+    std::vector<int> sendCounts(nProcs, 0);
+    std::vector<Unsigned> ranks;
+    for(Unsigned i = 0; i < locs.size(); i++){
+        router.OwnerRanks(locs[i], false, ranks);
+        owners[i] = ranks[0];
+        sendCounts[owners[i]]++;
+    }
+    std::vector<int> recvCounts(nProcs);
+    mpi::AllToAll(&(sendCounts[0]), 1, &(recvCounts[0]), 1, comm);
+
+    std::vector<int> sendDispls, recvDispls;
+    Displacements(sendCounts, sendDispls);
+    Displacements(recvCounts, recvDispls);
+    const Unsigned numRequests = recvDispls[nProcs-1] + recvCounts[nProcs-1];
+
+    //Send the locations, in the order the replies come back
+    std::vector<Unsigned> slot(locs.size());
+    std::vector<Unsigned> sendLocs(locs.size() * order + 1);
+    std::vector<int> next = sendDispls;
+    for(Unsigned i = 0; i < locs.size(); i++){
+        slot[i] = next[owners[i]]++;
+        std::copy(locs[i].begin(), locs[i].end(), &(sendLocs[slot[i] * order]));
+    }
+    std::vector<int> sendLocCounts(nProcs), recvLocCounts(nProcs);
+    for(Unsigned p = 0; p < nProcs; p++){
+        sendLocCounts[p] = sendCounts[p] * order;
+        recvLocCounts[p] = recvCounts[p] * order;
+    }
+    std::vector<int> sendLocDispls, recvLocDispls;
+    Displacements(sendCounts, sendLocDispls, order);
+    Displacements(recvCounts, recvLocDispls, order);
+    std::vector<Unsigned> recvLocs(numRequests * order + 1);
+    mpi::AllToAll(&(sendLocs[0]), &(sendLocCounts[0]), &(sendLocDispls[0]),
+                  &(recvLocs[0]), &(recvLocCounts[0]), &(recvLocDispls[0]), comm);
+
+    //Answer the requests for our entries
+    const T* buffer = LockedBuffer();
+    std::vector<T> replies(numRequests + 1);
+    for(Unsigned i = 0; i < numRequests; i++)
+        replies[i] = buffer[router.LocalOffset(&(recvLocs[i * order]))];
+
+    std::vector<T> values(locs.size() + 1);
+    mpi::AllToAll(&(replies[0]), &(recvCounts[0]), &(recvDispls[0]),
+                  &(values[0]), &(sendCounts[0]), &(sendDispls[0]), comm);
+
+    std::vector<T> ret(locs.size());
+    for(Unsigned i = 0; i < locs.size(); i++)
+        ret[i] = values[slot[i]];
+    return ret;
+}
+
+template<typename T>
+void
+DistTensorBase<T>::SetMany
+( const std::vector<Location>& locs, const std::vector<T>& values )
+{ ScatterMany( locs, values, false ); }
+
+template<typename T>
+void
+DistTensorBase<T>::UpdateMany
+( const std::vector<Location>& locs, const std::vector<T>& values )
+{ ScatterMany( locs, values, true ); }
+
+template<typename T>
+void
+DistTensorBase<T>::ScatterMany
+( const std::vector<Location>& locs, const std::vector<T>& values,
+  bool update )
+{
+    const rote::Grid& g = Grid();
+    const mpi::Comm comm = g.OwningComm();
+    const Unsigned nProcs = g.Size();
+    const Unsigned order = Order();
+#ifndef RELEASE
+    if(locs.size() != values.size())
+        LogicError("Must supply one value per location");
+    for(Unsigned i = 0; i < locs.size(); i++)
+        AssertValidEntry(locs[i]);
+#endif
+    const EntryRouter router
+    ( dist_, modeAlignments_,
+      localPerm_.InversePermutation().applyTo(LocalStrides()), g );
+
+    //Bucket the entries by owner, once for every copy
+    std::vector<Unsigned> owners, entries;
+    std::vector<int> sendCounts(nProcs, 0);
+    std::vector<Unsigned> ranks;
+    for(Unsigned i = 0; i < locs.size(); i++){
+        router.OwnerRanks(locs[i], true, ranks);
+        for(Unsigned j = 0; j < ranks.size(); j++){
+            owners.push_back(ranks[j]);
+            entries.push_back(i);
+            sendCounts[ranks[j]]++;
+        }
+    }
+    std::vector<int> recvCounts(nProcs);
+    mpi::AllToAll(&(sendCounts[0]), 1, &(recvCounts[0]), 1, comm);
+
+    std::vector<int> sendDispls, recvDispls;
+    Displacements(sendCounts, sendDispls);
+    Displacements(recvCounts, recvDispls);
+    const Unsigned numSends = owners.size();
+    const Unsigned numRecvs = recvDispls[nProcs-1] + recvCounts[nProcs-1];
+
+    std::vector<Unsigned> sendLocs(numSends * order + 1);
+    std::vector<T> sendValues(numSends + 1);
+    std::vector<int> next = sendDispls;
+    for(Unsigned k = 0; k < numSends; k++){
+        const Unsigned slot = next[owners[k]]++;
+        std::copy(locs[entries[k]].begin(), locs[entries[k]].end(), &(sendLocs[slot * order]));
+        sendValues[slot] = values[entries[k]];
+    }
+    std::vector<int> sendLocCounts(nProcs), recvLocCounts(nProcs);
+    for(Unsigned p = 0; p < nProcs; p++){
+        sendLocCounts[p] = sendCounts[p] * order;
+        recvLocCounts[p] = recvCounts[p] * order;
+    }
+    std::vector<int> sendLocDispls, recvLocDispls;
+    Displacements(sendCounts, sendLocDispls, order);
+    Displacements(recvCounts, recvLocDispls, order);
+    std::vector<Unsigned> recvLocs(numRecvs * order + 1);
+    std::vector<T> recvValues(numRecvs + 1);
+    mpi::AllToAll(&(sendLocs[0]), &(sendLocCounts[0]), &(sendLocDispls[0]),
+                  &(recvLocs[0]), &(recvLocCounts[0]), &(recvLocDispls[0]), comm);
+    mpi::AllToAll(&(sendValues[0]), &(sendCounts[0]), &(sendDispls[0]),
+                  &(recvValues[0]), &(recvCounts[0]), &(recvDispls[0]), comm);
+
+    //Node-shared entries are written once per node
+    if(NodeLeader()){
+        T* buffer = Buffer();
+        for(Unsigned i = 0; i < numRecvs; i++){
+            T& entry = buffer[router.LocalOffset(&(recvLocs[i * order]))];
+            entry = update ? entry + recvValues[i] : recvValues[i];
+        }
+    }
+    NodeSync();
+}
+
+#define FULL(T) \
+    template class DistTensorBase<T>;
+
+FULL(Int)
+#ifndef DISABLE_FLOAT
+FULL(float)
+#endif
+FULL(double)
+
+#ifndef DISABLE_COMPLEX
+#ifndef DISABLE_FLOAT
+FULL(std::complex<float>)
+#endif
+FULL(std::complex<double>)
+#endif
+
+} // namespace rote
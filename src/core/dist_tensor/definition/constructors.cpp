@@ -23,12 +23,11 @@ DistTensorBase<T>::DistTensorBase( const rote::Grid& grid )
   localPerm_(),
 
   grid_(&grid),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 {
   SetShifts(); SetParticipatingComm(); SetDefaultPermutation();}
 
@@ -45,12 +44,11 @@ DistTensorBase<T>::DistTensorBase( const Unsigned order, const rote::Grid& grid
   localPerm_(order),
 
   grid_(&grid),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 { SetShifts(); SetParticipatingComm(); SetDefaultPermutation();}
 
 template<typename T>
@@ -66,12 +64,11 @@ DistTensorBase<T>::DistTensorBase( const TensorDistribution& dist, const rote::G
   localPerm_(shape_.size()),
 
   grid_(&grid),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 { SetShifts(); SetParticipatingComm(); SetDefaultPermutation();}
 
 template<typename T>
@@ -88,12 +85,11 @@ DistTensorBase<T>::DistTensorBase
   localPerm_(shape_.size()),
 
   grid_(&grid),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 {
     if(shape_.size() + 1 != dist_.size())
         LogicError("Error: Distribution must be of same order as object");
@@ -119,12 +115,11 @@ DistTensorBase<T>::DistTensorBase
   localPerm_(shape_.size()),
 
   grid_(&g),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 {
     if(shape_.size() + 1 != dist_.size())
         LogicError("Error: Distribution must be of same order as object");
@@ -138,7 +133,7 @@ DistTensorBase<T>::DistTensorBase
 template<typename T>
 DistTensorBase<T>::DistTensorBase
 ( const ObjShape& shape, const TensorDistribution& dist, const std::vector<Unsigned>& modeAlignments,
-  const std::vector<Unsigned>& strides, const rote::Grid& g )
+  const std::vector<Offset>& strides, const rote::Grid& g )
 : dist_(dist),
   shape_(shape),
 
@@ -150,12 +145,11 @@ DistTensorBase<T>::DistTensorBase
   localPerm_(shape_.size()),
 
   grid_(&g),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 {
     if(shape_.size() + 1 != dist_.size())
         LogicError("Error: Distribution must be of same order as object");
@@ -168,7 +162,7 @@ DistTensorBase<T>::DistTensorBase
 template<typename T>
 DistTensorBase<T>::DistTensorBase
 ( const ObjShape& shape, const TensorDistribution& dist, const std::vector<Unsigned>& modeAlignments,
-  const T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g )
+  const T* buffer, const std::vector<Offset>& strides, const rote::Grid& g )
 : dist_(dist),
   shape_(shape),
 
@@ -180,12 +174,11 @@ DistTensorBase<T>::DistTensorBase
   localPerm_(shape_.size()),
 
   grid_(&g),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 {
     if(shape_.size() + 1 != dist_.size())
         LogicError("Error: Distribution must be of same order as object");
@@ -199,7 +192,7 @@ DistTensorBase<T>::DistTensorBase
 template<typename T>
 DistTensorBase<T>::DistTensorBase
 ( const ObjShape& shape, const TensorDistribution& dist, const std::vector<Unsigned>& modeAlignments,
-  T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g )
+  T* buffer, const std::vector<Offset>& strides, const rote::Grid& g )
 : dist_(dist),
   shape_(shape),
 
@@ -211,12 +204,11 @@ DistTensorBase<T>::DistTensorBase
   localPerm_(shape_.size()),
 
   grid_(&g),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 {
     if(shape_.size() + 1 != dist_.size())
         LogicError("Error: Distribution must be of same order as object");
@@ -244,12 +236,11 @@ DistTensorBase<T>::DistTensorBase( const std::string& dist, const rote::Grid& gr
   localPerm_(shape_.size()),
 
   grid_(&grid),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 { SetShifts(); SetParticipatingComm(); SetDefaultPermutation();}
 
 template<typename T>
@@ -266,12 +257,11 @@ DistTensorBase<T>::DistTensorBase
   localPerm_(shape_.size()),
 
   grid_(&grid),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 {
     if(shape_.size() + 1 != dist_.size())
         LogicError("Error: Distribution must be of same order as object");
@@ -297,12 +287,11 @@ DistTensorBase<T>::DistTensorBase
   localPerm_(shape_.size()),
 
   grid_(&g),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 {
     if(shape_.size() + 1 != dist_.size())
         LogicError("Error: Distribution must be of same order as object");
@@ -315,7 +304,7 @@ DistTensorBase<T>::DistTensorBase
 template<typename T>
 DistTensorBase<T>::DistTensorBase
 ( const ObjShape& shape, const std::string& dist, const std::vector<Unsigned>& modeAlignments,
-  const std::vector<Unsigned>& strides, const rote::Grid& g )
+  const std::vector<Offset>& strides, const rote::Grid& g )
 : dist_(StringToTensorDist(dist)),
   shape_(shape),
 
@@ -327,12 +316,11 @@ DistTensorBase<T>::DistTensorBase
   localPerm_(shape_.size()),
 
   grid_(&g),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 {
     if(shape_.size() + 1 != dist_.size())
         LogicError("Error: Distribution must be of same order as object");
@@ -345,7 +333,7 @@ DistTensorBase<T>::DistTensorBase
 template<typename T>
 DistTensorBase<T>::DistTensorBase
 ( const ObjShape& shape, const std::string& dist, const std::vector<Unsigned>& modeAlignments,
-  const T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g )
+  const T* buffer, const std::vector<Offset>& strides, const rote::Grid& g )
 : dist_(StringToTensorDist(dist)),
   shape_(shape),
 
@@ -357,12 +345,11 @@ DistTensorBase<T>::DistTensorBase
   localPerm_(shape_.size()),
 
   grid_(&g),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 {
     if(shape_.size() + 1 != dist_.size())
         LogicError("Error: Distribution must be of same order as object");
@@ -376,7 +363,7 @@ DistTensorBase<T>::DistTensorBase
 template<typename T>
 DistTensorBase<T>::DistTensorBase
 ( const ObjShape& shape, const std::string& dist, const std::vector<Unsigned>& modeAlignments,
-  T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g )
+  T* buffer, const std::vector<Offset>& strides, const rote::Grid& g )
 : dist_(StringToTensorDist(dist)),
   shape_(shape),
 
@@ -388,12 +375,11 @@ DistTensorBase<T>::DistTensorBase
   localPerm_(shape_.size()),
 
   grid_(&g),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 {
     if(shape_.size() + 1 != dist_.size())
         LogicError("Error: Distribution must be of same order as object");
@@ -406,33 +392,51 @@ DistTensorBase<T>::DistTensorBase
 
 template<typename T>
 DistTensorBase<T>::DistTensorBase( const DistTensorBase<T>& A )
-: dist_(),
+: dist_(A.dist_),
   shape_(),
 
-  constrainedModeAlignments_(),
-  modeAlignments_(),
+  constrainedModeAlignments_(A.constrainedModeAlignments_),
+  modeAlignments_(A.modeAlignments_),
   modeShifts_(),
 
-  tensor_(true),
-  localPerm_(shape_.size()),
+  tensor_(false),
+  localPerm_(A.localPerm_),
 
   grid_(&(A.Grid())),
-  commMap_(&(DefaultCommMap())),
   gridView_(grid_, dist_),
   participatingComm_(),
 
   viewType_(OWNER),
-  auxMemory_()
+  auxMemory_(COMM_MEMORY)
 {
     SetShifts();
     if( &A != this )
         *this = A;
     else
         LogicError("Tried to construct [MC,MR] with itself");
-    SetDefaultPermutation();
     SetParticipatingComm();
 }
 
+template<typename T>
+DistTensorBase<T>::DistTensorBase( DistTensorBase<T>&& A )
+: dist_(std::move(A.dist_)),
+  shape_(std::move(A.shape_)),
+
+  constrainedModeAlignments_(std::move(A.constrainedModeAlignments_)),
+  modeAlignments_(std::move(A.modeAlignments_)),
+  modeShifts_(std::move(A.modeShifts_)),
+
+  tensor_(std::move(A.tensor_)),
+  localPerm_(std::move(A.localPerm_)),
+
+  grid_(A.grid_),
+  gridView_(std::move(A.gridView_)),
+  participatingComm_(A.participatingComm_),
+
+  viewType_(A.viewType_),
+  auxMemory_(std::move(A.auxMemory_))
+{ A.viewType_ = OWNER; }
+
 template<typename T>
 DistTensorBase<T>::~DistTensorBase()
 { }
@@ -453,6 +457,7 @@ DistTensorBase<T>::Swap( DistTensorBase<T>& A )
 
     std::swap( grid_, A.grid_ );
     std::swap( gridView_, A.gridView_ );
+    std::swap( participatingComm_, A.participatingComm_ );
 
     std::swap( viewType_, A.viewType_ );
     auxMemory_.Swap( A.auxMemory_ );
@@ -501,6 +506,26 @@ DistTensorBase<T>::operator=( const DistTensorBase<T>& A )
     return *this;
 }
 
+template<typename T>
+DistTensorBase<T>&
+DistTensorBase<T>::operator=( DistTensorBase<T>&& A )
+{
+#ifndef RELEASE
+    AssertNotLocked();
+#endif
+    if( &A == this )
+        return *this;
+    if( Viewing() || A.Viewing() || Grid() != A.Grid() )
+    {
+        *this = static_cast<const DistTensorBase<T>&>(A);
+        return *this;
+    }
+    // Our old storage goes away with tmp
+    DistTensorBase<T> tmp( std::move(A) );
+    Swap( tmp );
+    return *this;
+}
+
 #define FULL(T) \
     template class DistTensorBase<T>;
 
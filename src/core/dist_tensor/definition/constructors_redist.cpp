@@ -41,21 +41,21 @@ DistTensor<T>::DistTensor
 template<typename T>
 DistTensor<T>::DistTensor
 ( const ObjShape& shape, const TensorDistribution& dist, const std::vector<Unsigned>& modeAlignments,
-  const std::vector<Unsigned>& strides, const rote::Grid& g )
+  const std::vector<Offset>& strides, const rote::Grid& g )
 : DistTensorBase<T>(shape, dist, modeAlignments, strides, g)
 { }
 
 template<typename T>
 DistTensor<T>::DistTensor
 ( const ObjShape& shape, const TensorDistribution& dist, const std::vector<Unsigned>& modeAlignments,
-  const T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g )
+  const T* buffer, const std::vector<Offset>& strides, const rote::Grid& g )
 : DistTensorBase<T>(shape, dist, modeAlignments, buffer, strides, g)
 { }
 
 template<typename T>
 DistTensor<T>::DistTensor
 ( const ObjShape& shape, const TensorDistribution& dist, const std::vector<Unsigned>& modeAlignments,
-  T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g )
+  T* buffer, const std::vector<Offset>& strides, const rote::Grid& g )
 : DistTensorBase<T>(shape, dist, modeAlignments, buffer, strides, g)
 { }
 
@@ -84,24 +84,50 @@ DistTensor<T>::DistTensor
 template<typename T>
 DistTensor<T>::DistTensor
 ( const ObjShape& shape, const std::string& dist, const std::vector<Unsigned>& modeAlignments,
-  const std::vector<Unsigned>& strides, const rote::Grid& g )
+  const std::vector<Offset>& strides, const rote::Grid& g )
 : DistTensorBase<T>(shape, dist, modeAlignments, strides, g)
 { }
 
 template<typename T>
 DistTensor<T>::DistTensor
 ( const ObjShape& shape, const std::string& dist, const std::vector<Unsigned>& modeAlignments,
-  const T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g )
+  const T* buffer, const std::vector<Offset>& strides, const rote::Grid& g )
 : DistTensorBase<T>(shape, dist, modeAlignments, buffer, strides, g)
 { }
 
 template<typename T>
 DistTensor<T>::DistTensor
 ( const ObjShape& shape, const std::string& dist, const std::vector<Unsigned>& modeAlignments,
-  T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g )
+  T* buffer, const std::vector<Offset>& strides, const rote::Grid& g )
 : DistTensorBase<T>(shape, dist, modeAlignments, buffer, strides, g)
 { }
 
+template<typename T>
+DistTensor<T>::DistTensor( const DistTensor<T>& A )
+: DistTensorBase<T>(A)
+{ }
+
+template<typename T>
+DistTensor<T>::DistTensor( DistTensor<T>&& A )
+: DistTensorBase<T>(std::move(A))
+{ }
+
+template<typename T>
+const DistTensor<T>&
+DistTensor<T>::operator=( const DistTensor<T>& A )
+{
+    DistTensorBase<T>::operator=( A );
+    return *this;
+}
+
+template<typename T>
+DistTensor<T>&
+DistTensor<T>::operator=( DistTensor<T>&& A )
+{
+    DistTensorBase<T>::operator=( std::move(A) );
+    return *this;
+}
+
 template<typename T>
 DistTensor<T>::~DistTensor()
 { }
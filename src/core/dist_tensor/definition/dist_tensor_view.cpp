@@ -0,0 +1,143 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "rote.hpp"
+
+namespace rote {
+
+template<typename T>
+DistTensorView<T>::DistTensorView()
+: parent_(0), locked_(false)
+{ }
+
+template<typename T>
+DistTensorView<T>::DistTensorView( DistTensor<T>& A )
+: parent_(&A), locked_(false), offsets_(A.Order(), 0), shape_(A.Shape())
+{ }
+
+template<typename T>
+DistTensorView<T>::DistTensorView( const DistTensor<T>& A )
+: parent_(const_cast<DistTensor<T>*>(&A)), locked_(true),
+  offsets_(A.Order(), 0), shape_(A.Shape())
+{ }
+
+template<typename T>
+Unsigned
+DistTensorView<T>::Order() const
+{ return shape_.size(); }
+
+template<typename T>
+const ObjShape&
+DistTensorView<T>::Shape() const
+{ return shape_; }
+
+template<typename T>
+Unsigned
+DistTensorView<T>::Dimension( Mode mode ) const
+{ return shape_[mode]; }
+
+template<typename T>
+const Location&
+DistTensorView<T>::Offsets() const
+{ return offsets_; }
+
+template<typename T>
+bool
+DistTensorView<T>::Locked() const
+{ return locked_; }
+
+template<typename T>
+const DistTensor<T>&
+DistTensorView<T>::Parent() const
+{
+#ifndef RELEASE
+    if( parent_ == 0 )
+        LogicError("DistTensorView does not view anything");
+#endif
+    return *parent_;
+}
+
+template<typename T>
+const rote::Grid&
+DistTensorView<T>::Grid() const
+{ return Parent().Grid(); }
+
+template<typename T>
+TensorDistribution
+DistTensorView<T>::TensorDist() const
+{ return Parent().TensorDist(); }
+
+template<typename T>
+bool
+DistTensorView<T>::OutOfCore() const
+{ return Parent().OutOfCore(); }
+
+////////////////////////////////
+// Redistribution into the window
+////////////////////////////////
+
+template<typename T>
+void
+DistTensorView<T>::RedistFrom
+( const DistTensor<T>& A, const ModeArray& reduceModes,
+  const T alpha, const T beta ) const
+{
+    DistTensor<T> B(TensorDist(), Grid());
+    View(B, *this);
+    B.RedistFrom(A, reduceModes, alpha, beta);
+}
+
+template<typename T>
+void
+DistTensorView<T>::RedistFrom( const DistTensor<T>& A ) const
+{
+    DistTensor<T> B(TensorDist(), Grid());
+    View(B, *this);
+    B.RedistFrom(A);
+}
+
+template<typename T>
+void
+DistTensorView<T>::RedistributeFrom( const DistTensor<T>& A ) const
+{ RedistFrom(A); }
+
+template<typename T>
+void
+DistTensorView<T>::ReduceFrom
+( const DistTensor<T>& A, const ModeArray& reduceModes,
+  const T alpha, const T beta ) const
+{ RedistFrom(A, reduceModes, alpha, beta); }
+
+template<typename T>
+void
+DistTensorView<T>::ReduceFrom
+( const DistTensor<T>& A, const Mode& reduceMode,
+  const T alpha, const T beta ) const
+{
+    ModeArray reduceModes(1);
+    reduceModes[0] = reduceMode;
+    RedistFrom(A, reduceModes, alpha, beta);
+}
+
+#define FULL(T) \
+    template class DistTensorView<T>;
+
+FULL(Int)
+#ifndef DISABLE_FLOAT
+FULL(float)
+#endif
+FULL(double)
+
+#ifndef DISABLE_COMPLEX
+#ifndef DISABLE_FLOAT
+FULL(std::complex<float>)
+#endif
+FULL(std::complex<double>)
+#endif
+
+} // namespace rote
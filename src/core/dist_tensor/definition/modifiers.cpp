@@ -97,7 +97,7 @@ template<typename T>
 void
 DistTensorBase<T>::Attach
 ( const ObjShape& shape, const std::vector<Unsigned>& modeAlignments,
-  T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g )
+  T* buffer, const std::vector<Offset>& strides, const rote::Grid& g )
 {
     Empty();
 
@@ -108,7 +108,7 @@ DistTensorBase<T>::Attach
     SetShifts();
     if( Participating() )
     {
-        ObjShape localShape = Lengths(shape, ModeShifts(), ModeStrides());
+        ObjShape localShape = BlockLengths(shape, ModeShifts(), ModeStrides(), dist_.BlockSizes());
         tensor_.Attach( localPerm_.applyTo(localShape), buffer, strides );
     }
 }
@@ -117,14 +117,14 @@ template<typename T>
 void
 DistTensorBase<T>::LockedAttach
 ( const ObjShape& shape, const std::vector<Unsigned>& modeAlignments,
-  const T* buffer, const std::vector<Unsigned>& strides, const rote::Grid& g )
+  const T* buffer, const std::vector<Offset>& strides, const rote::Grid& g )
 {
     grid_ = &g;
     shape_ = shape;
     modeAlignments_ = modeAlignments;
     SetShifts();
     if(Participating() ){
-        ObjShape localShape = Lengths(shape, ModeShifts(), ModeStrides());
+        ObjShape localShape = BlockLengths(shape, ModeShifts(), ModeStrides(), dist_.BlockSizes());
         tensor_.LockedAttach(localShape, buffer, strides);
     }
 }
@@ -133,7 +133,7 @@ template<typename T>
 void
 DistTensorBase<T>::LockedAttach
 ( const ObjShape& shape, const std::vector<Unsigned>& modeAlignments,
-  const T* buffer, const Permutation& perm, const std::vector<Unsigned>& strides, const rote::Grid& g )
+  const T* buffer, const Permutation& perm, const std::vector<Offset>& strides, const rote::Grid& g )
 {
     grid_ = &g;
     shape_ = shape;
@@ -142,7 +142,7 @@ DistTensorBase<T>::LockedAttach
     SetShifts();
     if(Participating() ){
         //Account for local permutation
-        ObjShape localShape = localPerm_.applyTo(Lengths(shape, ModeShifts(), ModeStrides()));
+        ObjShape localShape = localPerm_.applyTo(BlockLengths(shape, ModeShifts(), ModeStrides(), dist_.BlockSizes()));
         tensor_.LockedAttach(localShape, buffer, strides);
     }
 }
@@ -170,20 +170,20 @@ DistTensorBase<T>::ResizeTo( const ObjShape& shape )
     }
     if(Participating() && viewType_ == OWNER){
         //Account for local permutation
-        tensor_.ResizeTo(localPerm_.applyTo(Lengths(shape, modeShifts_, gridView_.ParticipatingShape())));
+        tensor_.ResizeTo(localPerm_.applyTo(BlockLengths(shape, modeShifts_, gridView_.ParticipatingShape(), dist_.BlockSizes())));
     }
 }
 
 template<typename T>
 void
-DistTensorBase<T>::ResizeTo( const ObjShape& shape, const std::vector<Unsigned>& strides )
+DistTensorBase<T>::ResizeTo( const ObjShape& shape, const std::vector<Offset>& strides )
 {
 #ifndef RELEASE
     AssertNotLocked();
 #endif
     shape_ = shape;
     if(Participating()){
-        tensor_.ResizeTo(Lengths(shape, ModeShifts(), ModeStrides()), strides);
+        tensor_.ResizeTo(BlockLengths(shape, ModeShifts(), ModeStrides(), dist_.BlockSizes()), strides);
     }
 }
 
@@ -199,7 +199,7 @@ DistTensorBase<T>::Set( const Location& loc, T u )
     const Location owningProc = DetermineOwner(loc);
     const GridView gv = GetGridView();
 
-    if(!AnyElemwiseNotEqual(gv.ParticipatingLoc(), owningProc)){
+    if(!AnyElemwiseNotEqual(gv.ParticipatingLoc(), owningProc) && NodeLeader()){
         const Location localLoc = Global2LocalIndex(loc);
         SetLocal(localPerm_.applyTo(localLoc), u);
     }
@@ -214,7 +214,7 @@ DistTensorBase<T>::Update( const Location& loc, T u )
 #endif
     const GridView gv = GetGridView();
     const Location owningProc = DetermineOwner(loc);
-    if(!AnyElemwiseNotEqual(gv.ParticipatingLoc(), owningProc)){
+    if(!AnyElemwiseNotEqual(gv.ParticipatingLoc(), owningProc) && NodeLeader()){
         const Location localLoc = Global2LocalIndex(loc);
         UpdateLocal(localLoc, u);
     }
@@ -434,6 +434,69 @@ DistTensorBase<T>::EmptyData()
     viewType_ = OWNER;
 }
 
+template<typename T>
+void
+DistTensorBase<T>::SetAllocationPolicy( const AllocationPolicy& policy )
+{ tensor_.SetAllocationPolicy( policy ); }
+
+template<typename T>
+AllocationPolicy
+DistTensorBase<T>::GetAllocationPolicy() const
+{ return tensor_.GetAllocationPolicy(); }
+
+template<typename T>
+void
+DistTensorBase<T>::SetOutOfCore( const std::string& dir )
+{ tensor_.SetOutOfCore( dir ); }
+
+template<typename T>
+void
+DistTensorBase<T>::SetInCore()
+{ tensor_.SetInCore(); }
+
+template<typename T>
+bool
+DistTensorBase<T>::OutOfCore() const
+{ return tensor_.OutOfCore(); }
+
+template<typename T>
+void
+DistTensorBase<T>::SetNodeShared()
+{
+    //Grid modes neither bound to a tensor mode nor ignored replicate the entries
+    const ModeDistribution boundModes = dist_.UsedModes();
+    const ModeDistribution ignoredModes = dist_.UnusedModes();
+    ModeArray replicatedModes;
+    for(Unsigned i = 0; i < Grid().Order(); i++)
+        if(!boundModes.Contains(i) && !ignoredModes.Contains(i))
+            replicatedModes.push_back(i);
+    if(replicatedModes.size() == 0){
+        SetNodePrivate();
+        return;
+    }
+    tensor_.SetNodeShared(GetNodeCommunicatorForModes(replicatedModes, Grid()));
+}
+
+template<typename T>
+void
+DistTensorBase<T>::SetNodePrivate()
+{ tensor_.SetNodeShared( mpi::COMM_NULL ); }
+
+template<typename T>
+bool
+DistTensorBase<T>::NodeShared() const
+{ return tensor_.NodeShared(); }
+
+template<typename T>
+bool
+DistTensorBase<T>::NodeLeader() const
+{ return tensor_.NodeLeader(); }
+
+template<typename T>
+void
+DistTensorBase<T>::NodeSync() const
+{ tensor_.NodeSync(); }
+
 template<typename T>
 void
 DistTensorBase<T>::SetLocal( const Location& loc, T alpha )
@@ -27,7 +27,7 @@ DistTensorBase<T>::DetermineOwner(const Location& loc) const
     Location ownerLoc = Alignments();
 
     for(i = 0; i < gv.ParticipatingOrder(); i++){
-        ownerLoc[i] = (loc[i] + ModeAlignment(i)) % ModeStride(i);
+        ownerLoc[i] = BlockOwner(loc[i], ModeAlignment(i), ModeStride(i), dist_[i].BlockSize());
     }
     return ownerLoc;
 }
@@ -41,7 +41,7 @@ DistTensorBase<T>::DetermineOwnerNewAlignment(const Location& loc, std::vector<U
     Location ownerLoc = Alignments();
 
     for(i = 0; i < gv.ParticipatingOrder(); i++){
-        ownerLoc[i] = (loc[i] + newAlignment[i]) % ModeStride(i);
+        ownerLoc[i] = BlockOwner(loc[i], newAlignment[i], ModeStride(i), dist_[i].BlockSize());
     }
     return ownerLoc;
 }
@@ -57,7 +57,7 @@ DistTensorBase<T>::Global2LocalIndex(const Location& globalLoc) const
     Unsigned i;
     Location localLoc(globalLoc.size());
     for(i = 0; i < globalLoc.size(); i++){
-        localLoc[i] = (globalLoc[i]-ModeShift(i) + ModeAlignment(i)) / ModeStride(i);
+        localLoc[i] = BlockGlobal2Local(globalLoc[i], ModeStride(i), dist_[i].BlockSize());
     }
     return localLoc;
 }
@@ -66,30 +66,15 @@ template<typename T>
 mpi::Comm
 DistTensorBase<T>::GetCommunicatorForModes(const ModeArray& commModes, const rote::Grid& grid)
 {
-    ModeArray sortedCommModes = commModes;
-    SortVector(sortedCommModes);
-
-    if(commMap_->count(sortedCommModes) == 0){
-        mpi::Comm comm;
-        const Location gridLoc = grid.Loc();
-        const ObjShape gridShape = grid.Shape();
-
-        //Determine which communicator subgroup I belong to
-        ObjShape gridSliceNegShape = NegFilterVector(gridShape, sortedCommModes);
-        Location gridSliceNegLoc = NegFilterVector(gridLoc, sortedCommModes);
-
-        //Determine my rank within the communicator subgroup I belong to
-        ObjShape gridSliceShape = FilterVector(gridShape, sortedCommModes);
-        Location gridSliceLoc = FilterVector(gridLoc, sortedCommModes);
-
-        //Set the comm key and color for splitting
-        const Unsigned commKey = Loc2LinearLoc(gridSliceLoc, gridSliceShape);
-        const Unsigned commColor = Loc2LinearLoc(gridSliceNegLoc, gridSliceNegShape);
+    return grid.SubComm(commModes);
+}
 
-        mpi::CommSplit(grid.OwningComm(), commColor, commKey, comm);
-        (*commMap_)[sortedCommModes] = comm;
-    }
-    return (*commMap_)[sortedCommModes];
+//Processes of the communicator for commModes that share our node
+template<typename T>
+mpi::Comm
+DistTensorBase<T>::GetNodeCommunicatorForModes(const ModeArray& commModes, const rote::Grid& grid)
+{
+    return grid.NodeSubComm(commModes);
 }
 
 template<typename T>
@@ -110,24 +95,6 @@ DistTensorBase<T>::CopyLocalBuffer(const DistTensorBase<T>& A)
     tensor_.CopyBuffer(A.LockedTensor(), A.localPerm_, localPerm_);
 }
 
-template<typename T>
-void
-DistTensorBase<T>::ClearCommMap()
-{
-    rote::mpi::CommMap::iterator it;
-    for(it = commMap_->begin(); it != commMap_->end(); it++){
-        mpi::CommFree(it->second);
-    }
-    commMap_->clear();
-}
-
-template<typename T>
-Unsigned
-DistTensorBase<T>::CommMapSize()
-{
-    return commMap_->size();
-}
-
 template<typename T>
 Location
 DistTensorBase<T>::DetermineFirstElem(const Location& gridViewLoc) const
@@ -142,6 +109,7 @@ DistTensorBase<T>::DetermineFirstElem(const Location& gridViewLoc) const
 
         if(gridViewLoc[i] < modeAlignments_[i])
             ret[i] += ModeStride(i);
+        ret[i] *= dist_[i].BlockSize();
     }
 //    Location ret(gridViewLoc.size());
 //    for(i = 0; i < gridViewLoc.size(); i++){
@@ -158,14 +126,14 @@ DistTensorBase<T>::DetermineFirstUnalignedElem(const Location& gridViewLoc, cons
     Unsigned i;
     Location ret(gridViewLoc.size());
     for(i = 0; i < gridViewLoc.size(); i++){
-        ret[i] = Shift(gridViewLoc[i], alignmentDiff[i], ModeStride(i));
+        ret[i] = Shift(gridViewLoc[i], alignmentDiff[i], ModeStride(i)) * dist_[i].BlockSize();
     }
     return ret;
 }
 
 template<typename T>
 bool
-DistTensor<T>::AlignCommBufRedist(const DistTensor<T>& A, const T* unalignedSendBuf, const Unsigned sendSize, T* alignedSendBuf, const Unsigned recvSize)
+DistTensor<T>::AlignCommBufRedist(const DistTensor<T>& A, const T* unalignedSendBuf, const Offset sendSize, T* alignedSendBuf, const Offset recvSize)
 {
     const rote::Grid& g = this->Grid();
     GridView gvA = A.GetGridView();
@@ -48,8 +48,8 @@ void DistTensor<T>::AllToAllCommRedist(const DistTensor<T>& A, const ModeArray&
         const std::vector<Unsigned> localPackStrides = ElemwiseDivide(LCMs(gvBShape, gvAShape), gvAShape);
         const ObjShape commDataShape = IntCeils(maxLocalShapeA, localPackStrides);
 
-        const Unsigned sendSize = prod(commDataShape);
-        const Unsigned recvSize = sendSize;
+        const Offset sendSize = prod(commDataShape);
+        const Offset recvSize = sendSize;
 
         T* auxBuf = this->auxMemory_.Require((sendSize + recvSize) * nRedistProcs);
 
@@ -79,7 +79,8 @@ void DistTensor<T>::AllToAllCommRedist(const DistTensor<T>& A, const ModeArray&
             recvBuf = &(alignSendBuf[0]);
         }
 
-        mpi::AllToAll(sendBuf, sendSize, recvBuf, recvSize, comm);
+        if(!this->AllToAllRMA(A, commModes, sendBuf, recvBuf, sendSize, comm))
+            mpi::HierarchicalAllToAll(sendBuf, sendSize, recvBuf, recvSize, comm);
         PROFILE_STOP;
 
 //        ObjShape recvShape = commDataShape;
@@ -97,6 +98,72 @@ void DistTensor<T>::AllToAllCommRedist(const DistTensor<T>& A, const ModeArray&
         this->auxMemory_.Release();
 }
 
+template <typename T>
+bool DistTensor<T>::AllToAllRMA(const DistTensor<T>& A, const ModeArray& commModes, const T* sendBuf, T* recvBuf, Offset blockSize, mpi::Comm comm){
+    const RMAEpoch epoch = rote::AllToAllRMA();
+    if(epoch == RMA_OFF)
+        return false;
+
+    Unsigned i, j;
+    const rote::Grid& g = this->Grid();
+    const Location myGridLoc = g.Loc();
+    const int nRedistProcs = mpi::CommSize(comm);
+    const int myRank = mpi::CommRank(comm);
+
+    ModeArray sortedCommModes = commModes;
+    SortVector(sortedCommModes);
+    const ObjShape commShape = FilterVector(g.Shape(), sortedCommModes);
+
+    //Who puts blocks into our buffer, and whom we put our blocks into
+    std::vector<int> origins, targets;
+    Location firstLoc;
+    for(i = 0; i < Unsigned(nRedistProcs); i++){
+        if(this->A2ACommRecvFirstLoc(A, commModes, myGridLoc, i, firstLoc))
+            origins.push_back(i);
+
+        const Location commLoc = LinearLoc2Loc(i, commShape);
+        Location procGridLoc = myGridLoc;
+        for(j = 0; j < sortedCommModes.size(); j++)
+            procGridLoc[sortedCommModes[j]] = commLoc[j];
+        if(this->A2ACommRecvFirstLoc(A, commModes, procGridLoc, myRank, firstLoc))
+            targets.push_back(i);
+    }
+
+    //Every process has to take the same path
+    const int myPeers = Max(origins.size(), targets.size());
+    const int maxPeers = mpi::AllReduce(myPeers, mpi::MAX, comm);
+    if(maxPeers > AllToAllRMAPeerFraction() * nRedistProcs)
+        return false;
+
+    mpi::Window win;
+    mpi::WindowCreate(recvBuf, blockSize * nRedistProcs * sizeof(T), sizeof(T), comm, win);
+    mpi::Group commGroup, originGroup, targetGroup;
+    if(epoch == RMA_FENCE)
+        mpi::WindowFence(win);
+    else{
+        mpi::CommGroup(comm, commGroup);
+        mpi::GroupIncl(commGroup, origins.size(), origins.data(), originGroup);
+        mpi::GroupIncl(commGroup, targets.size(), targets.data(), targetGroup);
+        mpi::WindowPost(originGroup, win);
+        mpi::WindowStart(targetGroup, win);
+    }
+
+    for(i = 0; i < targets.size(); i++)
+        mpi::Put(&(sendBuf[targets[i] * blockSize]), blockSize, targets[i], myRank * blockSize, win);
+
+    if(epoch == RMA_FENCE)
+        mpi::WindowFence(win);
+    else{
+        mpi::WindowComplete(win);
+        mpi::WindowWait(win);
+        mpi::GroupFree(targetGroup);
+        mpi::GroupFree(originGroup);
+        mpi::GroupFree(commGroup);
+    }
+    mpi::WindowFree(win);
+    return true;
+}
+
 template <typename T>
 void DistTensor<T>::PackA2ACommSendBuf(const DistTensor<T>& A, const ModeArray& commModes, const ObjShape& sendShape, T * const sendBuf){
     const Unsigned order = A.Order();
@@ -115,7 +182,7 @@ void DistTensor<T>::PackA2ACommSendBuf(const DistTensor<T>& A, const ModeArray&
     const std::vector<Unsigned> commLCMs = LCMs(gvAShape, gvBShape);
     const std::vector<Unsigned> modeStrideFactor = ElemwiseDivide(commLCMs, gvAShape);
 
-    const Unsigned nElemsPerProc = prod(sendShape);
+    const Offset nElemsPerProc = prod(sendShape);
 
     //Grid information
     const rote::Grid& g = this->Grid();
@@ -176,14 +243,15 @@ void DistTensor<T>::PackA2ACommSendBuf(const DistTensor<T>& A, const ModeArray&
         if(found && ElemwiseLessThan(firstSendLoc, this->Shape())){
             //Determine where the initial piece of data is located.
             const Location localLoc = A.Global2LocalIndex(firstSendLoc);
-            Unsigned dataBufPtr = LinearLocFromStrides(A.localPerm_.applyTo(localLoc), A.LocalStrides());
+            Offset dataBufPtr = LinearLocFromStrides(A.localPerm_.applyTo(localLoc), A.LocalStrides());
 
             PackData packData;
-            packData.srcBufStrides = ElemwiseProd(A.LocalStrides(), A.localPerm_.applyTo(modeStrideFactor));
+            const std::vector<Unsigned> localStrideFactor = A.localPerm_.applyTo(modeStrideFactor);
+            packData.srcBufStrides = ElemwiseProd(A.LocalStrides(), std::vector<Offset>(localStrideFactor.begin(), localStrideFactor.end()));
 
             //Pack into permuted form to minimize striding when unpacking
             ObjShape finalShape = this->localPerm_.applyTo(sendShape);
-            std::vector<Unsigned> finalStrides = Dimensions2Strides(finalShape);
+            std::vector<Offset> finalStrides = Dimensions2Strides(finalShape);
 
             //Determine permutation from local output to local input
             Permutation out2in = A.localPerm_.PermutationTo(this->localPerm_).InversePermutation();
@@ -217,7 +285,7 @@ void DistTensor<T>::UnpackA2ACommRecvBuf(const T * const recvBuf, const ModeArra
     std::vector<Unsigned> commLCMs = rote::LCMs(gvAShape, gvBShape);
     std::vector<Unsigned> modeStrideFactor = ElemwiseDivide(commLCMs, gvBShape);
 
-    const Unsigned nElemsPerProc = prod(recvShape);
+    const Offset nElemsPerProc = prod(recvShape);
 
     //Grid information
     const rote::Grid& g = this->Grid();
@@ -226,67 +294,19 @@ void DistTensor<T>::UnpackA2ACommRecvBuf(const T * const recvBuf, const ModeArra
 
     const Unsigned nRedistProcsAll = Max(1, prod(FilterVector(gridShape, commModes)));
 
-    //Redistribute information
-    ModeArray sortedCommModes = commModes;
-    SortVector(sortedCommModes);
-    const ObjShape commShape = FilterVector(gridShape, sortedCommModes);
-
     //For each process we recv from, we need to determine the first element we get from them
     PARALLEL_FOR
     for(Unsigned i = 0; i < nRedistProcsAll; i++){
-        Unsigned j;
-        //Invert the process order based on the communicator used, to the actual process location
-        Location sortedCommLoc = LinearLoc2Loc(i, commShape);
-        Location procGridLoc = myGridLoc;
-
-        for(j = 0; j < sortedCommModes.size(); j++){
-            procGridLoc[sortedCommModes[j]] = sortedCommLoc[j];
-        }
-
-        //Get my first elem location
-        Location myFirstLoc = this->DetermineFirstElem(this->GetGridView().ParticipatingLoc());
-
-        //Determine what grid location p_i corresponds to BEFORE alignment has been performed
-        //so we correctly determine what elements to unpack
-        Location firstOwnerB = gvB.ToGridLoc(this->Alignments());
-        Location unpackProcGVA = g.ToParticipatingGridViewLoc(procGridLoc, gvA);
-        std::vector<Unsigned> alignBinA = g.ToParticipatingGridViewLoc(firstOwnerB, gvA);
-        Location myFirstElemLocAligned = A.DetermineFirstUnalignedElem(unpackProcGVA, alignBinA);
-        Location procLocBeforeRealign = gvA.ToGridLoc(A.DetermineOwner(myFirstElemLocAligned));
-
-        Location procFirstLoc = A.DetermineFirstElem(g.ToParticipatingGridViewLoc(procLocBeforeRealign, gvA));
-
-        //Iterate to figure out the first elem I need from p_i
-        Location firstRecvLoc(order,-1);
-
-        bool found = true;
-        for(j = 0; j < myFirstLoc.size(); j++){
-            Unsigned myFirstIndex = myFirstLoc[j];
-            Unsigned recvFirstIndex = procFirstLoc[j];
-            Unsigned myModeStride = this->ModeStride(j);
-            Unsigned recvProcModeStride = A.ModeStride(j);
-
-            while(myFirstIndex != recvFirstIndex && myFirstIndex < this->Dimension(j)){
-                if(myFirstIndex < recvFirstIndex)
-                    myFirstIndex += myModeStride;
-                else
-                    recvFirstIndex += recvProcModeStride;
-            }
-            if(myFirstIndex >= this->Dimension(j)){
-                found &= false;
-                break;
-            }
-            firstRecvLoc[j] = myFirstIndex;
-        }
-
         //Unpack the data if we need to recv data from p_i
-        if(found && ElemwiseLessThan(firstRecvLoc, this->Shape())){
+        Location firstRecvLoc;
+        if(this->A2ACommRecvFirstLoc(A, commModes, myGridLoc, i, firstRecvLoc)){
             //Determine where to place the initial piece of data.
             const Location localLoc = this->Global2LocalIndex(firstRecvLoc);
-            Unsigned dataBufPtr = LinearLocFromStrides(this->localPerm_.applyTo(localLoc), this->LocalStrides());
+            Offset dataBufPtr = LinearLocFromStrides(this->localPerm_.applyTo(localLoc), this->LocalStrides());
 
             PackData unpackData;
-            unpackData.dstBufStrides = ElemwiseProd(this->LocalStrides(), this->localPerm_.applyTo(modeStrideFactor));
+            const std::vector<Unsigned> localStrideFactor = this->localPerm_.applyTo(modeStrideFactor);
+            unpackData.dstBufStrides = ElemwiseProd(this->LocalStrides(), std::vector<Offset>(localStrideFactor.begin(), localStrideFactor.end()));
 
             //Recv data is permuted the same way our local data is permuted
             ObjShape actualRecvShape = this->localPerm_.applyTo(recvShape);
@@ -308,6 +328,67 @@ void DistTensor<T>::UnpackA2ACommRecvBuf(const T * const recvBuf, const ModeArra
     }
 }
 
+template<typename T>
+bool DistTensor<T>::A2ACommRecvFirstLoc(const DistTensor<T>& A, const ModeArray& commModes, const Location& recvGridLoc, Unsigned i, Location& firstRecvLoc) const{
+    Unsigned j;
+    const Unsigned order = A.Order();
+
+    //GridView information
+    const rote::GridView gvA = A.GetGridView();
+    const rote::GridView gvB = this->GetGridView();
+
+    //Grid information
+    const rote::Grid& g = this->Grid();
+    const ObjShape gridShape = g.Shape();
+
+    //Redistribute information
+    ModeArray sortedCommModes = commModes;
+    SortVector(sortedCommModes);
+    const ObjShape commShape = FilterVector(gridShape, sortedCommModes);
+
+    //Invert the process order based on the communicator used, to the actual process location
+    Location sortedCommLoc = LinearLoc2Loc(i, commShape);
+    Location procGridLoc = recvGridLoc;
+
+    for(j = 0; j < sortedCommModes.size(); j++){
+        procGridLoc[sortedCommModes[j]] = sortedCommLoc[j];
+    }
+
+    //Get the receiver's first elem location
+    Location myFirstLoc = this->DetermineFirstElem(g.ToParticipatingGridViewLoc(recvGridLoc, gvB));
+
+    //Determine what grid location p_i corresponds to BEFORE alignment has been performed
+    //so we correctly determine what elements to unpack
+    Location firstOwnerB = gvB.ToGridLoc(this->Alignments());
+    Location unpackProcGVA = g.ToParticipatingGridViewLoc(procGridLoc, gvA);
+    std::vector<Unsigned> alignBinA = g.ToParticipatingGridViewLoc(firstOwnerB, gvA);
+    Location myFirstElemLocAligned = A.DetermineFirstUnalignedElem(unpackProcGVA, alignBinA);
+    Location procLocBeforeRealign = gvA.ToGridLoc(A.DetermineOwner(myFirstElemLocAligned));
+
+    Location procFirstLoc = A.DetermineFirstElem(g.ToParticipatingGridViewLoc(procLocBeforeRealign, gvA));
+
+    //Iterate to figure out the first elem the receiver needs from p_i
+    firstRecvLoc.assign(order, -1);
+
+    for(j = 0; j < myFirstLoc.size(); j++){
+        Unsigned myFirstIndex = myFirstLoc[j];
+        Unsigned recvFirstIndex = procFirstLoc[j];
+        Unsigned myModeStride = this->ModeStride(j);
+        Unsigned recvProcModeStride = A.ModeStride(j);
+
+        while(myFirstIndex != recvFirstIndex && myFirstIndex < this->Dimension(j)){
+            if(myFirstIndex < recvFirstIndex)
+                myFirstIndex += myModeStride;
+            else
+                recvFirstIndex += recvProcModeStride;
+        }
+        if(myFirstIndex >= this->Dimension(j))
+            return false;
+        firstRecvLoc[j] = myFirstIndex;
+    }
+    return ElemwiseLessThan(firstRecvLoc, this->Shape());
+}
+
 #define FULL(T) \
     template class DistTensor<T>;
 
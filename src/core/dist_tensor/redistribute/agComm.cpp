@@ -48,8 +48,8 @@ DistTensor<T>::AllGatherCommRedist(const DistTensor<T>& A, const ModeArray& comm
   const Unsigned nRedistProcs = Max(1, prod(FilterVector(g.Shape(), commModes)));
   const ObjShape commDataShape = A.MaxLocalShape();
 
-  const Unsigned sendSize = prod(commDataShape);
-  const Unsigned recvSize = sendSize * nRedistProcs;
+  const Offset sendSize = prod(commDataShape);
+  const Offset recvSize = sendSize * nRedistProcs;
 
   T* auxBuf = this->auxMemory_.Require(sendSize + recvSize);
 
@@ -76,7 +76,7 @@ DistTensor<T>::AllGatherCommRedist(const DistTensor<T>& A, const ModeArray& comm
         recvBuf = &(alignSendBuf[0]);
 	}
 
-	mpi::AllGather(sendBuf, sendSize, recvBuf, sendSize, comm);
+	mpi::HierarchicalAllGather(sendBuf, sendSize, recvBuf, sendSize, comm);
     PROFILE_STOP;
 
     PROFILE_SECTION("AGUnpack");
@@ -97,7 +97,7 @@ void DistTensor<T>::PackAGCommSendBuf(const DistTensor<T>& A, T * const sendBuf)
 
   //Pack into permuted form to minimize striding when unpacking
   ObjShape finalShape = this->localPerm_.applyTo(A.MaxLocalShape());
-  std::vector<Unsigned> finalStrides = Dimensions2Strides(finalShape);
+  std::vector<Offset> finalStrides = Dimensions2Strides(finalShape);
 
   //Determine permutation from local output to local input
   Permutation out2in = A.localPerm_.PermutationTo(this->localPerm_).InversePermutation();
@@ -30,8 +30,8 @@ void DistTensor<T>::AllReduceUpdateCommRedist(const T alpha, const DistTensor<T>
 
   //Determine buffer sizes for communication
   const ObjShape commDataShape = this->MaxLocalShape();
-  const Unsigned sendSize = prod(commDataShape);
-  const Unsigned recvSize = sendSize;
+  const Offset sendSize = prod(commDataShape);
+  const Offset recvSize = sendSize;
 
   T* auxBuf = this->auxMemory_.Require(sendSize + recvSize);
 	MemZero(&(auxBuf[0]), sendSize + recvSize);
@@ -61,7 +61,7 @@ void DistTensor<T>::AllReduceUpdateCommRedist(const T alpha, const DistTensor<T>
 		recvBuf = &(alignSendBuf[0]);
   }
 
-  mpi::AllReduce(sendBuf, recvBuf, recvSize, comm);
+  mpi::HierarchicalAllReduce(sendBuf, recvBuf, recvSize, comm);
   PROFILE_STOP;
 
   // PrintArray(recvBuf, commDataShape, "recvBuf");
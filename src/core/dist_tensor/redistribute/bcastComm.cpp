@@ -42,8 +42,8 @@ DistTensor<T>::BroadcastCommRedist(const DistTensor<T>& A, const ModeArray& comm
     //Determine buffer sizes for communication
     const ObjShape commDataShape = A.MaxLocalShape();
 
-    const Unsigned sendSize = prod(commDataShape);
-    const Unsigned recvSize = sendSize;
+    const Offset sendSize = prod(commDataShape);
+    const Offset recvSize = sendSize;
 
     T* auxBuf = this->auxMemory_.Require(sendSize + recvSize);
 
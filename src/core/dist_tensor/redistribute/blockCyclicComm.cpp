@@ -0,0 +1,292 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+                      2013, Jeff Hammond
+                      2013, Jed Brown
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "rote.hpp"
+
+namespace rote{
+
+namespace {
+
+// Wrapping of one tensor mode as seen from a given process
+struct ModeWrap
+{
+    Unsigned wrap, alignment, blockSize, loc, shift;
+};
+
+std::vector<ModeWrap>
+ModeWraps(const TensorDistribution& dist, const std::vector<Unsigned>& alignments, const Location& gridLoc, const ObjShape& gridShape){
+    const Unsigned order = dist.size() - 1;
+    std::vector<ModeWrap> wraps(order);
+    for(Unsigned i = 0; i < order; i++){
+        const ModeArray gridModes = dist[i].Entries();
+        const ObjShape modeGridShape = FilterVector(gridShape, gridModes);
+        wraps[i].wrap = gridModes.empty() ? 1 : prod(modeGridShape);
+        wraps[i].alignment = alignments[i];
+        wraps[i].blockSize = dist[i].BlockSize();
+        wraps[i].loc = gridModes.empty() ? 0 : Loc2LinearLoc(FilterVector(gridLoc, gridModes), modeGridShape);
+        wraps[i].shift = Shift(wraps[i].loc, wraps[i].alignment, wraps[i].wrap);
+    }
+    return wraps;
+}
+
+// Whether a process holds any of a tensor (it only lives where its unused
+// grid modes are 0)
+bool Participates(const TensorDistribution& dist, const Location& gridLoc){
+    const ModeArray unusedModes = dist.UnusedModes().Entries();
+    for(Unsigned i = 0; i < unusedModes.size(); i++)
+        if(gridLoc[unusedModes[i]] != 0)
+            return false;
+    return true;
+}
+
+// Whether the process at srcLoc is the one among the holders of each entry
+// of A that supplies the process at dstLoc: A is replicated over the grid
+// modes it does not bind, and each receiver takes from its own slice
+bool Supplies(const TensorDistribution& distA, const Location& srcLoc, const Location& dstLoc){
+    const ModeDistribution boundModes = distA.UsedModes();
+    const ModeDistribution unusedModes = distA.UnusedModes();
+    for(Unsigned i = 0; i < srcLoc.size(); i++)
+        if(!boundModes.Contains(i) && !unusedModes.Contains(i) && srcLoc[i] != dstLoc[i])
+            return false;
+    return true;
+}
+
+// Local indices along one mode of the entries 'from' holds that 'to' owns,
+// in increasing global order
+std::vector<Unsigned>
+SharedIndices(Unsigned dim, const ModeWrap& from, const ModeWrap& to){
+    std::vector<Unsigned> indices;
+    const Unsigned localDim = BlockLength(dim, from.shift, from.wrap, from.blockSize);
+    for(Unsigned i = 0; i < localDim; i++){
+        const Unsigned global = BlockLocal2Global(i, from.shift, from.wrap, from.blockSize);
+        if(BlockOwner(global, to.alignment, to.wrap, to.blockSize) == to.loc)
+            indices.push_back(i);
+    }
+    return indices;
+}
+
+// Offsets of the outer modes of the product of the index lists, and the
+// runs of consecutive indices along the innermost mode modeOrder[0].  Both
+// sides of a transfer enumerate the shared entries in this order.
+Offset
+ProductLayout(const std::vector<std::vector<Unsigned> >& indices, const ModeArray& modeOrder, const std::vector<Offset>& strides,
+              std::vector<Offset>& outerOffsets, std::vector<Unsigned>& runStarts, std::vector<Unsigned>& runLengths){
+    outerOffsets.assign(1, 0);
+    runStarts.clear();
+    runLengths.clear();
+    if(modeOrder.size() == 0){
+        runStarts.push_back(0);
+        runLengths.push_back(1);
+        return 1;
+    }
+    for(Unsigned i = modeOrder.size() - 1; i > 0; i--){
+        const std::vector<Unsigned>& modeIndices = indices[modeOrder[i]];
+        std::vector<Offset> offsets;
+        offsets.reserve(outerOffsets.size() * modeIndices.size());
+        for(Unsigned j = 0; j < outerOffsets.size(); j++)
+            for(Unsigned k = 0; k < modeIndices.size(); k++)
+                offsets.push_back(outerOffsets[j] + modeIndices[k] * strides[modeOrder[i]]);
+        outerOffsets.swap(offsets);
+    }
+    const std::vector<Unsigned>& inner = indices[modeOrder[0]];
+    for(Unsigned k = 0; k < inner.size(); k++){
+        if(k > 0 && inner[k] == inner[k-1] + 1)
+            runLengths.back()++;
+        else{
+            runStarts.push_back(inner[k]);
+            runLengths.push_back(1);
+        }
+    }
+    return outerOffsets.size() * inner.size();
+}
+
+} // anonymous namespace
+
+template <typename T>
+bool DistTensor<T>::CheckBlockCyclicCommRedist(const DistTensor<T>& A){
+	bool ret = true;
+	ret &= CheckOrder(this->Order(), A.Order());
+	ret &= (this->Grid() == A.Grid());
+	return ret;
+}
+
+//Redistributes between any two distributions of the same shape.  Every
+//process works out, mode by mode, which of its local entries each other
+//process owns under the target distribution; since ownership is decided
+//per mode these are products of per-mode index lists, and with block-cyclic
+//wrapping the lists are runs of whole blocks that are copied contiguously.
+//Of the processes sharing node-shared storage only the leader receives.
+template <typename T>
+void DistTensor<T>::BlockCyclicCommRedist(const DistTensor<T>& A, const T alpha, const T beta){
+#ifndef RELEASE
+    if(!CheckBlockCyclicCommRedist(A))
+        LogicError("BlockCyclicRedist: Invalid redistribution request");
+#endif
+    const rote::Grid& g = A.Grid();
+    const mpi::Comm comm = g.OwningComm();
+    const Unsigned nProcs = g.Size();
+    const ObjShape gridShape = g.Shape();
+    const Location myGridLoc = g.Loc();
+    const ObjShape shape = A.Shape();
+    const Unsigned order = A.Order();
+
+    const TensorDistribution distA = A.TensorDist();
+    const TensorDistribution distB = this->TensorDist();
+    const bool haveA = Participates(distA, myGridLoc);
+    const bool haveB = Participates(distB, myGridLoc) && this->NodeLeader();
+
+    //Which processes write their share of this tensor
+    std::vector<int> writers(nProcs, 1);
+    if(this->NodeShared()){
+        const int writer = this->NodeLeader() ? 1 : 0;
+        mpi::AllGather(&writer, 1, &(writers[0]), 1, comm);
+    }
+    const std::vector<ModeWrap> myWrapsA = ModeWraps(distA, A.Alignments(), myGridLoc, gridShape);
+    const std::vector<ModeWrap> myWrapsB = ModeWraps(distB, this->Alignments(), myGridLoc, gridShape);
+
+    //Enumerate in the order of A's local storage so that packing streams
+    const ModeArray modeOrder = A.localPerm_.Entries();
+    const std::vector<Offset> stridesA = A.localPerm_.InversePermutation().applyTo(A.LocalStrides());
+    const std::vector<Offset> stridesB = this->localPerm_.InversePermutation().applyTo(this->LocalStrides());
+
+    std::vector<std::vector<Unsigned> > sendIndices(nProcs * order), recvIndices(nProcs * order);
+    std::vector<Offset> sendCounts(nProcs, 0), recvCounts(nProcs, 0);
+    for(Unsigned p = 0; p < nProcs; p++){
+        const Location peerGridLoc = LinearLoc2Loc(p, gridShape);
+        if(haveA && writers[p] && Participates(distB, peerGridLoc) && Supplies(distA, myGridLoc, peerGridLoc)){
+            const std::vector<ModeWrap> peerWraps = ModeWraps(distB, this->Alignments(), peerGridLoc, gridShape);
+            Offset count = 1;
+            for(Unsigned i = 0; i < order; i++){
+                sendIndices[p*order + i] = SharedIndices(shape[i], myWrapsA[i], peerWraps[i]);
+                count *= sendIndices[p*order + i].size();
+            }
+            sendCounts[p] = count;
+        }
+        if(haveB && Participates(distA, peerGridLoc) && Supplies(distA, peerGridLoc, myGridLoc)){
+            const std::vector<ModeWrap> peerWraps = ModeWraps(distA, A.Alignments(), peerGridLoc, gridShape);
+            Offset count = 1;
+            for(Unsigned i = 0; i < order; i++){
+                recvIndices[p*order + i] = SharedIndices(shape[i], myWrapsB[i], peerWraps[i]);
+                count *= recvIndices[p*order + i].size();
+            }
+            recvCounts[p] = count;
+        }
+    }
+
+    std::vector<Offset> sendDispls(nProcs, 0), recvDispls(nProcs, 0);
+    Offset sendSize = 0, recvSize = 0;
+    for(Unsigned p = 0; p < nProcs; p++){
+        sendDispls[p] = sendSize;
+        recvDispls[p] = recvSize;
+        sendSize += sendCounts[p];
+        recvSize += recvCounts[p];
+    }
+    //Every process must take the large-count AllToAll if any one needs it
+    const int tooLarge = std::max(sendSize, recvSize) > static_cast<Offset>(mpi::MAX_MSG_COUNT) ? 1 : 0;
+    int anyTooLarge;
+    mpi::AllReduce(&tooLarge, &anyTooLarge, 1, mpi::MAX, comm);
+
+    T* auxBuf = this->auxMemory_.Require(sendSize + recvSize);
+    T* sendBuf = &(auxBuf[0]);
+    T* recvBuf = &(auxBuf[sendSize]);
+
+    std::vector<std::vector<Unsigned> > indices(order);
+    std::vector<Offset> outerOffsets;
+    std::vector<Unsigned> runStarts, runLengths;
+
+    //Pack the data
+    PROFILE_SECTION("BCPack");
+    const T* dataBuf = A.LockedBuffer();
+    const Offset innerStrideA = order > 0 ? stridesA[modeOrder[0]] : 1;
+    for(Unsigned p = 0; p < nProcs; p++){
+        if(sendCounts[p] == 0)
+            continue;
+        for(Unsigned i = 0; i < order; i++)
+            indices[i].swap(sendIndices[p*order + i]);
+        ProductLayout(indices, modeOrder, stridesA, outerOffsets, runStarts, runLengths);
+        T* packBuf = &(sendBuf[sendDispls[p]]);
+        for(Unsigned j = 0; j < outerOffsets.size(); j++){
+            for(Unsigned k = 0; k < runStarts.size(); k++){
+                const T* src = &(dataBuf[outerOffsets[j] + runStarts[k] * innerStrideA]);
+                if(innerStrideA == 1){
+                    MemCopy(packBuf, src, runLengths[k]);
+                    packBuf += runLengths[k];
+                }else{
+                    for(Unsigned e = 0; e < runLengths[k]; e++)
+                        *packBuf++ = src[e * innerStrideA];
+                }
+            }
+        }
+    }
+    PROFILE_STOP;
+
+    //Communicate the data
+    PROFILE_SECTION("BCComm");
+    if(anyTooLarge){
+        mpi::AllToAll(sendBuf, &(sendCounts[0]), &(sendDispls[0]),
+                      recvBuf, &(recvCounts[0]), &(recvDispls[0]), comm);
+    }else{
+        const std::vector<int> sendCountsInt(sendCounts.begin(), sendCounts.end());
+        const std::vector<int> recvCountsInt(recvCounts.begin(), recvCounts.end());
+        const std::vector<int> sendDisplsInt(sendDispls.begin(), sendDispls.end());
+        const std::vector<int> recvDisplsInt(recvDispls.begin(), recvDispls.end());
+        mpi::AllToAll(sendBuf, &(sendCountsInt[0]), &(sendDisplsInt[0]),
+                      recvBuf, &(recvCountsInt[0]), &(recvDisplsInt[0]), comm);
+    }
+    PROFILE_STOP;
+
+    //Unpack the data
+    PROFILE_SECTION("BCUnpack");
+    T* myBuf = this->Buffer();
+    const Offset innerStrideB = order > 0 ? stridesB[modeOrder[0]] : 1;
+    for(Unsigned p = 0; p < nProcs; p++){
+        if(recvCounts[p] == 0)
+            continue;
+        for(Unsigned i = 0; i < order; i++)
+            indices[i].swap(recvIndices[p*order + i]);
+        ProductLayout(indices, modeOrder, stridesB, outerOffsets, runStarts, runLengths);
+        const T* unpackBuf = &(recvBuf[recvDispls[p]]);
+        for(Unsigned j = 0; j < outerOffsets.size(); j++){
+            for(Unsigned k = 0; k < runStarts.size(); k++){
+                T* dst = &(myBuf[outerOffsets[j] + runStarts[k] * innerStrideB]);
+                if(beta == T(0)){
+                    for(Unsigned e = 0; e < runLengths[k]; e++)
+                        dst[e * innerStrideB] = alpha * unpackBuf[e];
+                }else{
+                    for(Unsigned e = 0; e < runLengths[k]; e++)
+                        dst[e * innerStrideB] = alpha * unpackBuf[e] + beta * dst[e * innerStrideB];
+                }
+                unpackBuf += runLengths[k];
+            }
+        }
+    }
+    PROFILE_STOP;
+
+    this->auxMemory_.Release();
+    this->NodeSync();
+}
+
+#define FULL(T) \
+    template class DistTensor<T>;
+
+FULL(Int)
+#ifndef DISABLE_FLOAT
+FULL(float)
+#endif
+FULL(double)
+
+#ifndef DISABLE_COMPLEX
+#ifndef DISABLE_FLOAT
+FULL(std::complex<float>)
+#endif
+FULL(std::complex<double>)
+#endif
+
+} //namespace rote
@@ -0,0 +1,68 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+                      2013, Jeff Hammond
+                      2013, Jed Brown
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "rote.hpp"
+
+namespace rote{
+
+////////////////////////////////
+// Workhorse interface
+////////////////////////////////
+
+template <typename T>
+void
+DistTensor<T>::BlockCyclicRedistFrom(const DistTensor<T>& A, const ModeArray& reduceModes, const T alpha, const T beta){
+    PROFILE_SECTION("BCRedist");
+    if(reduceModes.size() == 0){
+        this->ResizeTo(A);
+        BlockCyclicCommRedist(A, alpha, beta);
+        PROFILE_STOP;
+        return;
+    }
+
+    //Reductions go through element-cyclic (and private) copies of either side
+    const rote::Grid& g = this->Grid();
+    const TensorDistribution distA = A.TensorDist();
+    const TensorDistribution distB = this->TensorDist();
+    ModeArray blank;
+
+    DistTensor<T> tmpA(distA.ElementCyclic(), g);
+    if(distA.IsBlockCyclic())
+        tmpA.BlockCyclicRedistFrom(A, blank);
+    else
+        LockedView(tmpA, A);
+
+    if(distB.IsBlockCyclic() || this->NodeShared()){
+        DistTensor<T> tmpB(distB.ElementCyclic(), g);
+        tmpB.RedistFrom(tmpA, reduceModes);
+        this->BlockCyclicRedistFrom(tmpB, blank, alpha, beta);
+    }else{
+        this->RedistFrom(tmpA, reduceModes, alpha, beta);
+    }
+    PROFILE_STOP;
+}
+
+#define FULL(T) \
+    template class DistTensor<T>;
+
+FULL(Int)
+#ifndef DISABLE_FLOAT
+FULL(float)
+#endif
+FULL(double)
+
+#ifndef DISABLE_COMPLEX
+#ifndef DISABLE_FLOAT
+FULL(std::complex<float>)
+#endif
+FULL(std::complex<double>)
+#endif
+
+} //namespace rote
@@ -41,8 +41,8 @@ void DistTensor<T>::GatherToOneCommRedist(const DistTensor<T>& A, const ModeArra
     const Unsigned nRedistProcs = Max(1, prod(FilterVector(A.Grid().Shape(), commModes)));
     const ObjShape commDataShape = A.MaxLocalShape();
 
-    const Unsigned sendSize = prod(commDataShape);
-    const Unsigned recvSize = sendSize;
+    const Offset sendSize = prod(commDataShape);
+    const Offset recvSize = sendSize;
 
     T* auxBuf = this->auxMemory_.Require(sendSize + nRedistProcs*recvSize);
     T* sendBuf = &(auxBuf[0]);
@@ -37,8 +37,8 @@ void DistTensor<T>::LocalCommRedist(const DistTensor<T>& A, const T alpha, const
 //    PrintArray(dataBuf, A.LocalShape(), A.LocalStrides(), "srcBuf");
 
     const ObjShape commDataShape = A.MaxLocalShape();
-    const Unsigned sendSize = prod(commDataShape);
-    const Unsigned recvSize = sendSize;
+    const Offset sendSize = prod(commDataShape);
+    const Offset recvSize = sendSize;
 
     T* auxBuf = this->auxMemory_.Require(sendSize + recvSize);
     T* sendBuf = &(auxBuf[0]);
@@ -101,7 +101,7 @@ void DistTensor<T>::UnpackLocalCommRecvBuf(const DistTensor<T>& A, const T* recv
 //    PrintVector(myFirstLocB, "firstLocB");
 //    PrintVector(myFirstElemLocAligned, "firstAlignedALoc");
 
-    Unsigned dataBufPtr = LinearLocFromStrides(ElemwiseDivide(ElemwiseSubtract(myFirstLocB, myFirstElemLocAligned), gvAShape), Dimensions2Strides(A.MaxLocalShape()));
+    Offset dataBufPtr = LinearLocFromStrides(ElemwiseDivide(ElemwiseSubtract(myFirstLocB, myFirstElemLocAligned), gvAShape), Dimensions2Strides(A.MaxLocalShape()));
 
 
     const std::vector<Unsigned> commLCMs = LCMs(gvAShape, gvBShape);
@@ -111,7 +111,7 @@ void DistTensor<T>::UnpackLocalCommRecvBuf(const DistTensor<T>& A, const T* recv
 
     PackData unpackData;
     unpackData.loopShape = this->LocalShape();
-    unpackData.srcBufStrides = ElemwiseProd(Dimensions2Strides(A.MaxLocalShape()), modeStrideFactor);
+    unpackData.srcBufStrides = ElemwiseProd(Dimensions2Strides(A.MaxLocalShape()), std::vector<Offset>(modeStrideFactor.begin(), modeStrideFactor.end()));
     unpackData.dstBufStrides = this->LocalStrides();
 
 //    PrintPackData(unpackData, "unpacking local");
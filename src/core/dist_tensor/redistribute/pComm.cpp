@@ -61,8 +61,8 @@ void DistTensor<T>::PermutationCommRedist(const DistTensor<T>& A, const ModeArra
 
     //Determine buffer sizes for communication
     const ObjShape commDataShape = this->MaxLocalShape();
-    const Unsigned recvSize = prod(commDataShape);
-    const Unsigned sendSize = recvSize;
+    const Offset recvSize = prod(commDataShape);
+    const Offset sendSize = recvSize;
 
     T* auxBuf = this->auxMemory_.Require(sendSize + recvSize);
     T* sendBuf = &(auxBuf[0]);
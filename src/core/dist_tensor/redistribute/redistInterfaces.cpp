@@ -16,6 +16,13 @@ template <typename T>
 void DistTensor<T>::RedistFrom(const DistTensor<T>& A, const ModeArray& reduceModes, const T alpha, const T beta){
   PROFILE_SECTION("RedistFrom");
 
+	//Block-cyclic and node-shared tensors take the general all-to-all
+	if (A.TensorDist().IsBlockCyclic() || this->TensorDist().IsBlockCyclic() || this->NodeShared()) {
+		this->BlockCyclicRedistFrom(A, reduceModes, alpha, beta);
+		PROFILE_STOP;
+		return;
+	}
+
 	const Grid& g = this->Grid();
 	RedistPlan redistPlan(this->TensorDist(), A.TensorDist(), reduceModes, g);
 	// PrintRedistPlan(redistPlan, "Plan");
@@ -43,7 +50,7 @@ void DistTensor<T>::RedistFrom(const DistTensor<T>& A, const ModeArray& reduceMo
     	default: LogicError("Unsupported Communication");
   	}
   	tmp.Empty();
-  	tmp = tmp2;
+  	tmp = std::move(tmp2);
   }
 
 	Redist redist = redistPlan[-1];
@@ -91,6 +98,44 @@ void DistTensor<T>::ReduceFrom(
 	RedistFrom(A, reduceModes, alpha, beta);
 }
 
+template <typename T>
+void DistTensor<T>::RedistFrom(const DistTensorView<T>& A, const ModeArray& reduceModes, const T alpha, const T beta){
+	DistTensor<T> B(A.TensorDist(), A.Grid());
+	LockedView(B, A);
+	RedistFrom(B, reduceModes, alpha, beta);
+}
+
+template <typename T>
+void DistTensor<T>::RedistFrom(const DistTensorView<T>& A){
+	ModeArray reduceModes;
+	RedistFrom(A, reduceModes, T(1), T(0));
+}
+
+template <typename T>
+void DistTensor<T>::RedistributeFrom(const DistTensorView<T>& A){
+	RedistFrom(A);
+}
+
+template <typename T>
+void DistTensor<T>::ReduceFrom(
+  const DistTensorView<T>& A,
+  const ModeArray& reduceModes,
+  const T alpha, const T beta
+) {
+	RedistFrom(A, reduceModes, alpha, beta);
+}
+
+template <typename T>
+void DistTensor<T>::ReduceFrom(
+  const DistTensorView<T>& A,
+  const Mode& reduceMode,
+  const T alpha, const T beta
+) {
+  ModeArray reduceModes(1);
+  reduceModes[0] = reduceMode;
+	RedistFrom(A, reduceModes, alpha, beta);
+}
+
 #define FULL(T) \
     template class DistTensor<T>;
 
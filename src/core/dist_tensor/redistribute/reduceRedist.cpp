@@ -39,7 +39,7 @@ DistTensor<T>::ReduceUpdateRedistFrom(const RedistType& redistType, const T alph
     tmp2Dist.IntroduceUnitModeDists(sortedRModes);
 //    std::vector<Unsigned> tmp2Aligns = Alignments();
     std::vector<Unsigned> tmp2PermVals = this->localPerm_.Entries();
-    std::vector<Unsigned> tmp2Strides = this->LocalStrides();
+    std::vector<Offset> tmp2Strides = this->LocalStrides();
 
     for(i = 0; i < sortedRModes.size(); i++){
         Mode rMode = sortedRModes[i];
@@ -42,8 +42,8 @@ void DistTensor<T>::ReduceScatterUpdateCommRedist(const T alpha, const DistTenso
   const Unsigned nRedistProcs = Max(1, prod(FilterVector(g.Shape(), commModes)));
   const ObjShape commDataShape = this->MaxLocalShape();
 
-  const Unsigned recvSize = prod(commDataShape);
-  const Unsigned sendSize = recvSize * nRedistProcs;
+  const Offset recvSize = prod(commDataShape);
+  const Offset sendSize = recvSize * nRedistProcs;
 
     //NOTE: requiring 2*sendSize in case we realign
 	T* auxBuf = this->auxMemory_.Require(sendSize + sendSize);
@@ -77,7 +77,7 @@ void DistTensor<T>::ReduceScatterUpdateCommRedist(const T alpha, const DistTenso
 		recvBuf = &(alignSendBuf[0]);
   }
 
-  mpi::ReduceScatter(sendBuf, recvBuf, recvSize, comm);
+  mpi::HierarchicalReduceScatter(sendBuf, recvBuf, recvSize, comm);
   PROFILE_STOP;
 
   // PrintArray(recvBuf, commDataShape, "recvBuf");
@@ -122,7 +122,7 @@ void DistTensor<T>::PackRSCommSendBuf(const DistTensor<T>& A, const ModeArray& r
         modeStrideFactor[rModes[i]] = 1;
 
     const ObjShape sendShape = this->MaxLocalShape();
-    const Unsigned nElemsPerProc = prod(sendShape);
+    const Offset nElemsPerProc = prod(sendShape);
 
     //Grid information
     const rote::Grid& g = this->Grid();
@@ -223,15 +223,16 @@ void DistTensor<T>::PackRSCommSendBuf(const DistTensor<T>& A, const ModeArray& r
             //Determine where the initial piece of data is located.
             const Location localLoc = A.Global2LocalIndex(firstSendLoc);
 //            PrintVector(localLoc, "localLoc");
-            Unsigned dataBufPtr = LinearLocFromStrides(A.localPerm_.applyTo(localLoc), A.LocalStrides());
+            Offset dataBufPtr = LinearLocFromStrides(A.localPerm_.applyTo(localLoc), A.LocalStrides());
 
             PackData packData;
             packData.loopShape = MaxLengths(ElemwiseSubtract(A.LocalShape(), A.localPerm_.applyTo(localLoc)), A.localPerm_.applyTo(modeStrideFactor));
-            packData.srcBufStrides = ElemwiseProd(A.LocalStrides(), A.localPerm_.applyTo(modeStrideFactor));
+            const std::vector<Unsigned> localStrideFactor = A.localPerm_.applyTo(modeStrideFactor);
+            packData.srcBufStrides = ElemwiseProd(A.LocalStrides(), std::vector<Offset>(localStrideFactor.begin(), localStrideFactor.end()));
 
             //Pack into permuted form to minimize striding when unpacking
             ObjShape finalShape = this->localPerm_.applyTo(sendShape);
-            std::vector<Unsigned> finalStrides = Dimensions2Strides(finalShape);
+            std::vector<Offset> finalStrides = Dimensions2Strides(finalShape);
 
             //Determine permutation from local output to local input
             Permutation out2in = A.localPerm_.PermutationTo(this->localPerm_).InversePermutation();
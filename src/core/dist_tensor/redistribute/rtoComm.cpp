@@ -32,8 +32,8 @@ void DistTensor<T>::ReduceToOneUpdateCommRedist(const T alpha, const DistTensor<
 
     //Determine buffer sizes for communication
     const ObjShape commDataShape = A.MaxLocalShape();
-    const Unsigned sendSize = prod(commDataShape);
-    const Unsigned recvSize = sendSize;
+    const Offset sendSize = prod(commDataShape);
+    const Offset recvSize = sendSize;
 
     T* auxBuf = this->auxMemory_.Require(sendSize + recvSize);
     T* sendBuf = &(auxBuf[0]);
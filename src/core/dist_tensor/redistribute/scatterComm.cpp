@@ -41,8 +41,8 @@ void DistTensor<T>::ScatterCommRedist(const DistTensor<T>& A, const ModeArray& c
 	const Unsigned nRedistProcs = Max(1, prod(FilterVector(g.Shape(), commModes)));
 	const ObjShape commDataShape = this->MaxLocalShape();
 
-	const Unsigned sendSize = prod(commDataShape);
-	const Unsigned recvSize = sendSize;
+	const Offset sendSize = prod(commDataShape);
+	const Offset recvSize = sendSize;
 
 	T* auxBuf = this->auxMemory_.Require((sendSize + recvSize) * nRedistProcs);
 
@@ -24,7 +24,9 @@ double minRealWindowVal, maxRealWindowVal,
 #endif
 std::stack<rote::Int> blocksizeStack;
 rote::Grid* defaultGrid = 0;
-rote::mpi::CommMap* defaultCommMap = 0;
+bool nodeSharedIntermediates = false;
+rote::RMAEpoch allToAllRMA = rote::RMA_OFF;
+double allToAllRMAPeerFraction = 0.25;
 rote::Args* args = 0;
 
 // A common Mersenne twister configuration
@@ -146,7 +148,6 @@ void Initialize( int& argc, char**& argv )
 
     // Build the default grid
     //defaultGrid = new Grid( mpi::COMM_WORLD );
-    defaultCommMap = new mpi::CommMap();
 
     // Create the types and ops needed for ValueInt
     mpi::CreateValueIntType<Int>();
@@ -211,14 +212,11 @@ void Finalize()
             // Delete the default grid
             delete ::defaultGrid;
             ::defaultGrid = 0;
-            delete ::defaultCommMap;
-            ::defaultCommMap = 0;
 
             mpi::Finalize();
         }
 
         ::defaultGrid = 0;
-        ::defaultCommMap = 0;
         while( ! ::blocksizeStack.empty() )
             ::blocksizeStack.pop();
     }
@@ -237,6 +235,24 @@ Int Blocksize()
 void SetBlocksize( Int blocksize )
 { ::blocksizeStack.top() = blocksize; }
 
+bool NodeSharedIntermediates()
+{ return ::nodeSharedIntermediates; }
+
+void SetNodeSharedIntermediates( bool share )
+{ ::nodeSharedIntermediates = share; }
+
+RMAEpoch AllToAllRMA()
+{ return ::allToAllRMA; }
+
+double AllToAllRMAPeerFraction()
+{ return ::allToAllRMAPeerFraction; }
+
+void SetAllToAllRMA( RMAEpoch epoch, double maxPeerFraction )
+{
+    ::allToAllRMA = epoch;
+    ::allToAllRMAPeerFraction = maxPeerFraction;
+}
+
 ModeArray OrderedModes(Unsigned order)
 {
     Unsigned i;
@@ -257,15 +273,4 @@ const Grid& DefaultGrid()
     return *::defaultGrid;
 }
 
-mpi::CommMap& DefaultCommMap()
-{
-#ifndef RELEASE
-    if( ::defaultCommMap == 0 )
-        LogicError
-        ("Attempted to return a non-existant default grid. Please ensure that "
-         "ROTE is initialized before creating a DistTensor.");
-#endif
-    return *::defaultCommMap;
-}
-
 } // namespace rote
@@ -10,6 +10,39 @@
 
 namespace rote {
 
+  namespace {
+
+  Unsigned ModeMask( const ModeArray& modes, Unsigned order )
+  {
+    Unsigned mask = 0;
+    for(Unsigned i = 0; i < modes.size(); i++){
+      if( modes[i] >= order ){
+        std::ostringstream msg;
+        msg << "Grid modes must be valid:\n"
+            << "  order=" << order << ", requested mode=" << modes[i];
+        LogicError( msg.str() );
+      }
+      mask |= 1u << modes[i];
+    }
+    return mask;
+  }
+
+  void CheckGridSize( Unsigned size, const ObjShape& shape )
+  {
+      if( size != prod(shape))
+      {
+          std::ostringstream msg;
+          msg << "Number of processes must match grid size:\n"
+              << "  size=" << size << ", dimension=[";
+          for(Unsigned i = 0; i < shape.size(); i++)
+            msg << (i == 0 ? "" : ", ") << shape[i];
+          msg << "]";
+          LogicError( msg.str() );
+      }
+  }
+
+  } // anonymous namespace
+
   void
   Grid::SetMyGridLoc( )
   {
@@ -51,35 +84,93 @@ namespace rote {
       SetUpGrid();
   }
 
+  Grid::Grid( mpi::Comm comm, const ObjShape& shape, const std::vector<double>& modeWeights )
+  {
+      inGrid_ = true; // this is true by assumption for this constructor
+
+      shape_ = shape;
+      gridLoc_.resize(shape_.size());
+      size_ = mpi::CommSize( comm );
+      // Checked before the processes are laid out over the grid
+      CheckGridSize( size_, shape_ );
+      const Unsigned order = Order();
+      Unsigned i;
+#ifndef RELEASE
+      if( modeWeights.size() != order )
+          LogicError("Must supply one weight per grid mode");
+#endif
+
+      // Number the processes node by node, nodes in the order of their
+      // lowest rank
+      mpi::Comm nodeComm;
+      const int commRank = mpi::CommRank( comm );
+      mpi::CommSplitShared( comm, commRank, nodeComm );
+      const int nodeRank = mpi::CommRank( nodeComm );
+      int nodeLeader = commRank;
+      mpi::Broadcast( nodeLeader, 0, nodeComm );
+      mpi::CommFree( nodeComm );
+      std::vector<int> nodeLeaders(size_);
+      mpi::AllGather( &nodeLeader, 1, &(nodeLeaders[0]), 1, comm );
+      Unsigned position = nodeRank;
+      for(i = 0; i < size_; i++)
+        if( nodeLeaders[i] < nodeLeader )
+          position++;
+
+      // Place the heaviest modes fastest in that numbering
+      ModeArray modeOrder(order);
+      for(i = 0; i < order; i++)
+        modeOrder[i] = i;
+      for(i = 1; i < order; i++)
+        for(Unsigned j = i; j > 0 && modeWeights[modeOrder[j]] > modeWeights[modeOrder[j-1]]; j--)
+          std::swap(modeOrder[j], modeOrder[j-1]);
+      const Location orderedLoc = LinearLoc2Loc(position, FilterVector(shape_, modeOrder));
+      for(i = 0; i < order; i++)
+        gridLoc_[modeOrder[i]] = orderedLoc[i];
+
+      // Renumber the processes to match, as the rest of the grid expects
+      linearRank_ = Loc2LinearLoc(gridLoc_, shape_);
+      mpi::CommSplit( comm, 0, linearRank_, owningComm_ );
+
+      SetMyGridLoc();
+      SetUpGrid();
+  }
+
   void
   Grid::SetUpGrid()
   {
       const Unsigned order = Order();
       Unsigned i;
-      if( size_ != prod(shape_))
-      {
-          std::ostringstream msg;
-          msg << "Number of processes must match grid size:\n"
-              << "  size=" << size_ << ", dimension=[" << shape_[0];
-          for(i = 1; i < order; i++)
-            msg << ", " << shape_[i];
-          msg << "]";
-          LogicError( msg.str() );
-      }
+      CheckGridSize( size_, shape_ );
 
       if( inGrid_ )
       {
-          // Create a cartesian communicator
+          // Create a cartesian communicator.  MPI numbers its processes
+          // with the last dimension varying fastest and the grid with the
+          // first, so the dimensions are given in reverse.
           std::vector<int> shape(order);
           std::vector<int> periods(order);
 
           for(i = 0; i < order; i++){
-            shape[i] = shape_[i];
+            shape[i] = shape_[order - 1 - i];
             periods[i] = true;
           }
           bool reorder = false;
           mpi::CartCreate
           ( owningComm_, order, shape.data(), periods.data(), reorder, cartComm_ );
+
+          // Build the communicators for every subset of the grid modes up
+          // front, so that no redistribution has to create one
+          if( order >= static_cast<Unsigned>(std::numeric_limits<Unsigned>::digits) )
+              LogicError("Grid order is too large to index its subcommunicators");
+          const Unsigned numSubsets = 1u << order;
+          std::vector<int> remainingDims(order);
+          subComms_.resize(numSubsets);
+          nodeSubComms_.assign(numSubsets, mpi::COMM_NULL);
+          for(Unsigned mask = 0; mask < numSubsets; mask++){
+            for(i = 0; i < order; i++)
+              remainingDims[order - 1 - i] = (mask >> i) & 1;
+            mpi::CartSub( cartComm_, remainingDims.data(), subComms_[mask] );
+          }
       }
   }
 
@@ -89,6 +180,11 @@ namespace rote {
       {
           if( inGrid_ )
           {
+              for(Unsigned i = 0; i < subComms_.size(); i++){
+                  mpi::CommFree( subComms_[i] );
+                  if( nodeSubComms_[i] != mpi::COMM_NULL )
+                      mpi::CommFree( nodeSubComms_[i] );
+              }
               mpi::CommFree( cartComm_ );
           }
 
@@ -154,6 +250,28 @@ namespace rote {
   Grid::OwningComm() const
   { return owningComm_; }
 
+  mpi::Comm
+  Grid::SubComm( const ModeArray& modes ) const
+  {
+    const Unsigned mask = ModeMask(modes, Order());
+    if( !inGrid_ )
+      return mpi::COMM_NULL;
+    return subComms_[mask];
+  }
+
+  mpi::Comm
+  Grid::NodeSubComm( const ModeArray& modes ) const
+  {
+    const Unsigned mask = ModeMask(modes, Order());
+    if( !inGrid_ )
+      return mpi::COMM_NULL;
+    if( nodeSubComms_[mask] == mpi::COMM_NULL ){
+      const mpi::Comm comm = subComms_[mask];
+      mpi::CommSplitShared( comm, mpi::CommRank(comm), nodeSubComms_[mask] );
+    }
+    return nodeSubComms_[mask];
+  }
+
   //
   // Comparison functions
   //
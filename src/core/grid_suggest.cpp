@@ -0,0 +1,260 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "rote.hpp"
+
+namespace rote {
+
+namespace {
+
+// Entries the process holding the most of a tensor keeps
+double LocalEntries
+( const ObjShape& shape, const TensorDistribution& dist,
+  const ObjShape& gridShape )
+{
+    double nElem = 1;
+    for(Unsigned i = 0; i < shape.size(); i++){
+        const ModeArray gridModes = dist[i].Entries();
+        const Unsigned wrap = gridModes.empty() ? 1 : prod(FilterVector(gridShape, gridModes));
+        nElem *= MaxBlockLength(shape[i], wrap, dist[i].BlockSize());
+    }
+    return nElem;
+}
+
+// The collective moving the tensor from one distribution to the other is
+// over the grid modes bound to the tensor modes whose distribution changes;
+// each process receives all but its share of the larger of the two pieces
+double RedistTime
+( const GridWorkload::Redist& redist, const ObjShape& gridShape,
+  const GridCostModel& model )
+{
+    const TensorDistribution& from = redist.from;
+    const TensorDistribution& to = redist.to;
+    std::vector<bool> involved(gridShape.size(), false);
+    for(Unsigned i = 0; i < from.size(); i++){
+        if(from[i] == to[i])
+            continue;
+        const ModeArray fromModes = from[i].Entries();
+        const ModeArray toModes = to[i].Entries();
+        for(Unsigned j = 0; j < fromModes.size(); j++)
+            involved[fromModes[j]] = true;
+        for(Unsigned j = 0; j < toModes.size(); j++)
+            involved[toModes[j]] = true;
+    }
+    double commSize = 1;
+    for(Unsigned i = 0; i < gridShape.size(); i++)
+        if(involved[i])
+            commSize *= gridShape[i];
+    if(commSize == 1)
+        return 0;
+
+    const double entries =
+        std::max(LocalEntries(redist.shape, from, gridShape),
+            LocalEntries(redist.shape, to, gridShape));
+    return redist.count *
+           (model.latency * std::ceil(std::log2(commSize)) +
+            model.perEntry * entries * (commSize - 1) / commSize);
+}
+
+// Every ordered factorisation of n into the remaining entries of shape
+void Factorisations
+( Unsigned n, Unsigned mode, ObjShape& shape, std::vector<ObjShape>& shapes )
+{
+    if(mode == shape.size() - 1){
+        shape[mode] = n;
+        shapes.push_back(shape);
+        return;
+    }
+    for(Unsigned d = 1; d <= n; d++){
+        if(n % d != 0)
+            continue;
+        shape[mode] = d;
+        Factorisations(n / d, mode + 1, shape, shapes);
+    }
+}
+
+bool BetterCandidate
+( const GridCandidate& a, const GridCandidate& b, double memoryLimit )
+{
+    if(memoryLimit > 0){
+        const bool aFits = a.memory <= memoryLimit;
+        const bool bFits = b.memory <= memoryLimit;
+        if(aFits != bFits)
+            return aFits;
+    }
+    if(a.time != b.time)
+        return a.time < b.time;
+    return a.memory < b.memory;
+}
+
+} // anonymous namespace
+
+GridWorkload::GridWorkload( Unsigned gridOrder )
+: gridOrder_(gridOrder)
+{ }
+
+Unsigned GridWorkload::GridOrder() const
+{ return gridOrder_; }
+
+void GridWorkload::AddTensor
+( const ObjShape& shape, const TensorDistribution& dist )
+{
+#ifndef RELEASE
+    if(dist.size() != shape.size() + 1)
+        LogicError("Distribution does not match the tensor order");
+#endif
+    Tensor tensor;
+    tensor.shape = shape;
+    tensor.dist = dist;
+    tensors_.push_back(tensor);
+}
+
+void GridWorkload::AddRedist
+( const ObjShape& shape, const TensorDistribution& from,
+  const TensorDistribution& to, double count )
+{
+#ifndef RELEASE
+    if(from.size() != shape.size() + 1 || to.size() != shape.size() + 1)
+        LogicError("Distribution does not match the tensor order");
+#endif
+    Redist redist;
+    redist.shape = shape;
+    redist.from = from;
+    redist.to = to;
+    redist.count = count;
+    redists_.push_back(redist);
+}
+
+void GridWorkload::AddContraction
+( const ObjShape& shapeA, const TensorDistribution& distA, const IndexArray& indicesA,
+  const ObjShape& shapeB, const TensorDistribution& distB, const IndexArray& indicesB,
+  const ObjShape& shapeC, const TensorDistribution& distC, const IndexArray& indicesC,
+  double count )
+{
+#ifndef RELEASE
+    if(indicesA.size() != shapeA.size() || indicesB.size() != shapeB.size() ||
+       indicesC.size() != shapeC.size())
+        LogicError("Indices do not match the tensor orders");
+    if(distA.size() != shapeA.size() + 1 || distB.size() != shapeB.size() + 1 ||
+       distC.size() != shapeC.size() + 1)
+        LogicError("Distribution does not match the tensor order");
+#endif
+    //Same operand choice as Contract::run: A stays put when it is at least
+    //as large as B and larger than C, otherwise B does
+    const Offset numElemA = prod(shapeA);
+    const Offset numElemB = prod(shapeB);
+    const Offset numElemC = prod(shapeC);
+    const bool statA = numElemA >= numElemB && numElemA > numElemC;
+    const ObjShape& shapeS = statA ? shapeA : shapeB;
+    const TensorDistribution& distS = statA ? distA : distB;
+    const IndexArray& indicesS = statA ? indicesA : indicesB;
+    const ObjShape& shapeO = statA ? shapeB : shapeA;
+    const TensorDistribution& distO = statA ? distB : distA;
+    const IndexArray& indicesO = statA ? indicesB : indicesA;
+
+    //Same intermediates as Contract::setContractInfo without C stationary
+    const IndexArray indicesSO = DiffVector(indicesS, indicesC);
+    const IndexArray indicesOC = DiffVector(indicesO, indicesS);
+    const IndexArray indicesT = ConcatenateVectors(indicesC, indicesSO);
+    TensorDistribution distIntO(indicesO.size());
+    distIntO.SetToMatch(distS, indicesS, indicesO);
+    TensorDistribution distT(indicesT.size());
+    distT.SetToMatch(distS, indicesS, indicesT);
+    for(Unsigned i = indicesC.size(); i < indicesT.size(); i++)
+        distT[i].SetBlockSize(1);
+    TensorDistribution distTC(indicesT.size());
+    distTC.SetToMatch(distC, indicesC, indicesT);
+
+    Contraction contraction;
+    contraction.redistB.shape = shapeO;
+    contraction.redistB.from = distO;
+    contraction.redistB.to = distIntO;
+    contraction.redistB.count = count;
+    //Every process holds one partial sum per contracted index of T
+    contraction.reduceT.shape = shapeC;
+    contraction.reduceT.shape.resize(indicesT.size(), 1);
+    contraction.reduceT.from = distT;
+    contraction.reduceT.to = distTC;
+    contraction.reduceT.count = count;
+    contraction.shapeA = shapeS;
+    contraction.distA = distS;
+    contraction.shapeBC.resize(indicesOC.size());
+    contraction.distBC = TensorDistribution(indicesOC.size());
+    for(Unsigned i = 0; i < indicesOC.size(); i++){
+        const int index = IndexOf(indicesO, indicesOC[i]);
+        contraction.shapeBC[i] = shapeO[index];
+        contraction.distBC[i] = distIntO[index];
+    }
+    contraction.count = count;
+    contractions_.push_back(contraction);
+}
+
+const std::vector<GridWorkload::Tensor>& GridWorkload::Tensors() const
+{ return tensors_; }
+
+const std::vector<GridWorkload::Redist>& GridWorkload::Redists() const
+{ return redists_; }
+
+const std::vector<GridWorkload::Contraction>& GridWorkload::Contractions() const
+{ return contractions_; }
+
+std::vector<GridCandidate>
+Grid::Suggest
+( Unsigned numProcs, const GridWorkload& workload, const GridCostModel& model )
+{
+    const Unsigned order = workload.GridOrder();
+    if(numProcs == 0 || order == 0)
+        LogicError("Grid must have at least one process and one mode");
+
+    std::vector<ObjShape> shapes;
+    ObjShape shape(order);
+    Factorisations(numProcs, 0, shape, shapes);
+
+    const std::vector<GridWorkload::Tensor>& tensors = workload.Tensors();
+    const std::vector<GridWorkload::Redist>& redists = workload.Redists();
+    const std::vector<GridWorkload::Contraction>& contractions = workload.Contractions();
+
+    std::vector<GridCandidate> candidates(shapes.size());
+    for(Unsigned s = 0; s < shapes.size(); s++){
+        const ObjShape& gridShape = shapes[s];
+        GridCandidate& candidate = candidates[s];
+        candidate.shape = gridShape;
+        candidate.time = 0;
+
+        double persistent = 0;
+        for(Unsigned i = 0; i < tensors.size(); i++)
+            persistent += LocalEntries(tensors[i].shape, tensors[i].dist, gridShape);
+        double transient = 0;
+        for(Unsigned i = 0; i < redists.size(); i++){
+            candidate.time += RedistTime(redists[i], gridShape, model);
+            transient = std::max(transient, LocalEntries(redists[i].shape, redists[i].to, gridShape));
+        }
+        for(Unsigned i = 0; i < contractions.size(); i++){
+            const GridWorkload::Contraction& contraction = contractions[i];
+            const double localA = LocalEntries(contraction.shapeA, contraction.distA, gridShape);
+            const double flops = 2 * localA *
+                LocalEntries(contraction.shapeBC, contraction.distBC, gridShape);
+            candidate.time += RedistTime(contraction.redistB, gridShape, model) +
+                              RedistTime(contraction.reduceT, gridShape, model) +
+                              contraction.count * model.perFlop * flops;
+            //A is permuted into a copy, B and T are intermediates
+            transient = std::max(transient, localA +
+                LocalEntries(contraction.redistB.shape, contraction.redistB.to, gridShape) +
+                LocalEntries(contraction.reduceT.shape, contraction.reduceT.from, gridShape));
+        }
+        candidate.memory = persistent + transient;
+    }
+
+    //Insertion sort keeps equally good shapes in enumeration order
+    for(Unsigned i = 1; i < candidates.size(); i++)
+        for(Unsigned j = i; j > 0 && BetterCandidate(candidates[j], candidates[j-1], model.memoryLimit); j--)
+            std::swap(candidates[j], candidates[j-1]);
+    return candidates;
+}
+
+} // namespace rote
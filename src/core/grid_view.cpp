@@ -60,8 +60,6 @@ namespace rote {
     SetGridModeTypes(unusedModes);
   }
 
-  GridView::~GridView() {}
-
   Location GridView::ParticipatingLoc() const {
     Location ret(loc_.begin(), loc_.end() - 1);
     return ret;
@@ -26,6 +26,105 @@ SafeMpi( int mpiError )
 #endif
 }
 
+// Number of elements to hand to the next MPI call of a chunked message
+inline int
+ChunkSize( rote::Offset remaining, rote::Offset maxCount )
+{ return static_cast<int>( std::min( remaining, maxCount ) ); }
+
+// Exchange messages too long for a single MPI_Sendrecv as a sequence of
+// chunks.  The number of chunks depends only on the message length, so the
+// partner's chunked sends and receives line up with ours
+template<typename T>
+void
+ChunkedSendRecv
+( const T* sbuf, rote::Offset sc, MPI_Datatype type, int to,   int stag,
+        T* rbuf, rote::Offset rc,                    int from, int rtag,
+  MPI_Comm comm, rote::Offset maxCount )
+{
+    std::vector<MPI_Request> requests;
+    do
+    {
+        const int chunk = ChunkSize( rc, maxCount );
+        MPI_Request request;
+        SafeMpi( MPI_Irecv( rbuf, chunk, type, from, rtag, comm, &request ) );
+        requests.push_back( request );
+        rbuf += chunk;
+        rc -= chunk;
+    } while( rc > 0 );
+    do
+    {
+        const int chunk = ChunkSize( sc, maxCount );
+        MPI_Request request;
+        SafeMpi
+        ( MPI_Isend
+          ( const_cast<T*>(sbuf), chunk, type, to, stag, comm, &request ) );
+        requests.push_back( request );
+        sbuf += chunk;
+        sc -= chunk;
+    } while( sc > 0 );
+    SafeMpi
+    ( MPI_Waitall( requests.size(), &requests[0], MPI_STATUSES_IGNORE ) );
+}
+
+#ifndef HAVE_MPI_LARGE_COUNT
+// Count and datatype describing a block of n elements of a base datatype to
+// a fixed-size collective.  Blocks longer than MAX_MSG_COUNT become a single
+// derived element (full chunks followed by the remainder) whose extent spans
+// exactly the block, so per-process displacements stay correct
+class LargeCount
+{
+public:
+    int count;
+    MPI_Datatype type;
+
+    LargeCount( rote::Offset n, MPI_Datatype base )
+    : count(0), type(base), derived_(false)
+    {
+        const rote::Offset chunk = rote::mpi::MAX_MSG_COUNT;
+        if( n <= chunk )
+        {
+            count = static_cast<int>(n);
+            return;
+        }
+        const int numChunks = static_cast<int>( n / chunk );
+        const int remainder = static_cast<int>( n % chunk );
+        MPI_Aint lb, extent;
+        SafeMpi( MPI_Type_get_extent( base, &lb, &extent ) );
+
+        MPI_Datatype chunks, rest, combined;
+        SafeMpi
+        ( MPI_Type_vector( numChunks, chunk, chunk, base, &chunks ) );
+        SafeMpi( MPI_Type_contiguous( remainder, base, &rest ) );
+        int blockLengths[2] = { 1, 1 };
+        MPI_Aint displs[2] = { 0, MPI_Aint(numChunks*chunk)*extent };
+        MPI_Datatype types[2] = { chunks, rest };
+        SafeMpi
+        ( MPI_Type_create_struct
+          ( 2, blockLengths, displs, types, &combined ) );
+        SafeMpi
+        ( MPI_Type_create_resized( combined, 0, MPI_Aint(n)*extent, &type ) );
+        SafeMpi( MPI_Type_commit( &type ) );
+        SafeMpi( MPI_Type_free( &chunks ) );
+        SafeMpi( MPI_Type_free( &rest ) );
+        SafeMpi( MPI_Type_free( &combined ) );
+        count = 1;
+        derived_ = true;
+    }
+
+    ~LargeCount()
+    {
+        if( derived_ )
+            MPI_Type_free( &type );
+    }
+
+private:
+    bool derived_;
+
+    LargeCount( const LargeCount& );
+    const LargeCount& operator=( const LargeCount& );
+};
+#endif // ifndef HAVE_MPI_LARGE_COUNT
+
 } // anonymous namespace
 
 namespace rote {
@@ -218,6 +317,214 @@ void GroupTranslateRanks
       ( origGroup, size, const_cast<int*>(origRanks), newGroup, newRanks ) );
 }
 
+void CommSplitShared( Comm comm, int key, Comm& sharedComm )
+{
+#ifdef HAVE_MPI3_SHARED_MEMORY
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, &sharedComm ) );
+#else
+    NOT_USED(comm); NOT_USED(key); NOT_USED(sharedComm);
+    LogicError("Shared-memory communicators require MPI-3");
+#endif
+}
+
+void* WindowAllocateShared( Aint bytes, Comm comm, Window& win )
+{
+#ifdef HAVE_MPI3_SHARED_MEMORY
+    void* base;
+    SafeMpi
+    ( MPI_Win_allocate_shared
+      ( bytes, 1, MPI_INFO_NULL, comm, &base, &win ) );
+    Aint rootBytes;
+    int dispUnit;
+    SafeMpi( MPI_Win_shared_query( win, 0, &rootBytes, &dispUnit, &base ) );
+    SafeMpi( MPI_Win_lock_all( MPI_MODE_NOCHECK, win ) );
+    return base;
+#else
+    NOT_USED(bytes); NOT_USED(comm); NOT_USED(win);
+    LogicError("Shared-memory windows require MPI-3");
+    return 0;
+#endif
+}
+
+void WindowFreeShared( Window& win )
+{
+#ifdef HAVE_MPI3_SHARED_MEMORY
+    SafeMpi( MPI_Win_unlock_all( win ) );
+    SafeMpi( MPI_Win_free( &win ) );
+#else
+    NOT_USED(win);
+#endif
+}
+
+void WindowSync( Window win, Comm comm )
+{
+#ifdef HAVE_MPI3_SHARED_MEMORY
+    SafeMpi( MPI_Win_sync( win ) );
+    SafeMpi( MPI_Barrier( comm ) );
+    SafeMpi( MPI_Win_sync( win ) );
+#else
+    NOT_USED(win); NOT_USED(comm);
+#endif
+}
+
+void WindowCreate( void* base, Aint bytes, int dispUnit, Comm comm, Window& win )
+{
+    SafeMpi
+    ( MPI_Win_create( base, bytes, dispUnit, MPI_INFO_NULL, comm, &win ) );
+}
+
+void WindowFree( Window& win )
+{
+    SafeMpi( MPI_Win_free( &win ) );
+}
+
+void WindowFence( Window win )
+{
+    SafeMpi( MPI_Win_fence( 0, win ) );
+}
+
+void WindowPost( Group origins, Window win )
+{
+    SafeMpi( MPI_Win_post( origins, 0, win ) );
+}
+
+void WindowWait( Window win )
+{
+    SafeMpi( MPI_Win_wait( win ) );
+}
+
+void WindowStart( Group targets, Window win )
+{
+    SafeMpi( MPI_Win_start( targets, 0, win ) );
+}
+
+void WindowComplete( Window win )
+{
+    SafeMpi( MPI_Win_complete( win ) );
+}
+
+template<typename R>
+void Put
+( const R* sbuf, Offset count, int target, Aint targetDispl, Window win )
+{
+    while( count != 0 )
+    {
+        const int chunk = ChunkSize( count, MAX_MSG_COUNT );
+        SafeMpi
+        ( MPI_Put
+          ( const_cast<R*>(sbuf), chunk, TypeMap<R>(),
+            target, targetDispl, chunk, TypeMap<R>(), win ) );
+        sbuf += chunk;
+        targetDispl += chunk;
+        count -= chunk;
+    }
+}
+
+template void Put( const byte* sbuf, Offset count, int target, Aint targetDispl, Window win );
+template void Put( const int* sbuf, Offset count, int target, Aint targetDispl, Window win );
+template void Put( const float* sbuf, Offset count, int target, Aint targetDispl, Window win );
+template void Put( const double* sbuf, Offset count, int target, Aint targetDispl, Window win );
+template void Put( const std::complex<float>* sbuf, Offset count, int target, Aint targetDispl, Window win );
+template void Put( const std::complex<double>* sbuf, Offset count, int target, Aint targetDispl, Window win );
+
+void TypeCreateHvector
+( int count, int blockLength, Aint stride, Datatype oldType,
+  Datatype& newType )
+{
+    SafeMpi
+    ( MPI_Type_create_hvector( count, blockLength, stride, oldType, &newType ) );
+}
+
+void TypeCommit( Datatype& type )
+{
+    SafeMpi( MPI_Type_commit( &type ) );
+}
+
+void TypeFree( Datatype& type )
+{
+    SafeMpi( MPI_Type_free( &type ) );
+}
+
+void InfoCreate( Info& info )
+{
+    SafeMpi( MPI_Info_create( &info ) );
+}
+
+void InfoSet( Info info, const std::string& key, const std::string& value )
+{
+    SafeMpi
+    ( MPI_Info_set
+      ( info, const_cast<char*>(key.c_str()), const_cast<char*>(value.c_str()) ) );
+}
+
+void InfoFree( Info& info )
+{
+    SafeMpi( MPI_Info_free( &info ) );
+}
+
+void FileOpen
+( Comm comm, const std::string& filename, int amode, Info info, File& fh )
+{
+    // Always check: a missing file is a user error, not a bug
+    const int error =
+        MPI_File_open
+        ( comm, const_cast<char*>(filename.c_str()), amode, info, &fh );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open " + filename);
+}
+
+void FileClose( File& fh )
+{
+    SafeMpi( MPI_File_close( &fh ) );
+}
+
+Offset FileSize( File fh )
+{
+    MPI_Offset bytes;
+    SafeMpi( MPI_File_get_size( fh, &bytes ) );
+    return bytes;
+}
+
+void FileSetSize( File fh, Offset bytes )
+{
+    SafeMpi( MPI_File_set_size( fh, bytes ) );
+}
+
+void FileSetView( File fh, Offset disp, Datatype fileType, Info info )
+{
+    SafeMpi
+    ( MPI_File_set_view
+      ( fh, disp, MPI_BYTE, fileType, const_cast<char*>("native"), info ) );
+}
+
+void FileReadAt( File fh, Offset offset, void* buf, int count, Datatype type )
+{
+    SafeMpi
+    ( MPI_File_read_at( fh, offset, buf, count, type, MPI_STATUS_IGNORE ) );
+}
+
+void FileWriteAt
+( File fh, Offset offset, const void* buf, int count, Datatype type )
+{
+    SafeMpi
+    ( MPI_File_write_at
+      ( fh, offset, const_cast<void*>(buf), count, type, MPI_STATUS_IGNORE ) );
+}
+
+void FileReadAll( File fh, void* buf, int count, Datatype type )
+{
+    SafeMpi( MPI_File_read_all( fh, buf, count, type, MPI_STATUS_IGNORE ) );
+}
+
+void FileWriteAll( File fh, const void* buf, int count, Datatype type )
+{
+    SafeMpi
+    ( MPI_File_write_all
+      ( fh, const_cast<void*>(buf), count, type, MPI_STATUS_IGNORE ) );
+}
+
 // Wait until every process in comm reaches this statement
 void Barrier( Comm comm )
 {
@@ -291,59 +598,74 @@ template int GetCount<std::complex<float> >( Status& status );
 template int GetCount<std::complex<double> >( Status& status );
 
 template<typename R>
-void TaggedSend( const R* buf, int count, int to, int tag, Comm comm )
+void TaggedSend( const R* buf, Offset count, int to, int tag, Comm comm )
 {
-    SafeMpi
-    ( MPI_Send( const_cast<R*>(buf), count, TypeMap<R>(), to, tag, comm ) );
+    // Messages over MAX_MSG_COUNT go out as a sequence of smaller sends,
+    // matched in order by TaggedRecv
+    do
+    {
+        const int chunk = ChunkSize( count, MAX_MSG_COUNT );
+        SafeMpi
+        ( MPI_Send( const_cast<R*>(buf), chunk, TypeMap<R>(), to, tag, comm ) );
+        buf += chunk;
+        count -= chunk;
+    } while( count > 0 );
 }
 
 template<typename R>
-void TaggedSend( const std::complex<R>* buf, int count, int to, int tag, Comm comm )
+void TaggedSend( const std::complex<R>* buf, Offset count, int to, int tag, Comm comm )
 {
+    do
+    {
 #ifdef AVOID_COMPLEX_MPI
-    SafeMpi
-    ( MPI_Send
-      ( const_cast<std::complex<R>*>(buf), 2*count, TypeMap<R>(), to,
-        tag, comm ) );
+        const int chunk = ChunkSize( count, MAX_MSG_COUNT/2 );
+        SafeMpi
+        ( MPI_Send
+          ( const_cast<std::complex<R>*>(buf), 2*chunk, TypeMap<R>(), to,
+            tag, comm ) );
 #else
-    SafeMpi
-    ( MPI_Send
-      ( const_cast<std::complex<R>*>(buf), count,
-        TypeMap<std::complex<R> >(), to, tag, comm ) );
+        const int chunk = ChunkSize( count, MAX_MSG_COUNT );
+        SafeMpi
+        ( MPI_Send
+          ( const_cast<std::complex<R>*>(buf), chunk,
+            TypeMap<std::complex<R> >(), to, tag, comm ) );
 #endif
+        buf += chunk;
+        count -= chunk;
+    } while( count > 0 );
 }
 
-template void TaggedSend( const byte* buf, int count, int to, int tag, Comm comm );
-template void TaggedSend( const int* buf, int count, int to, int tag, Comm comm );
-template void TaggedSend( const unsigned* buf, int count, int to, int tag, Comm comm  );
-template void TaggedSend( const long int* buf, int count, int to, int tag, Comm comm );
-template void TaggedSend( const unsigned long* buf, int count, int to, int tag, Comm comm  );
+template void TaggedSend( const byte* buf, Offset count, int to, int tag, Comm comm );
+template void TaggedSend( const int* buf, Offset count, int to, int tag, Comm comm );
+template void TaggedSend( const unsigned* buf, Offset count, int to, int tag, Comm comm  );
+template void TaggedSend( const long int* buf, Offset count, int to, int tag, Comm comm );
+template void TaggedSend( const unsigned long* buf, Offset count, int to, int tag, Comm comm  );
 #ifdef HAVE_MPI_LONG_LONG
-template void TaggedSend( const long long int* buf, int count, int to, int tag, Comm comm );
-template void TaggedSend( const unsigned long long* buf, int count, int to, int tag, Comm comm  );
+template void TaggedSend( const long long int* buf, Offset count, int to, int tag, Comm comm );
+template void TaggedSend( const unsigned long long* buf, Offset count, int to, int tag, Comm comm  );
 #endif
-template void TaggedSend( const float* buf, int count, int to, int tag, Comm comm );
-template void TaggedSend( const double* buf, int count, int to, int tag, Comm comm );
-template void TaggedSend( const std::complex<float>* buf, int count, int to, int tag, Comm comm );
-template void TaggedSend( const std::complex<double>* buf, int count, int to, int tag, Comm comm );
+template void TaggedSend( const float* buf, Offset count, int to, int tag, Comm comm );
+template void TaggedSend( const double* buf, Offset count, int to, int tag, Comm comm );
+template void TaggedSend( const std::complex<float>* buf, Offset count, int to, int tag, Comm comm );
+template void TaggedSend( const std::complex<double>* buf, Offset count, int to, int tag, Comm comm );
 
 template<typename T>
-void Send( const T* buf, int count, int to, Comm comm )
+void Send( const T* buf, Offset count, int to, Comm comm )
 { TaggedSend( buf, count, to, 0, comm ); }
 
-template void Send( const byte* buf, int count, int to, Comm comm );
-template void Send( const int* buf, int count, int to, Comm comm );
-template void Send( const unsigned* buf, int count, int to, Comm comm );
-template void Send( const long int* buf, int count, int to, Comm comm );
-template void Send( const unsigned long* buf, int count, int to, Comm comm );
+template void Send( const byte* buf, Offset count, int to, Comm comm );
+template void Send( const int* buf, Offset count, int to, Comm comm );
+template void Send( const unsigned* buf, Offset count, int to, Comm comm );
+template void Send( const long int* buf, Offset count, int to, Comm comm );
+template void Send( const unsigned long* buf, Offset count, int to, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
-template void Send( const long long int* buf, int count, int to, Comm comm );
-template void Send( const unsigned long long* buf, int count, int to, Comm comm );
+template void Send( const long long int* buf, Offset count, int to, Comm comm );
+template void Send( const unsigned long long* buf, Offset count, int to, Comm comm );
 #endif
-template void Send( const float* buf, int count, int to, Comm comm );
-template void Send( const double* buf, int count, int to, Comm comm );
-template void Send( const std::complex<float>* buf, int count, int to, Comm comm );
-template void Send( const std::complex<double>* buf, int count, int to, Comm comm );
+template void Send( const float* buf, Offset count, int to, Comm comm );
+template void Send( const double* buf, Offset count, int to, Comm comm );
+template void Send( const std::complex<float>* buf, Offset count, int to, Comm comm );
+template void Send( const std::complex<double>* buf, Offset count, int to, Comm comm );
 
 template<typename T>
 void TaggedSend( T b, int to, int tag, Comm comm )
@@ -557,58 +879,76 @@ template void TaggedISSend( std::complex<float> b, int to, int tag, Comm comm, R
 template void TaggedISSend( std::complex<double> b, int to, int tag, Comm comm, Request& request );
 
 template<typename R>
-void TaggedRecv( R* buf, int count, int from, int tag, Comm comm )
+void TaggedRecv( R* buf, Offset count, int from, int tag, Comm comm )
 {
     Status status;
-    SafeMpi
-    ( MPI_Recv( buf, count, TypeMap<R>(), from, tag, comm, &status ) );
+    do
+    {
+        const int chunk = ChunkSize( count, MAX_MSG_COUNT );
+        SafeMpi
+        ( MPI_Recv( buf, chunk, TypeMap<R>(), from, tag, comm, &status ) );
+        // Later chunks must match the first one's sender and tag
+        from = status.MPI_SOURCE;
+        tag = status.MPI_TAG;
+        buf += chunk;
+        count -= chunk;
+    } while( count > 0 );
 }
 
 template<typename R>
-void TaggedRecv( std::complex<R>* buf, int count, int from, int tag, Comm comm )
+void TaggedRecv( std::complex<R>* buf, Offset count, int from, int tag, Comm comm )
 {
     Status status;
+    do
+    {
 #ifdef AVOID_COMPLEX_MPI
-    SafeMpi
-    ( MPI_Recv( buf, 2*count, TypeMap<R>(), from, tag, comm, &status ) );
+        const int chunk = ChunkSize( count, MAX_MSG_COUNT/2 );
+        SafeMpi
+        ( MPI_Recv( buf, 2*chunk, TypeMap<R>(), from, tag, comm, &status ) );
 #else
-    SafeMpi
-    ( MPI_Recv
-      ( buf, count, TypeMap<std::complex<R> >(), from, tag, comm, &status ) );
+        const int chunk = ChunkSize( count, MAX_MSG_COUNT );
+        SafeMpi
+        ( MPI_Recv
+          ( buf, chunk, TypeMap<std::complex<R> >(), from, tag, comm, &status ) );
 #endif
+        from = status.MPI_SOURCE;
+        tag = status.MPI_TAG;
+        buf += chunk;
+        count -= chunk;
+    } while( count > 0 );
 }
 
-template void TaggedRecv( byte* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( int* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( unsigned* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( long int* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( unsigned long* buf, int count, int from, int tag, Comm comm );
+template void TaggedRecv( byte* buf, Offset count, int from, int tag, Comm comm );
+template void TaggedRecv( int* buf, Offset count, int from, int tag, Comm comm );
+template void TaggedRecv( unsigned* buf, Offset count, int from, int tag, Comm comm );
+template void TaggedRecv( long int* buf, Offset count, int from, int tag, Comm comm );
+template void TaggedRecv( unsigned long* buf, Offset count, int from, int tag, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
-template void TaggedRecv( long long int* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( unsigned long long* buf, int count, int from, int tag, Comm comm );
+template void TaggedRecv( long long int* buf, Offset count, int from, int tag, Comm comm );
+template void TaggedRecv( unsigned long long* buf, Offset count, int from, int tag, Comm comm );
 #endif
-template void TaggedRecv( float* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( double* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( std::complex<float>* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( std::complex<double>* buf, int count, int from, int tag, Comm comm );
+template void TaggedRecv( float* buf, Offset count, int from, int tag, Comm comm );
+template void TaggedRecv( double* buf, Offset count, int from, int tag, Comm comm );
+template void TaggedRecv( std::complex<float>* buf, Offset count, int from, int tag, Comm comm );
+template void TaggedRecv( std::complex<double>* buf, Offset count, int from, int tag, Comm comm );
 
 template<typename T>
-void Recv( T* buf, int count, int from, Comm comm )
+void Recv( T* buf, Offset count, int from, Comm comm )
 { TaggedRecv( buf, count, from, mpi::ANY_TAG, comm ); }
 
-template void Recv( byte* buf, int count, int from, Comm comm );
-template void Recv( int* buf, int count, int from, Comm comm );
-template void Recv( unsigned* buf, int count, int from, Comm comm );
-template void Recv( long int* buf, int count, int from, Comm comm );
-template void Recv( unsigned long* buf, int count, int from, Comm comm );
+template void Recv( byte* buf, Offset count, int from, Comm comm );
+template void Recv( int* buf, Offset count, int from, Comm comm );
+template void Recv( unsigned* buf, Offset count, int from, Comm comm );
+template void Recv( long int* buf, Offset count, int from, Comm comm );
+template void Recv( unsigned long* buf, Offset count, int from, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
-template void Recv( long long int* buf, int count, int from, Comm comm );
-template void Recv( unsigned long long* buf, int count, int from, Comm comm );
+template void Recv( long long int* buf, Offset count, int from, Comm comm );
+template void Recv( unsigned long long* buf, Offset count, int from, Comm comm );
 #endif
-template void Recv( float* buf, int count, int from, Comm comm );
-template void Recv( double* buf, int count, int from, Comm comm );
-template void Recv( std::complex<float>* buf, int count, int from, Comm comm );
-template void Recv( std::complex<double>* buf, int count, int from, Comm comm );
+template void Recv( float* buf, Offset count, int from, Comm comm );
+template void Recv( double* buf, Offset count, int from, Comm comm );
+template void Recv( std::complex<float>* buf, Offset count, int from, Comm comm );
+template void Recv( std::complex<double>* buf, Offset count, int from, Comm comm );
 
 template<typename T>
 T TaggedRecv( int from, int tag, Comm comm )
@@ -738,9 +1078,16 @@ template std::complex<double> IRecv( int from, Comm comm, Request& request );
 
 template<typename R>
 void TaggedSendRecv
-( const R* sbuf, int sc, int to,   int stag,
-        R* rbuf, int rc, int from, int rtag, Comm comm )
+( const R* sbuf, Offset sc, int to,   int stag,
+        R* rbuf, Offset rc, int from, int rtag, Comm comm )
 {
+    if( sc > Offset(MAX_MSG_COUNT) || rc > Offset(MAX_MSG_COUNT) )
+    {
+        ChunkedSendRecv
+        ( sbuf, sc, TypeMap<R>(), to, stag, rbuf, rc, from, rtag, comm,
+          MAX_MSG_COUNT );
+        return;
+    }
     Status status;
     SafeMpi
     ( MPI_Sendrecv
@@ -751,17 +1098,22 @@ void TaggedSendRecv
 
 template<typename R>
 void TaggedSendRecv
-( const std::complex<R>* sbuf, int sc, int to,   int stag,
-        std::complex<R>* rbuf, int rc, int from, int rtag, Comm comm )
+( const std::complex<R>* sbuf, Offset sc, int to,   int stag,
+        std::complex<R>* rbuf, Offset rc, int from, int rtag, Comm comm )
 {
-    Status status;
 #ifdef AVOID_COMPLEX_MPI
-    SafeMpi
-    ( MPI_Sendrecv
-      ( const_cast<std::complex<R>*>(sbuf), 2*sc, TypeMap<R>(), to,   stag,
-        rbuf,                          2*rc, TypeMap<R>(), from, rtag,
-        comm, &status ) );
+    TaggedSendRecv
+    ( reinterpret_cast<const R*>(sbuf), 2*sc, to,   stag,
+      reinterpret_cast<R*>(rbuf),       2*rc, from, rtag, comm );
 #else
+    if( sc > Offset(MAX_MSG_COUNT) || rc > Offset(MAX_MSG_COUNT) )
+    {
+        ChunkedSendRecv
+        ( sbuf, sc, TypeMap<std::complex<R> >(), to, stag,
+          rbuf, rc, from, rtag, comm, MAX_MSG_COUNT );
+        return;
+    }
+    Status status;
     SafeMpi
     ( MPI_Sendrecv
       ( const_cast<std::complex<R>*>(sbuf),
@@ -772,82 +1124,82 @@ void TaggedSendRecv
 }
 
 template void TaggedSendRecv
-( const byte* sbuf, int sc, int to, int stag,
-        byte* rbuf, int rc, int from, int rtag, Comm comm );
+( const byte* sbuf, Offset sc, int to, int stag,
+        byte* rbuf, Offset rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const int* sbuf, int sc, int to, int stag,
-        int* rbuf, int rc, int from, int rtag, Comm comm );
+( const int* sbuf, Offset sc, int to, int stag,
+        int* rbuf, Offset rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const unsigned* sbuf, int sc, int to, int stag,
-        unsigned* rbuf, int rc, int from, int rtag, Comm comm );
+( const unsigned* sbuf, Offset sc, int to, int stag,
+        unsigned* rbuf, Offset rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const long int* sbuf, int sc, int to, int stag,
-        long int* rbuf, int rc, int from, int rtag, Comm comm );
+( const long int* sbuf, Offset sc, int to, int stag,
+        long int* rbuf, Offset rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const unsigned long* sbuf, int sc, int to, int stag,
-        unsigned long* rbuf, int rc, int from, int rtag, Comm comm );
+( const unsigned long* sbuf, Offset sc, int to, int stag,
+        unsigned long* rbuf, Offset rc, int from, int rtag, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
 template void TaggedSendRecv
-( const long long int* sbuf, int sc, int to, int stag,
-        long long int* rbuf, int rc, int from, int rtag, Comm comm );
+( const long long int* sbuf, Offset sc, int to, int stag,
+        long long int* rbuf, Offset rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const unsigned long long* sbuf, int sc, int to, int stag,
-        unsigned long long* rbuf, int rc, int from, int rtag, Comm comm );
+( const unsigned long long* sbuf, Offset sc, int to, int stag,
+        unsigned long long* rbuf, Offset rc, int from, int rtag, Comm comm );
 #endif
 template void TaggedSendRecv
-( const float* sbuf, int sc, int to, int stag,
-        float* rbuf, int rc, int from, int rtag, Comm comm );
+( const float* sbuf, Offset sc, int to, int stag,
+        float* rbuf, Offset rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const double* sbuf, int sc, int to, int stag,
-        double* rbuf, int rc, int from, int rtag, Comm comm );
+( const double* sbuf, Offset sc, int to, int stag,
+        double* rbuf, Offset rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const std::complex<float>* sbuf, int sc, int to, int stag,
-        std::complex<float>* rbuf, int rc, int from, int rtag, Comm comm );
+( const std::complex<float>* sbuf, Offset sc, int to, int stag,
+        std::complex<float>* rbuf, Offset rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const std::complex<double>* sbuf, int sc, int to, int stag,
-        std::complex<double>* rbuf, int rc, int from, int rtag, Comm comm );
+( const std::complex<double>* sbuf, Offset sc, int to, int stag,
+        std::complex<double>* rbuf, Offset rc, int from, int rtag, Comm comm );
 
 template<typename T>
 void SendRecv
-( const T* sbuf, int sc, int to,
-        T* rbuf, int rc, int from, Comm comm )
+( const T* sbuf, Offset sc, int to,
+        T* rbuf, Offset rc, int from, Comm comm )
 { TaggedSendRecv( sbuf, sc, to, 0, rbuf, rc, from, mpi::ANY_TAG, comm ); }
 
 template void SendRecv
-( const byte* sbuf, int sc, int to,
-        byte* rbuf, int rc, int from, Comm comm );
+( const byte* sbuf, Offset sc, int to,
+        byte* rbuf, Offset rc, int from, Comm comm );
 template void SendRecv
-( const int* sbuf, int sc, int to,
-        int* rbuf, int rc, int from, Comm comm );
+( const int* sbuf, Offset sc, int to,
+        int* rbuf, Offset rc, int from, Comm comm );
 template void SendRecv
-( const unsigned* sbuf, int sc, int to,
-        unsigned* rbuf, int rc, int from, Comm comm );
+( const unsigned* sbuf, Offset sc, int to,
+        unsigned* rbuf, Offset rc, int from, Comm comm );
 template void SendRecv
-( const long int* sbuf, int sc, int to,
-        long int* rbuf, int rc, int from, Comm comm );
+( const long int* sbuf, Offset sc, int to,
+        long int* rbuf, Offset rc, int from, Comm comm );
 template void SendRecv
-( const unsigned long* sbuf, int sc, int to,
-        unsigned long* rbuf, int rc, int from, Comm comm );
+( const unsigned long* sbuf, Offset sc, int to,
+        unsigned long* rbuf, Offset rc, int from, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
 template void SendRecv
-( const long long int* sbuf, int sc, int to,
-        long long int* rbuf, int rc, int from, Comm comm );
+( const long long int* sbuf, Offset sc, int to,
+        long long int* rbuf, Offset rc, int from, Comm comm );
 template void SendRecv
-( const unsigned long long* sbuf, int sc, int to,
-        unsigned long long* rbuf, int rc, int from, Comm comm );
+( const unsigned long long* sbuf, Offset sc, int to,
+        unsigned long long* rbuf, Offset rc, int from, Comm comm );
 #endif
 template void SendRecv
-( const float* sbuf, int sc, int to,
-        float* rbuf, int rc, int from, Comm comm );
+( const float* sbuf, Offset sc, int to,
+        float* rbuf, Offset rc, int from, Comm comm );
 template void SendRecv
-( const double* sbuf, int sc, int to,
-        double* rbuf, int rc, int from, Comm comm );
+( const double* sbuf, Offset sc, int to,
+        double* rbuf, Offset rc, int from, Comm comm );
 template void SendRecv
-( const std::complex<float>* sbuf, int sc, int to,
-        std::complex<float>* rbuf, int rc, int from, Comm comm );
+( const std::complex<float>* sbuf, Offset sc, int to,
+        std::complex<float>* rbuf, Offset rc, int from, Comm comm );
 template void SendRecv
-( const std::complex<double>* sbuf, int sc, int to,
-        std::complex<double>* rbuf, int rc, int from, Comm comm );
+( const std::complex<double>* sbuf, Offset sc, int to,
+        std::complex<double>* rbuf, Offset rc, int from, Comm comm );
 
 template<typename T>
 T TaggedSendRecv( T sb, int to, int stag, int from, int rtag, Comm comm )
@@ -986,34 +1338,43 @@ template void SendRecv
 ( std::complex<double>* buf, int count, int to, int from, Comm comm );
 
 template<typename R>
-void Broadcast( R* buf, int count, int root, Comm comm )
+void Broadcast( R* buf, Offset count, int root, Comm comm )
 {
-    SafeMpi( MPI_Bcast( buf, count, TypeMap<R>(), root, comm ) );
+#ifdef HAVE_MPI_LARGE_COUNT
+    SafeMpi( MPI_Bcast_c( buf, count, TypeMap<R>(), root, comm ) );
+#else
+    const LargeCount c( count, TypeMap<R>() );
+    SafeMpi( MPI_Bcast( buf, c.count, c.type, root, comm ) );
+#endif
 }
 
 template<typename R>
-void Broadcast( std::complex<R>* buf, int count, int root, Comm comm )
+void Broadcast( std::complex<R>* buf, Offset count, int root, Comm comm )
 {
 #ifdef AVOID_COMPLEX_MPI
-    SafeMpi( MPI_Bcast( buf, 2*count, TypeMap<R>(), root, comm ) );
+    Broadcast( reinterpret_cast<R*>(buf), 2*count, root, comm );
+#elif defined(HAVE_MPI_LARGE_COUNT)
+    SafeMpi
+    ( MPI_Bcast_c( buf, count, TypeMap<std::complex<R> >(), root, comm ) );
 #else
-    SafeMpi( MPI_Bcast( buf, count, TypeMap<std::complex<R> >(), root, comm ) );
+    const LargeCount c( count, TypeMap<std::complex<R> >() );
+    SafeMpi( MPI_Bcast( buf, c.count, c.type, root, comm ) );
 #endif
 }
 
-template void Broadcast( byte* buf, int count, int root, Comm comm );
-template void Broadcast( int* buf, int count, int root, Comm comm );
-template void Broadcast( unsigned* buf, int count, int root, Comm comm );
-template void Broadcast( long int* buf, int count, int root, Comm comm );
-template void Broadcast( unsigned long* buf, int count, int root, Comm comm );
+template void Broadcast( byte* buf, Offset count, int root, Comm comm );
+template void Broadcast( int* buf, Offset count, int root, Comm comm );
+template void Broadcast( unsigned* buf, Offset count, int root, Comm comm );
+template void Broadcast( long int* buf, Offset count, int root, Comm comm );
+template void Broadcast( unsigned long* buf, Offset count, int root, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
-template void Broadcast( long long int* buf, int count, int root, Comm comm );
-template void Broadcast( unsigned long long* buf, int count, int root, Comm comm );
+template void Broadcast( long long int* buf, Offset count, int root, Comm comm );
+template void Broadcast( unsigned long long* buf, Offset count, int root, Comm comm );
 #endif
-template void Broadcast( float* buf, int count, int root, Comm comm );
-template void Broadcast( double* buf, int count, int root, Comm comm );
-template void Broadcast( std::complex<float>* buf, int count, int root, Comm comm );
-template void Broadcast( std::complex<double>* buf, int count, int root, Comm comm );
+template void Broadcast( float* buf, Offset count, int root, Comm comm );
+template void Broadcast( double* buf, Offset count, int root, Comm comm );
+template void Broadcast( std::complex<float>* buf, Offset count, int root, Comm comm );
+template void Broadcast( std::complex<double>* buf, Offset count, int root, Comm comm );
 
 template<typename T>
 void Broadcast( T& b, int root, Comm comm )
@@ -1089,47 +1450,61 @@ template void IBroadcast( std::complex<double>& b, int root, Comm comm, Request&
 
 template<typename R>
 void Gather
-( const R* sbuf, int sc,
-        R* rbuf, int rc, int root, Comm comm )
+( const R* sbuf, Offset sc,
+        R* rbuf, Offset rc, int root, Comm comm )
 {
+#ifdef HAVE_MPI_LARGE_COUNT
     SafeMpi
-    ( MPI_Gather
+    ( MPI_Gather_c
       ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
         rbuf,                 rc, TypeMap<R>(), root, comm ) );
+#else
+    const LargeCount s( sc, TypeMap<R>() ), r( rc, TypeMap<R>() );
+    SafeMpi
+    ( MPI_Gather
+      ( const_cast<R*>(sbuf), s.count, s.type,
+        rbuf,                 r.count, r.type, root, comm ) );
+#endif
 }
 
 template<typename R>
 void Gather
-( const std::complex<R>* sbuf, int sc,
-        std::complex<R>* rbuf, int rc, int root, Comm comm )
+( const std::complex<R>* sbuf, Offset sc,
+        std::complex<R>* rbuf, Offset rc, int root, Comm comm )
 {
 #ifdef AVOID_COMPLEX_MPI
+    Gather
+    ( reinterpret_cast<const R*>(sbuf), 2*sc,
+      reinterpret_cast<R*>(rbuf),       2*rc, root, comm );
+#elif defined(HAVE_MPI_LARGE_COUNT)
     SafeMpi
-    ( MPI_Gather
-      ( const_cast<std::complex<R>*>(sbuf), 2*sc, TypeMap<R>(),
-        rbuf,                          2*rc, TypeMap<R>(), root, comm ) );
-#else
-    SafeMpi
-    ( MPI_Gather
+    ( MPI_Gather_c
       ( const_cast<std::complex<R>*>(sbuf), sc, TypeMap<std::complex<R> >(),
         rbuf,                          rc, TypeMap<std::complex<R> >(),
         root, comm ) );
+#else
+    const LargeCount s( sc, TypeMap<std::complex<R> >() ),
+                     r( rc, TypeMap<std::complex<R> >() );
+    SafeMpi
+    ( MPI_Gather
+      ( const_cast<std::complex<R>*>(sbuf), s.count, s.type,
+        rbuf,                          r.count, r.type, root, comm ) );
 #endif
 }
 
-template void Gather( const byte* sbuf, int sc, byte* rbuf, int rc, int root, Comm comm );
-template void Gather( const int* sbuf, int sc, int* rbuf, int rc, int root, Comm comm );
-template void Gather( const unsigned* sbuf, int sc, unsigned* rbuf, int rc, int root, Comm comm );
-template void Gather( const long int* sbuf, int sc, long int* rbuf, int rc, int root, Comm comm );
-template void Gather( const unsigned long* sbuf, int sc, unsigned long* rbuf, int rc, int root, Comm comm );
+template void Gather( const byte* sbuf, Offset sc, byte* rbuf, Offset rc, int root, Comm comm );
+template void Gather( const int* sbuf, Offset sc, int* rbuf, Offset rc, int root, Comm comm );
+template void Gather( const unsigned* sbuf, Offset sc, unsigned* rbuf, Offset rc, int root, Comm comm );
+template void Gather( const long int* sbuf, Offset sc, long int* rbuf, Offset rc, int root, Comm comm );
+template void Gather( const unsigned long* sbuf, Offset sc, unsigned long* rbuf, Offset rc, int root, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
-template void Gather( const long long int* sbuf, int sc, long long int* rbuf, int rc, int root, Comm comm );
-template void Gather( const unsigned long long* sbuf, int sc, unsigned long long* rbuf, int rc, int root, Comm comm );
+template void Gather( const long long int* sbuf, Offset sc, long long int* rbuf, Offset rc, int root, Comm comm );
+template void Gather( const unsigned long long* sbuf, Offset sc, unsigned long long* rbuf, Offset rc, int root, Comm comm );
 #endif
-template void Gather( const float* sbuf, int sc, float* rbuf, int rc, int root, Comm comm );
-template void Gather( const double* sbuf, int sc, double* rbuf, int rc, int root, Comm comm );
-template void Gather( const std::complex<float>* sbuf, int sc, std::complex<float>* rbuf, int rc, int root, Comm comm );
-template void Gather( const std::complex<double>* sbuf, int sc, std::complex<double>* rbuf, int rc, int root, Comm comm );
+template void Gather( const float* sbuf, Offset sc, float* rbuf, Offset rc, int root, Comm comm );
+template void Gather( const double* sbuf, Offset sc, double* rbuf, Offset rc, int root, Comm comm );
+template void Gather( const std::complex<float>* sbuf, Offset sc, std::complex<float>* rbuf, Offset rc, int root, Comm comm );
+template void Gather( const std::complex<double>* sbuf, Offset sc, std::complex<double>* rbuf, Offset rc, int root, Comm comm );
 
 #ifdef HAVE_NONBLOCKING_COLLECTIVES
 template<typename R>
@@ -1297,61 +1672,67 @@ template void Gather
 
 template<typename R>
 void AllGather
-( const R* sbuf, int sc,
-        R* rbuf, int rc, Comm comm )
+( const R* sbuf, Offset sc,
+        R* rbuf, Offset rc, Comm comm )
 {
 #ifdef USE_BYTE_ALLGATHERS
+    const MPI_Datatype type = MPI_UNSIGNED_CHAR;
+    sc *= sizeof(R);
+    rc *= sizeof(R);
+#else
+    const MPI_Datatype type = TypeMap<R>();
+#endif
+#ifdef HAVE_MPI_LARGE_COUNT
     SafeMpi
-    ( MPI_Allgather
-      ( const_cast<R*>(sbuf), sizeof(R)*sc, MPI_UNSIGNED_CHAR,
-        rbuf,                 sizeof(R)*rc, MPI_UNSIGNED_CHAR, comm ) );
+    ( MPI_Allgather_c
+      ( const_cast<R*>(sbuf), sc, type,
+        rbuf,                 rc, type, comm ) );
 #else
+    const LargeCount s( sc, type ), r( rc, type );
     SafeMpi
     ( MPI_Allgather
-      ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
-        rbuf,                 rc, TypeMap<R>(), comm ) );
+      ( const_cast<R*>(sbuf), s.count, s.type,
+        rbuf,                 r.count, r.type, comm ) );
 #endif
 }
 
 template<typename R>
 void AllGather
-( const std::complex<R>* sbuf, int sc,
-        std::complex<R>* rbuf, int rc, Comm comm )
+( const std::complex<R>* sbuf, Offset sc,
+        std::complex<R>* rbuf, Offset rc, Comm comm )
 {
-#ifdef USE_BYTE_ALLGATHERS
+#if defined(USE_BYTE_ALLGATHERS) || defined(AVOID_COMPLEX_MPI)
+    AllGather
+    ( reinterpret_cast<const R*>(sbuf), 2*sc,
+      reinterpret_cast<R*>(rbuf),       2*rc, comm );
+#elif defined(HAVE_MPI_LARGE_COUNT)
     SafeMpi
-    ( MPI_Allgather
-      ( const_cast<std::complex<R>*>(sbuf), 2*sizeof(R)*sc, MPI_UNSIGNED_CHAR,
-        rbuf,                          2*sizeof(R)*rc, MPI_UNSIGNED_CHAR,
-        comm ) );
+    ( MPI_Allgather_c
+      ( const_cast<std::complex<R>*>(sbuf), sc, TypeMap<std::complex<R> >(),
+        rbuf,                          rc, TypeMap<std::complex<R> >(), comm ) );
 #else
- #ifdef AVOID_COMPLEX_MPI
+    const LargeCount s( sc, TypeMap<std::complex<R> >() ),
+                     r( rc, TypeMap<std::complex<R> >() );
     SafeMpi
     ( MPI_Allgather
-      ( const_cast<std::complex<R>*>(sbuf), 2*sc, TypeMap<R>(),
-        rbuf,                          2*rc, TypeMap<R>(), comm ) );
- #else
-    SafeMpi
-    ( MPI_Allgather
-      ( const_cast<std::complex<R>*>(sbuf), sc, TypeMap<std::complex<R> >(),
-        rbuf,                          rc, TypeMap<std::complex<R> >(), comm ) );
- #endif
+      ( const_cast<std::complex<R>*>(sbuf), s.count, s.type,
+        rbuf,                          r.count, r.type, comm ) );
 #endif
 }
 
-template void AllGather( const byte* sbuf, int sc, byte* rbuf, int rc, Comm comm );
-template void AllGather( const int* sbuf, int sc, int* rbuf, int rc, Comm comm );
-template void AllGather( const unsigned* sbuf, int sc, unsigned* rbuf, int rc, Comm comm );
-template void AllGather( const long int* sbuf, int sc, long int* rbuf, int rc, Comm comm );
-template void AllGather( const unsigned long* sbuf, int sc, unsigned long* rbuf, int rc, Comm comm );
+template void AllGather( const byte* sbuf, Offset sc, byte* rbuf, Offset rc, Comm comm );
+template void AllGather( const int* sbuf, Offset sc, int* rbuf, Offset rc, Comm comm );
+template void AllGather( const unsigned* sbuf, Offset sc, unsigned* rbuf, Offset rc, Comm comm );
+template void AllGather( const long int* sbuf, Offset sc, long int* rbuf, Offset rc, Comm comm );
+template void AllGather( const unsigned long* sbuf, Offset sc, unsigned long* rbuf, Offset rc, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
-template void AllGather( const long long int* sbuf, int sc, long long int* rbuf, int rc, Comm comm );
-template void AllGather( const unsigned long long* sbuf, int sc, unsigned long long* rbuf, int rc, Comm comm );
+template void AllGather( const long long int* sbuf, Offset sc, long long int* rbuf, Offset rc, Comm comm );
+template void AllGather( const unsigned long long* sbuf, Offset sc, unsigned long long* rbuf, Offset rc, Comm comm );
 #endif
-template void AllGather( const float* sbuf, int sc, float* rbuf, int rc, Comm comm );
-template void AllGather( const double* sbuf, int sc, double* rbuf, int rc, Comm comm );
-template void AllGather( const std::complex<float>* sbuf, int sc, std::complex<float>* rbuf, int rc, Comm comm );
-template void AllGather( const std::complex<double>* sbuf, int sc, std::complex<double>* rbuf, int rc, Comm comm );
+template void AllGather( const float* sbuf, Offset sc, float* rbuf, Offset rc, Comm comm );
+template void AllGather( const double* sbuf, Offset sc, double* rbuf, Offset rc, Comm comm );
+template void AllGather( const std::complex<float>* sbuf, Offset sc, std::complex<float>* rbuf, Offset rc, Comm comm );
+template void AllGather( const std::complex<double>* sbuf, Offset sc, std::complex<double>* rbuf, Offset rc, Comm comm );
 
 template<typename R>
 void AllGather
@@ -1467,69 +1848,83 @@ template void AllGather
 
 template<typename R>
 void Scatter
-( const R* sbuf, int sc,
-        R* rbuf, int rc, int root, Comm comm )
+( const R* sbuf, Offset sc,
+        R* rbuf, Offset rc, int root, Comm comm )
 {
+#ifdef HAVE_MPI_LARGE_COUNT
     SafeMpi
-    ( MPI_Scatter
+    ( MPI_Scatter_c
       ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
         rbuf,                 rc, TypeMap<R>(), root, comm ) );
+#else
+    const LargeCount s( sc, TypeMap<R>() ), r( rc, TypeMap<R>() );
+    SafeMpi
+    ( MPI_Scatter
+      ( const_cast<R*>(sbuf), s.count, s.type,
+        rbuf,                 r.count, r.type, root, comm ) );
+#endif
 }
 
 template<typename R>
 void Scatter
-( const std::complex<R>* sbuf, int sc,
-        std::complex<R>* rbuf, int rc, int root, Comm comm )
+( const std::complex<R>* sbuf, Offset sc,
+        std::complex<R>* rbuf, Offset rc, int root, Comm comm )
 {
 #ifdef AVOID_COMPLEX_MPI
+    Scatter
+    ( reinterpret_cast<const R*>(sbuf), 2*sc,
+      reinterpret_cast<R*>(rbuf),       2*rc, root, comm );
+#elif defined(HAVE_MPI_LARGE_COUNT)
     SafeMpi
-    ( MPI_Scatter
-      ( const_cast<std::complex<R>*>(sbuf), 2*sc, TypeMap<R>(),
-        rbuf,                          2*rc, TypeMap<R>(), root, comm ) );
-#else
-    SafeMpi
-    ( MPI_Scatter
+    ( MPI_Scatter_c
       ( const_cast<std::complex<R>*>(sbuf), sc, TypeMap<std::complex<R> >(),
         rbuf,                          rc, TypeMap<std::complex<R> >(),
         root, comm ) );
+#else
+    const LargeCount s( sc, TypeMap<std::complex<R> >() ),
+                     r( rc, TypeMap<std::complex<R> >() );
+    SafeMpi
+    ( MPI_Scatter
+      ( const_cast<std::complex<R>*>(sbuf), s.count, s.type,
+        rbuf,                          r.count, r.type, root, comm ) );
 #endif
 }
 
 template void Scatter
-( const byte* sbuf, int sc,
-        byte* rbuf, int rc, int root, Comm comm );
+( const byte* sbuf, Offset sc,
+        byte* rbuf, Offset rc, int root, Comm comm );
 template void Scatter
-( const int* sbuf, int sc,
-        int* rbuf, int rc, int root, Comm comm );
+( const int* sbuf, Offset sc,
+        int* rbuf, Offset rc, int root, Comm comm );
 template void Scatter
-( const unsigned* sbuf, int sc,
-        unsigned* rbuf, int rc, int root, Comm comm );
+( const unsigned* sbuf, Offset sc,
+        unsigned* rbuf, Offset rc, int root, Comm comm );
 template void Scatter
-( const long int* sbuf, int sc,
-        long int* rbuf, int rc, int root, Comm comm );
+( const long int* sbuf, Offset sc,
+        long int* rbuf, Offset rc, int root, Comm comm );
 template void Scatter
-( const unsigned long* sbuf, int sc,
-        unsigned long* rbuf, int rc, int root, Comm comm );
+( const unsigned long* sbuf, Offset sc,
+        unsigned long* rbuf, Offset rc, int root, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
 template void Scatter
-( const long long int* sbuf, int sc,
-        long long int* rbuf, int rc, int root, Comm comm );
+( const long long int* sbuf, Offset sc,
+        long long int* rbuf, Offset rc, int root, Comm comm );
 template void Scatter
-( const unsigned long long* sbuf, int sc,
-        unsigned long long* rbuf, int rc, int root, Comm comm );
+( const unsigned long long* sbuf, Offset sc,
+        unsigned long long* rbuf, Offset rc, int root, Comm comm );
 #endif
 template void Scatter
-( const float* sbuf, int sc,
-        float* rbuf, int rc, int root, Comm comm );
+( const float* sbuf, Offset sc,
+        float* rbuf, Offset rc, int root, Comm comm );
 template void Scatter
-( const double* sbuf, int sc,
-        double* rbuf, int rc, int root, Comm comm );
+( const double* sbuf, Offset sc,
+        double* rbuf, Offset rc, int root, Comm comm );
 template void Scatter
-( const std::complex<float>* sbuf, int sc,
-        std::complex<float>* rbuf, int rc, int root, Comm comm );
+( const std::complex<float>* sbuf, Offset sc,
+        std::complex<float>* rbuf, Offset rc, int root, Comm comm );
 template void Scatter
-( const std::complex<double>* sbuf, int sc,
-        std::complex<double>* rbuf, int rc, int root, Comm comm );
+( const std::complex<double>* sbuf, Offset sc,
+        std::complex<double>* rbuf, Offset rc, int root, Comm comm );
 
 template<typename R>
 void Scatter( R* buf, int sc, int rc, int root, Comm comm )
@@ -1629,70 +2024,142 @@ template void Scatter( double* buf, int sc, int rc, int root, Comm comm );
 template void Scatter( std::complex<float>* buf, int sc, int rc, int root, Comm comm );
 template void Scatter( std::complex<double>* buf, int sc, int rc, int root, Comm comm );
 
+#if HAVE_NONBLOCKING
 template<typename R>
-void AllToAll
+void IScatter
 ( const R* sbuf, int sc,
-        R* rbuf, int rc, Comm comm )
+        R* rbuf, int rc, int root, Comm comm, Request& request )
 {
+#ifdef HAVE_MPI3_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Alltoall
+    ( MPI_Iscatter
       ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
-        rbuf,                 rc, TypeMap<R>(), comm ) );
+        rbuf,                 rc, TypeMap<R>(), root, comm, &request ) );
+#else
+    SafeMpi
+    ( MPIX_Iscatter
+      ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
+        rbuf,                 rc, TypeMap<R>(), root, comm, &request ) );
+#endif
 }
 
 template<typename R>
-void AllToAll
+void IScatter
 ( const std::complex<R>* sbuf, int sc,
-        std::complex<R>* rbuf, int rc, Comm comm )
+        std::complex<R>* rbuf, int rc, int root, Comm comm, Request& request )
 {
 #ifdef AVOID_COMPLEX_MPI
+    IScatter
+    ( reinterpret_cast<const R*>(sbuf), 2*sc,
+      reinterpret_cast<R*>(rbuf),       2*rc, root, comm, request );
+#elif defined(HAVE_MPI3_NONBLOCKING_COLLECTIVES)
     SafeMpi
-    ( MPI_Alltoall
-      ( const_cast<std::complex<R>*>(sbuf), 2*sc, TypeMap<R>(),
-        rbuf,                          2*rc, TypeMap<R>(), comm ) );
+    ( MPI_Iscatter
+      ( const_cast<std::complex<R>*>(sbuf), sc, TypeMap<std::complex<R> >(),
+        rbuf,                          rc, TypeMap<std::complex<R> >(),
+        root, comm, &request ) );
 #else
+    SafeMpi
+    ( MPIX_Iscatter
+      ( const_cast<std::complex<R>*>(sbuf), sc, TypeMap<std::complex<R> >(),
+        rbuf,                          rc, TypeMap<std::complex<R> >(),
+        root, comm, &request ) );
+#endif
+}
+
+template void IScatter( const byte* sbuf, int sc, byte* rbuf, int rc, int root, Comm comm, Request& request );
+template void IScatter( const int* sbuf, int sc, int* rbuf, int rc, int root, Comm comm, Request& request );
+template void IScatter( const unsigned* sbuf, int sc, unsigned* rbuf, int rc, int root, Comm comm, Request& request );
+template void IScatter( const long int* sbuf, int sc, long int* rbuf, int rc, int root, Comm comm, Request& request );
+template void IScatter( const unsigned long* sbuf, int sc, unsigned long* rbuf, int rc, int root, Comm comm, Request& request );
+#ifdef HAVE_MPI_LONG_LONG
+template void IScatter( const long long int* sbuf, int sc, long long int* rbuf, int rc, int root, Comm comm, Request& request );
+template void IScatter( const unsigned long long* sbuf, int sc, unsigned long long* rbuf, int rc, int root, Comm comm, Request& request );
+#endif
+template void IScatter( const float* sbuf, int sc, float* rbuf, int rc, int root, Comm comm, Request& request );
+template void IScatter( const double* sbuf, int sc, double* rbuf, int rc, int root, Comm comm, Request& request );
+template void IScatter( const std::complex<float>* sbuf, int sc, std::complex<float>* rbuf, int rc, int root, Comm comm, Request& request );
+template void IScatter( const std::complex<double>* sbuf, int sc, std::complex<double>* rbuf, int rc, int root, Comm comm, Request& request );
+#endif // if HAVE_NONBLOCKING
+
+template<typename R>
+void AllToAll
+( const R* sbuf, Offset sc,
+        R* rbuf, Offset rc, Comm comm )
+{
+#ifdef HAVE_MPI_LARGE_COUNT
+    SafeMpi
+    ( MPI_Alltoall_c
+      ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
+        rbuf,                 rc, TypeMap<R>(), comm ) );
+#else
+    const LargeCount s( sc, TypeMap<R>() ), r( rc, TypeMap<R>() );
     SafeMpi
     ( MPI_Alltoall
+      ( const_cast<R*>(sbuf), s.count, s.type,
+        rbuf,                 r.count, r.type, comm ) );
+#endif
+}
+
+template<typename R>
+void AllToAll
+( const std::complex<R>* sbuf, Offset sc,
+        std::complex<R>* rbuf, Offset rc, Comm comm )
+{
+#ifdef AVOID_COMPLEX_MPI
+    AllToAll
+    ( reinterpret_cast<const R*>(sbuf), 2*sc,
+      reinterpret_cast<R*>(rbuf),       2*rc, comm );
+#elif defined(HAVE_MPI_LARGE_COUNT)
+    SafeMpi
+    ( MPI_Alltoall_c
       ( const_cast<std::complex<R>*>(sbuf), sc, TypeMap<std::complex<R> >(),
         rbuf,                          rc, TypeMap<std::complex<R> >(), comm ) );
+#else
+    const LargeCount s( sc, TypeMap<std::complex<R> >() ),
+                     r( rc, TypeMap<std::complex<R> >() );
+    SafeMpi
+    ( MPI_Alltoall
+      ( const_cast<std::complex<R>*>(sbuf), s.count, s.type,
+        rbuf,                          r.count, r.type, comm ) );
 #endif
 }
 
 template void AllToAll
-( const byte* sbuf, int sc,
-        byte* rbuf, int rc, Comm comm );
+( const byte* sbuf, Offset sc,
+        byte* rbuf, Offset rc, Comm comm );
 template void AllToAll
-( const int* sbuf, int sc,
-        int* rbuf, int rc, Comm comm );
+( const int* sbuf, Offset sc,
+        int* rbuf, Offset rc, Comm comm );
 template void AllToAll
-( const unsigned* sbuf, int sc,
-        unsigned* rbuf, int rc, Comm comm );
+( const unsigned* sbuf, Offset sc,
+        unsigned* rbuf, Offset rc, Comm comm );
 template void AllToAll
-( const long int* sbuf, int sc,
-        long int* rbuf, int rc, Comm comm );
+( const long int* sbuf, Offset sc,
+        long int* rbuf, Offset rc, Comm comm );
 template void AllToAll
-( const unsigned long* sbuf, int sc,
-        unsigned long* rbuf, int rc, Comm comm );
+( const unsigned long* sbuf, Offset sc,
+        unsigned long* rbuf, Offset rc, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
 template void AllToAll
-( const long long int* sbuf, int sc,
-        long long int* rbuf, int rc, Comm comm );
+( const long long int* sbuf, Offset sc,
+        long long int* rbuf, Offset rc, Comm comm );
 template void AllToAll
-( const unsigned long long* sbuf, int sc,
-        unsigned long long* rbuf, int rc, Comm comm );
+( const unsigned long long* sbuf, Offset sc,
+        unsigned long long* rbuf, Offset rc, Comm comm );
 #endif
 template void AllToAll
-( const float* sbuf, int sc,
-        float* rbuf, int rc, Comm comm );
+( const float* sbuf, Offset sc,
+        float* rbuf, Offset rc, Comm comm );
 template void AllToAll
-( const double* sbuf, int sc,
-        double* rbuf, int rc, Comm comm );
+( const double* sbuf, Offset sc,
+        double* rbuf, Offset rc, Comm comm );
 template void AllToAll
-( const std::complex<float>* sbuf, int sc,
-        std::complex<float>* rbuf, int rc, Comm comm );
+( const std::complex<float>* sbuf, Offset sc,
+        std::complex<float>* rbuf, Offset rc, Comm comm );
 template void AllToAll
-( const std::complex<double>* sbuf, int sc,
-        std::complex<double>* rbuf, int rc, Comm comm );
+( const std::complex<double>* sbuf, Offset sc,
+        std::complex<double>* rbuf, Offset rc, Comm comm );
 
 template<typename R>
 void AllToAll
@@ -1788,93 +2255,170 @@ template void AllToAll
 ( const std::complex<double>* sbuf, const int* scs, const int* sds,
         std::complex<double>* rbuf, const int* rcs, const int* rds, Comm comm );
 
+// Without the MPI-4 large-count interface, exchange with one partner per
+// step; TaggedSendRecv splits any message longer than an int can count
+template<typename R>
+void AllToAll
+( const R* sbuf, const Offset* scs, const Offset* sds,
+        R* rbuf, const Offset* rcs, const Offset* rds, Comm comm )
+{
+    const int commSize = CommSize( comm );
+#ifdef HAVE_MPI_LARGE_COUNT
+    std::vector<MPI_Count> sendCounts( scs, scs+commSize ),
+                           recvCounts( rcs, rcs+commSize );
+    std::vector<MPI_Aint> sendDispls( sds, sds+commSize ),
+                          recvDispls( rds, rds+commSize );
+    SafeMpi
+    ( MPI_Alltoallv_c
+      ( const_cast<R*>(sbuf), sendCounts.data(), sendDispls.data(),
+        TypeMap<R>(),
+        rbuf, recvCounts.data(), recvDispls.data(), TypeMap<R>(), comm ) );
+#else
+    const int commRank = CommRank( comm );
+    for( int step=0; step<commSize; ++step )
+    {
+        const int to = (commRank+step) % commSize;
+        const int from = (commRank+commSize-step) % commSize;
+        TaggedSendRecv
+        ( &sbuf[sds[to]],   scs[to],   to,   0,
+          &rbuf[rds[from]], rcs[from], from, 0, comm );
+    }
+#endif
+}
+
+template void AllToAll
+( const byte* sbuf, const Offset* scs, const Offset* sds,
+        byte* rbuf, const Offset* rcs, const Offset* rds, Comm comm );
+template void AllToAll
+( const int* sbuf, const Offset* scs, const Offset* sds,
+        int* rbuf, const Offset* rcs, const Offset* rds, Comm comm );
+template void AllToAll
+( const unsigned* sbuf, const Offset* scs, const Offset* sds,
+        unsigned* rbuf, const Offset* rcs, const Offset* rds, Comm comm );
+template void AllToAll
+( const long int* sbuf, const Offset* scs, const Offset* sds,
+        long int* rbuf, const Offset* rcs, const Offset* rds, Comm comm );
+template void AllToAll
+( const unsigned long* sbuf, const Offset* scs, const Offset* sds,
+        unsigned long* rbuf, const Offset* rcs, const Offset* rds, Comm comm );
+#ifdef HAVE_MPI_LONG_LONG
+template void AllToAll
+( const long long int* sbuf, const Offset* scs, const Offset* sds,
+        long long int* rbuf, const Offset* rcs, const Offset* rds, Comm comm );
+template void AllToAll
+( const unsigned long long* sbuf, const Offset* scs, const Offset* sds,
+        unsigned long long* rbuf, const Offset* rcs, const Offset* rds, Comm comm );
+#endif
+template void AllToAll
+( const float* sbuf, const Offset* scs, const Offset* sds,
+        float* rbuf, const Offset* rcs, const Offset* rds, Comm comm );
+template void AllToAll
+( const double* sbuf, const Offset* scs, const Offset* sds,
+        double* rbuf, const Offset* rcs, const Offset* rds, Comm comm );
+template void AllToAll
+( const std::complex<float>* sbuf, const Offset* scs, const Offset* sds,
+        std::complex<float>* rbuf, const Offset* rcs, const Offset* rds, Comm comm );
+template void AllToAll
+( const std::complex<double>* sbuf, const Offset* scs, const Offset* sds,
+        std::complex<double>* rbuf, const Offset* rcs, const Offset* rds, Comm comm );
+
 template<typename T>
 void Reduce
-( const T* sbuf, T* rbuf, int count, Op op, int root, Comm comm )
+( const T* sbuf, T* rbuf, Offset count, Op op, int root, Comm comm )
 {
-    if( count != 0 )
+    // Reductions are elementwise, so long messages reduce chunk by chunk
+    while( count != 0 )
     {
+        const int chunk = ChunkSize( count, MAX_MSG_COUNT );
         SafeMpi
         ( MPI_Reduce
-          ( const_cast<T*>(sbuf), rbuf, count, TypeMap<T>(),
+          ( const_cast<T*>(sbuf), rbuf, chunk, TypeMap<T>(),
             op, root, comm ) );
+        sbuf += chunk;
+        rbuf += chunk;
+        count -= chunk;
     }
 }
 
 template<typename R>
 void Reduce
 ( const std::complex<R>* sbuf,
-        std::complex<R>* rbuf, int count, Op op, int root, Comm comm )
+        std::complex<R>* rbuf, Offset count, Op op, int root, Comm comm )
 {
-    if( count != 0 )
+    while( count != 0 )
     {
 #ifdef AVOID_COMPLEX_MPI
+        const int chunk = ChunkSize( count, MAX_MSG_COUNT/2 );
         if( op == SUM )
         {
             SafeMpi
             ( MPI_Reduce
               ( const_cast<std::complex<R>*>(sbuf),
-                rbuf, 2*count, TypeMap<R>(), op, root, comm ) );
+                rbuf, 2*chunk, TypeMap<R>(), op, root, comm ) );
         }
         else
         {
             SafeMpi
             ( MPI_Reduce
               ( const_cast<std::complex<R>*>(sbuf),
-                rbuf, count, TypeMap<std::complex<R> >(), op, root, comm ) );
+                rbuf, chunk, TypeMap<std::complex<R> >(), op, root, comm ) );
         }
 #else
+        const int chunk = ChunkSize( count, MAX_MSG_COUNT );
         SafeMpi
         ( MPI_Reduce
           ( const_cast<std::complex<R>*>(sbuf),
-            rbuf, count, TypeMap<std::complex<R> >(), op, root, comm ) );
+            rbuf, chunk, TypeMap<std::complex<R> >(), op, root, comm ) );
 #endif
+        sbuf += chunk;
+        rbuf += chunk;
+        count -= chunk;
     }
 }
 
-template void Reduce( const byte* sbuf, byte* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const int* sbuf, int* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const unsigned* sbuf, unsigned* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const long int* sbuf, long int* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const unsigned long* sbuf, unsigned long* rbuf, int count, Op op, int root, Comm comm );
+template void Reduce( const byte* sbuf, byte* rbuf, Offset count, Op op, int root, Comm comm );
+template void Reduce( const int* sbuf, int* rbuf, Offset count, Op op, int root, Comm comm );
+template void Reduce( const unsigned* sbuf, unsigned* rbuf, Offset count, Op op, int root, Comm comm );
+template void Reduce( const long int* sbuf, long int* rbuf, Offset count, Op op, int root, Comm comm );
+template void Reduce( const unsigned long* sbuf, unsigned long* rbuf, Offset count, Op op, int root, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
-template void Reduce( const long long int* sbuf, long long int* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const unsigned long long* sbuf, unsigned long long* rbuf, int count, Op op, int root, Comm comm );
-#endif
-template void Reduce( const float* sbuf, float* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const double* sbuf, double* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const std::complex<float>* sbuf, std::complex<float>* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const std::complex<double>* sbuf, std::complex<double>* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, int count, Op op, int root, Comm comm );
+template void Reduce( const long long int* sbuf, long long int* rbuf, Offset count, Op op, int root, Comm comm );
+template void Reduce( const unsigned long long* sbuf, unsigned long long* rbuf, Offset count, Op op, int root, Comm comm );
+#endif
+template void Reduce( const float* sbuf, float* rbuf, Offset count, Op op, int root, Comm comm );
+template void Reduce( const double* sbuf, double* rbuf, Offset count, Op op, int root, Comm comm );
+template void Reduce( const std::complex<float>* sbuf, std::complex<float>* rbuf, Offset count, Op op, int root, Comm comm );
+template void Reduce( const std::complex<double>* sbuf, std::complex<double>* rbuf, Offset count, Op op, int root, Comm comm );
+template void Reduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, Offset count, Op op, int root, Comm comm );
+template void Reduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, Offset count, Op op, int root, Comm comm );
+template void Reduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, Offset count, Op op, int root, Comm comm );
+template void Reduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, Offset count, Op op, int root, Comm comm );
+template void Reduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, Offset count, Op op, int root, Comm comm );
+template void Reduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, Offset count, Op op, int root, Comm comm );
 
 template<typename T>
-void Reduce( const T* sbuf, T* rbuf, int count, int root, Comm comm )
+void Reduce( const T* sbuf, T* rbuf, Offset count, int root, Comm comm )
 { Reduce( sbuf, rbuf, count, mpi::SUM, root, comm ); }
 
-template void Reduce( const byte* sbuf, byte* rbuf, int count, int root, Comm comm );
-template void Reduce( const int* sbuf, int* rbuf, int count, int root, Comm comm );
-template void Reduce( const unsigned* sbuf, unsigned* rbuf, int count, int root, Comm comm );
-template void Reduce( const long int* sbuf, long int* rbuf, int count, int root, Comm comm );
-template void Reduce( const unsigned long* sbuf, unsigned long* rbuf, int count, int root, Comm comm );
+template void Reduce( const byte* sbuf, byte* rbuf, Offset count, int root, Comm comm );
+template void Reduce( const int* sbuf, int* rbuf, Offset count, int root, Comm comm );
+template void Reduce( const unsigned* sbuf, unsigned* rbuf, Offset count, int root, Comm comm );
+template void Reduce( const long int* sbuf, long int* rbuf, Offset count, int root, Comm comm );
+template void Reduce( const unsigned long* sbuf, unsigned long* rbuf, Offset count, int root, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
-template void Reduce( const long long int* sbuf, long long int* rbuf, int count, int root, Comm comm );
-template void Reduce( const unsigned long long* sbuf, unsigned long long* rbuf, int count, int root, Comm comm );
-#endif
-template void Reduce( const float* sbuf, float* rbuf, int count, int root, Comm comm );
-template void Reduce( const double* sbuf, double* rbuf, int count, int root, Comm comm );
-template void Reduce( const std::complex<float>* sbuf, std::complex<float>* rbuf, int count, int root, Comm comm );
-template void Reduce( const std::complex<double>* sbuf, std::complex<double>* rbuf, int count, int root, Comm comm );
-template void Reduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, int count, int root, Comm comm );
-template void Reduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, int count, int root, Comm comm );
-template void Reduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, int count, int root, Comm comm );
-template void Reduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, int count, int root, Comm comm );
-template void Reduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, int count, int root, Comm comm );
-template void Reduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, int count, int root, Comm comm );
+template void Reduce( const long long int* sbuf, long long int* rbuf, Offset count, int root, Comm comm );
+template void Reduce( const unsigned long long* sbuf, unsigned long long* rbuf, Offset count, int root, Comm comm );
+#endif
+template void Reduce( const float* sbuf, float* rbuf, Offset count, int root, Comm comm );
+template void Reduce( const double* sbuf, double* rbuf, Offset count, int root, Comm comm );
+template void Reduce( const std::complex<float>* sbuf, std::complex<float>* rbuf, Offset count, int root, Comm comm );
+template void Reduce( const std::complex<double>* sbuf, std::complex<double>* rbuf, Offset count, int root, Comm comm );
+template void Reduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, Offset count, int root, Comm comm );
+template void Reduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, Offset count, int root, Comm comm );
+template void Reduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, Offset count, int root, Comm comm );
+template void Reduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, Offset count, int root, Comm comm );
+template void Reduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, Offset count, int root, Comm comm );
+template void Reduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, Offset count, int root, Comm comm );
 
 template<typename T>
 T Reduce( T sb, Op op, int root, Comm comm )
@@ -2082,89 +2626,98 @@ template void Reduce( ValueIntPair<float>* buf, int count, int root, Comm comm )
 template void Reduce( ValueIntPair<double>* buf, int count, int root, Comm comm );
 
 template<typename T>
-void AllReduce( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
+void AllReduce( const T* sbuf, T* rbuf, Offset count, Op op, Comm comm )
 {
-    if( count != 0 )
+    while( count != 0 )
     {
+        const int chunk = ChunkSize( count, MAX_MSG_COUNT );
         SafeMpi
         ( MPI_Allreduce
-          ( const_cast<T*>(sbuf), rbuf, count, TypeMap<T>(), op, comm ) );
+          ( const_cast<T*>(sbuf), rbuf, chunk, TypeMap<T>(), op, comm ) );
+        sbuf += chunk;
+        rbuf += chunk;
+        count -= chunk;
     }
 }
 
 template<typename R>
 void AllReduce
-( const std::complex<R>* sbuf, std::complex<R>* rbuf, int count, Op op, Comm comm )
+( const std::complex<R>* sbuf, std::complex<R>* rbuf, Offset count, Op op, Comm comm )
 {
-    if( count != 0 )
+    while( count != 0 )
     {
 #ifdef AVOID_COMPLEX_MPI
+        const int chunk = ChunkSize( count, MAX_MSG_COUNT/2 );
         if( op == SUM )
         {
             SafeMpi
             ( MPI_Allreduce
                 ( const_cast<std::complex<R>*>(sbuf),
-                  rbuf, 2*count, TypeMap<R>(), op, comm ) );
+                  rbuf, 2*chunk, TypeMap<R>(), op, comm ) );
         }
         else
         {
             SafeMpi
             ( MPI_Allreduce
               ( const_cast<std::complex<R>*>(sbuf),
-                rbuf, count, TypeMap<std::complex<R> >(), op, comm ) );
+                rbuf, chunk, TypeMap<std::complex<R> >(), op, comm ) );
         }
 #else
+        const int chunk = ChunkSize( count, MAX_MSG_COUNT );
         SafeMpi
         ( MPI_Allreduce
           ( const_cast<std::complex<R>*>(sbuf),
-            rbuf, count, TypeMap<std::complex<R> >(), op, comm ) );
+            rbuf, chunk, TypeMap<std::complex<R> >(), op, comm ) );
 #endif
+        sbuf += chunk;
+        rbuf += chunk;
+        count -= chunk;
     }
 }
 
-template void AllReduce( const byte* sbuf, byte* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const int* sbuf, int* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const unsigned* sbuf, unsigned* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const long int* sbuf, long int* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const unsigned long* sbuf, unsigned long* rbuf, int count, Op op, Comm comm );
+template void AllReduce( const byte* sbuf, byte* rbuf, Offset count, Op op, Comm comm );
+template void AllReduce( const int* sbuf, int* rbuf, Offset count, Op op, Comm comm );
+template void AllReduce( const unsigned* sbuf, unsigned* rbuf, Offset count, Op op, Comm comm );
+template void AllReduce( const long int* sbuf, long int* rbuf, Offset count, Op op, Comm comm );
+template void AllReduce( const unsigned long* sbuf, unsigned long* rbuf, Offset count, Op op, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
-template void AllReduce( const long long int* sbuf, long long int* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const unsigned long long* sbuf, unsigned long long* rbuf, int count, Op op, Comm comm );
-#endif
-template void AllReduce( const float* sbuf, float* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const double* sbuf, double* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const std::complex<float>* sbuf, std::complex<float>* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const std::complex<double>* sbuf, std::complex<double>* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, int count, Op op, Comm comm );
+template void AllReduce( const long long int* sbuf, long long int* rbuf, Offset count, Op op, Comm comm );
+template void AllReduce( const unsigned long long* sbuf, unsigned long long* rbuf, Offset count, Op op, Comm comm );
+#endif
+template void AllReduce( const float* sbuf, float* rbuf, Offset count, Op op, Comm comm );
+template void AllReduce( const double* sbuf, double* rbuf, Offset count, Op op, Comm comm );
+template void AllReduce( const std::complex<float>* sbuf, std::complex<float>* rbuf, Offset count, Op op, Comm comm );
+template void AllReduce( const std::complex<double>* sbuf, std::complex<double>* rbuf, Offset count, Op op, Comm comm );
+template void AllReduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, Offset count, Op op, Comm comm );
+template void AllReduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, Offset count, Op op, Comm comm );
+template void AllReduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, Offset count, Op op, Comm comm );
+template void AllReduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, Offset count, Op op, Comm comm );
+template void AllReduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, Offset count, Op op, Comm comm );
+template void AllReduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, Offset count, Op op, Comm comm );
 
 template<typename T>
-void AllReduce( const T* sbuf, T* rbuf, int count, Comm comm )
+void AllReduce( const T* sbuf, T* rbuf, Offset count, Comm comm )
 { AllReduce( sbuf, rbuf, count, mpi::SUM, comm ); }
 
-template void AllReduce( const byte* sbuf, byte* rbuf, int count, Comm comm );
-template void AllReduce( const int* sbuf, int* rbuf, int count, Comm comm );
-template void AllReduce( const unsigned* sbuf, unsigned* rbuf, int count, Comm comm );
-template void AllReduce( const long int* sbuf, long int* rbuf, int count, Comm comm );
-template void AllReduce( const unsigned long* sbuf, unsigned long* rbuf, int count, Comm comm );
+template void AllReduce( const byte* sbuf, byte* rbuf, Offset count, Comm comm );
+template void AllReduce( const int* sbuf, int* rbuf, Offset count, Comm comm );
+template void AllReduce( const unsigned* sbuf, unsigned* rbuf, Offset count, Comm comm );
+template void AllReduce( const long int* sbuf, long int* rbuf, Offset count, Comm comm );
+template void AllReduce( const unsigned long* sbuf, unsigned long* rbuf, Offset count, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
-template void AllReduce( const long long int* sbuf, long long int* rbuf, int count, Comm comm );
-template void AllReduce( const unsigned long long* sbuf, unsigned long long* rbuf, int count, Comm comm );
-#endif
-template void AllReduce( const float* sbuf, float* rbuf, int count, Comm comm );
-template void AllReduce( const double* sbuf, double* rbuf, int count, Comm comm );
-template void AllReduce( const std::complex<float>* sbuf, std::complex<float>* rbuf, int count, Comm comm );
-template void AllReduce( const std::complex<double>* sbuf, std::complex<double>* rbuf, int count, Comm comm );
-template void AllReduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, int count, Comm comm );
-template void AllReduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, int count, Comm comm );
-template void AllReduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, int count, Comm comm );
-template void AllReduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, int count, Comm comm );
-template void AllReduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, int count, Comm comm );
-template void AllReduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, int count, Comm comm );
+template void AllReduce( const long long int* sbuf, long long int* rbuf, Offset count, Comm comm );
+template void AllReduce( const unsigned long long* sbuf, unsigned long long* rbuf, Offset count, Comm comm );
+#endif
+template void AllReduce( const float* sbuf, float* rbuf, Offset count, Comm comm );
+template void AllReduce( const double* sbuf, double* rbuf, Offset count, Comm comm );
+template void AllReduce( const std::complex<float>* sbuf, std::complex<float>* rbuf, Offset count, Comm comm );
+template void AllReduce( const std::complex<double>* sbuf, std::complex<double>* rbuf, Offset count, Comm comm );
+template void AllReduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, Offset count, Comm comm );
+template void AllReduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, Offset count, Comm comm );
+template void AllReduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, Offset count, Comm comm );
+template void AllReduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, Offset count, Comm comm );
+template void AllReduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, Offset count, Comm comm );
+template void AllReduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, Offset count, Comm comm );
 
 template<typename T>
 T AllReduce( T sb, Op op, Comm comm )
@@ -2328,11 +2881,59 @@ template void AllReduce( ValueIntPair<Int>* buf, int count, Comm comm );
 template void AllReduce( ValueIntPair<float>* buf, int count, Comm comm );
 template void AllReduce( ValueIntPair<double>* buf, int count, Comm comm );
 
+// Reduce-scatter of blocks longer than a single call can describe.  Derived
+// datatypes cannot be combined with the predefined reduction operations, so
+// this either uses the MPI-4 large-count interface or reduces each block onto
+// its owner in turn (Reduce chunks as needed)
+template<typename T>
+void LargeReduceScatter( const T* sbuf, T* rbuf, Offset rc, Op op, Comm comm )
+{
+#ifdef HAVE_MPI_LARGE_COUNT
+    SafeMpi
+    ( MPI_Reduce_scatter_block_c
+      ( const_cast<T*>(sbuf), rbuf, rc, TypeMap<T>(), op, comm ) );
+#else
+    const int commSize = CommSize( comm );
+    for( int q=0; q<commSize; ++q )
+        Reduce( &sbuf[q*rc], rbuf, rc, op, q, comm );
+#endif
+}
+
 template<typename R>
-void ReduceScatter( R* sbuf, R* rbuf, int rc, Op op, Comm comm )
+void LargeReduceScatter
+( const std::complex<R>* sbuf, std::complex<R>* rbuf, Offset rc, Op op,
+  Comm comm )
 {
-#ifdef REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
+#ifdef HAVE_MPI_LARGE_COUNT
+# ifdef AVOID_COMPLEX_MPI
+    SafeMpi
+    ( MPI_Reduce_scatter_block_c
+      ( const_cast<std::complex<R>*>(sbuf), rbuf, 2*rc, TypeMap<R>(), op,
+        comm ) );
+# else
+    SafeMpi
+    ( MPI_Reduce_scatter_block_c
+      ( const_cast<std::complex<R>*>(sbuf), rbuf, rc,
+        TypeMap<std::complex<R> >(), op, comm ) );
+# endif
+#else
     const int commSize = CommSize( comm );
+    for( int q=0; q<commSize; ++q )
+        Reduce( &sbuf[q*rc], rbuf, rc, op, q, comm );
+#endif
+}
+
+template<typename R>
+void ReduceScatter( R* sbuf, R* rbuf, Offset rc, Op op, Comm comm )
+{
+    // The fallbacks below reduce all of the blocks in a single call
+    const int commSize = CommSize( comm );
+    if( rc*commSize > Offset(MAX_MSG_COUNT) )
+    {
+        LargeReduceScatter( sbuf, rbuf, rc, op, comm );
+        return;
+    }
+#ifdef REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commRank = CommRank( comm );
     AllReduce( sbuf, rc*commSize, op, comm );
     MemCopy( rbuf, &sbuf[commRank*rc], rc );
@@ -2340,7 +2941,6 @@ void ReduceScatter( R* sbuf, R* rbuf, int rc, Op op, Comm comm )
     SafeMpi
     ( MPI_Reduce_scatter_block( sbuf, rbuf, rc, TypeMap<R>(), op, comm ) );
 #else
-    const int commSize = CommSize( comm );
     Reduce( sbuf, rc*commSize, op, 0, comm );
     Scatter( sbuf, rc, rbuf, rc, 0, comm );
 #endif
@@ -2348,10 +2948,15 @@ void ReduceScatter( R* sbuf, R* rbuf, int rc, Op op, Comm comm )
 
 template<typename R>
 void ReduceScatter
-( std::complex<R>* sbuf, std::complex<R>* rbuf, int rc, Op op, Comm comm )
+( std::complex<R>* sbuf, std::complex<R>* rbuf, Offset rc, Op op, Comm comm )
 {
-#ifdef REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = CommSize( comm );
+    if( rc*commSize > Offset(MAX_MSG_COUNT/2) )
+    {
+        LargeReduceScatter( sbuf, rbuf, rc, op, comm );
+        return;
+    }
+#ifdef REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commRank = CommRank( comm );
     AllReduce( sbuf, rc*commSize, op, comm );
     MemCopy( rbuf, &sbuf[commRank*rc], rc );
@@ -2365,43 +2970,42 @@ void ReduceScatter
       ( sbuf, rbuf, rc, TypeMap<std::complex<R> >(), op, comm ) );
 # endif
 #else
-    const int commSize = CommSize( comm );
     Reduce( sbuf, rc*commSize, op, 0, comm );
     Scatter( sbuf, rc, rbuf, rc, 0, comm );
 #endif
 }
 
-template void ReduceScatter( byte* sbuf, byte* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( int* sbuf, int* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( unsigned* sbuf, unsigned* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( long int* sbuf, long int* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( unsigned long* sbuf, unsigned long* rbuf, int rc, Op op, Comm comm );
+template void ReduceScatter( byte* sbuf, byte* rbuf, Offset rc, Op op, Comm comm );
+template void ReduceScatter( int* sbuf, int* rbuf, Offset rc, Op op, Comm comm );
+template void ReduceScatter( unsigned* sbuf, unsigned* rbuf, Offset rc, Op op, Comm comm );
+template void ReduceScatter( long int* sbuf, long int* rbuf, Offset rc, Op op, Comm comm );
+template void ReduceScatter( unsigned long* sbuf, unsigned long* rbuf, Offset rc, Op op, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
-template void ReduceScatter( long long int* sbuf, long long int* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( unsigned long long* sbuf, unsigned long long* rbuf, int rc, Op op, Comm comm );
+template void ReduceScatter( long long int* sbuf, long long int* rbuf, Offset rc, Op op, Comm comm );
+template void ReduceScatter( unsigned long long* sbuf, unsigned long long* rbuf, Offset rc, Op op, Comm comm );
 #endif
-template void ReduceScatter( float* sbuf, float* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( double* sbuf, double* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( std::complex<float>* sbuf, std::complex<float>* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( std::complex<double>* sbuf, std::complex<double>* rbuf, int rc, Op op, Comm comm );
+template void ReduceScatter( float* sbuf, float* rbuf, Offset rc, Op op, Comm comm );
+template void ReduceScatter( double* sbuf, double* rbuf, Offset rc, Op op, Comm comm );
+template void ReduceScatter( std::complex<float>* sbuf, std::complex<float>* rbuf, Offset rc, Op op, Comm comm );
+template void ReduceScatter( std::complex<double>* sbuf, std::complex<double>* rbuf, Offset rc, Op op, Comm comm );
 
 template<typename T>
-void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm )
+void ReduceScatter( T* sbuf, T* rbuf, Offset rc, Comm comm )
 { ReduceScatter( sbuf, rbuf, rc, mpi::SUM, comm ); }
 
-template void ReduceScatter( byte* sbuf, byte* rbuf, int rc, Comm comm );
-template void ReduceScatter( int* sbuf, int* rbuf, int rc, Comm comm );
-template void ReduceScatter( unsigned* sbuf, unsigned* rbuf, int rc, Comm comm );
-template void ReduceScatter( long int* sbuf, long int* rbuf, int rc, Comm comm );
-template void ReduceScatter( unsigned long* sbuf, unsigned long* rbuf, int rc, Comm comm );
+template void ReduceScatter( byte* sbuf, byte* rbuf, Offset rc, Comm comm );
+template void ReduceScatter( int* sbuf, int* rbuf, Offset rc, Comm comm );
+template void ReduceScatter( unsigned* sbuf, unsigned* rbuf, Offset rc, Comm comm );
+template void ReduceScatter( long int* sbuf, long int* rbuf, Offset rc, Comm comm );
+template void ReduceScatter( unsigned long* sbuf, unsigned long* rbuf, Offset rc, Comm comm );
 #ifdef HAVE_MPI_LONG_LONG
-template void ReduceScatter( long long int* sbuf, long long int* rbuf, int rc, Comm comm );
-template void ReduceScatter( unsigned long long* sbuf, unsigned long long* rbuf, int rc, Comm comm );
+template void ReduceScatter( long long int* sbuf, long long int* rbuf, Offset rc, Comm comm );
+template void ReduceScatter( unsigned long long* sbuf, unsigned long long* rbuf, Offset rc, Comm comm );
 #endif
-template void ReduceScatter( float* sbuf, float* rbuf, int rc, Comm comm );
-template void ReduceScatter( double* sbuf, double* rbuf, int rc, Comm comm );
-template void ReduceScatter( std::complex<float>* sbuf, std::complex<float>* rbuf, int rc, Comm comm );
-template void ReduceScatter( std::complex<double>* sbuf, std::complex<double>* rbuf, int rc, Comm comm );
+template void ReduceScatter( float* sbuf, float* rbuf, Offset rc, Comm comm );
+template void ReduceScatter( double* sbuf, double* rbuf, Offset rc, Comm comm );
+template void ReduceScatter( std::complex<float>* sbuf, std::complex<float>* rbuf, Offset rc, Comm comm );
+template void ReduceScatter( std::complex<double>* sbuf, std::complex<double>* rbuf, Offset rc, Comm comm );
 
 template<typename T>
 T ReduceScatter( T sb, Op op, Comm comm )
@@ -2442,8 +3046,16 @@ template std::complex<double> ReduceScatter( std::complex<double> sb, Comm comm
 template<typename R>
 void ReduceScatter( R* buf, int rc, Op op, Comm comm )
 {
-#ifdef REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
+    // The fallbacks below reduce all of the blocks in a single call
     const int commSize = CommSize( comm );
+    if( Offset(rc)*commSize > Offset(MAX_MSG_COUNT) )
+    {
+        std::vector<R> recvBuf( rc );
+        LargeReduceScatter( buf, recvBuf.data(), rc, op, comm );
+        MemCopy( buf, recvBuf.data(), rc );
+        return;
+    }
+#ifdef REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commRank = CommRank( comm );
     AllReduce( buf, rc*commSize, op, comm );
     if( commRank != 0 )
@@ -2454,7 +3066,6 @@ void ReduceScatter( R* buf, int rc, Op op, Comm comm )
     ( MPI_Reduce_scatter_block
       ( MPI_IN_PLACE, buf, rc, TypeMap<R>(), op, comm ) );
 # else
-    const int commSize = CommSize( comm );
     std::vector<R> sendBuf( rc*commSize );
     MemCopy( sendBuf.data(), buf, rc*commSize );
     SafeMpi
@@ -2462,7 +3073,6 @@ void ReduceScatter( R* buf, int rc, Op op, Comm comm )
       ( sendBuf.data(), buf, rc, TypeMap<R>(), op, comm ) );
 # endif
 #else
-    const int commSize = CommSize( comm );
     Reduce( buf, rc*commSize, op, 0, comm );
     Scatter( buf, rc, rc, 0, comm );
 #endif
@@ -2472,8 +3082,16 @@ void ReduceScatter( R* buf, int rc, Op op, Comm comm )
 template<typename R>
 void ReduceScatter( std::complex<R>* buf, int rc, Op op, Comm comm )
 {
-#ifdef REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
+    // The fallbacks below reduce all of the blocks in a single call
     const int commSize = CommSize( comm );
+    if( Offset(rc)*commSize > Offset(MAX_MSG_COUNT/2) )
+    {
+        std::vector<std::complex<R> > recvBuf( rc );
+        LargeReduceScatter( buf, recvBuf.data(), rc, op, comm );
+        MemCopy( buf, recvBuf.data(), rc );
+        return;
+    }
+#ifdef REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commRank = CommRank( comm );
     AllReduce( buf, rc*commSize, op, comm );
     if( commRank != 0 )
@@ -2485,7 +3103,6 @@ void ReduceScatter( std::complex<R>* buf, int rc, Op op, Comm comm )
     ( MPI_Reduce_scatter_block
       ( MPI_IN_PLACE, buf, 2*rc, TypeMap<R>(), op, comm ) );
 #  else
-    const int commSize = CommSize( comm );
     std::vector<std::complex<R> > sendBuf( rc*commSize );
     MemCopy( sendBuf.data(), buf, rc*commSize );
     SafeMpi
@@ -2498,7 +3115,6 @@ void ReduceScatter( std::complex<R>* buf, int rc, Op op, Comm comm )
     ( MPI_Reduce_scatter_block
       ( MPI_IN_PLACE, buf, rc, TypeMap<std::complex<R> >(), op, comm ) );
 #  else
-    const int commSize = CommSize( comm );
     std::vector<std::complex<R> > sendBuf( rc*commSize );
     MemCopy( sendBuf.data(), buf, rc*commSize );
     SafeMpi
@@ -2507,7 +3123,6 @@ void ReduceScatter( std::complex<R>* buf, int rc, Op op, Comm comm )
 #  endif
 # endif
 #else
-    const int commSize = CommSize( comm );
     Reduce( buf, rc*commSize, op, 0, comm );
     Scatter( buf, rc, rc, 0, comm );
 #endif
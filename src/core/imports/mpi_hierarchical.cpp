@@ -0,0 +1,357 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "rote.hpp"
+
+namespace rote {
+namespace mpi {
+
+namespace {
+
+// As in mpi.cpp
+inline void
+SafeMpi( int mpiError )
+{
+#ifndef RELEASE
+    if( mpiError != MPI_SUCCESS )
+    {
+        char errorString[200];
+        int lengthOfErrorString;
+        MPI_Error_string( mpiError, errorString, &lengthOfErrorString );
+        RuntimeError( std::string(errorString) );
+    }
+#endif
+}
+
+struct Range
+{
+    std::size_t minBytes;
+    std::size_t maxBytes;
+    bool enabled;
+};
+
+const char* const envNames[NUM_COLLECTIVES] =
+{
+    "ROTE_HIERARCHICAL_ALLGATHER",
+    "ROTE_HIERARCHICAL_ALLTOALL",
+    "ROTE_HIERARCHICAL_REDUCESCATTER",
+    "ROTE_HIERARCHICAL_ALLREDUCE"
+};
+
+struct Ranges
+{
+    Range ranges[NUM_COLLECTIVES];
+
+    Ranges()
+    {
+        for( int c=0; c<NUM_COLLECTIVES; ++c )
+        {
+            Range& range = ranges[c];
+            range.minBytes = 0;
+            range.maxBytes = std::numeric_limits<std::size_t>::max();
+            range.enabled = false;
+            const char* value = std::getenv( envNames[c] );
+            if( value == 0 || *value == '\0' )
+                continue;
+            char* end;
+            range.minBytes = std::strtoull( value, &end, 10 );
+            if( *end == ':' )
+                range.maxBytes = std::strtoull( end+1, &end, 10 );
+            if( *end != '\0' )
+                RuntimeError
+                (std::string("Expected bytes as minimum[:maximum] in ") +
+                 envNames[c]);
+            range.enabled = true;
+        }
+    }
+};
+
+Ranges& GetRanges()
+{
+    static Ranges ranges;
+    return ranges;
+}
+
+// Processes per node imposed by SetHierarchicalNodeSize; 0 if none
+int& ImposedNodeSize()
+{
+    static int nodeSize = 0;
+    return nodeSize;
+}
+
+// Whether the imposed nodes take every numNodes-th process
+bool& ImposedInterleaved()
+{
+    static bool interleaved = false;
+    return interleaved;
+}
+
+// How the processes of a communicator sit on the nodes, cached on the
+// communicator as an attribute
+struct NodeLayout
+{
+    // The processes of comm on our node, ranked as in comm
+    Comm nodeComm;
+    // The first process of every node, ranked by node; COMM_NULL elsewhere
+    Comm leaderComm;
+    int numNodes;
+    // Processes per node, or 0 if the nodes hold different numbers
+    int nodeSize;
+    // Rank in comm of the l-th process of node n, at n*nodeSize+l
+    std::vector<int> ranks;
+};
+
+int FreeNodeLayout( MPI_Comm comm, int keyval, void* attr, void* extra )
+{
+    NOT_USED(comm); NOT_USED(keyval); NOT_USED(extra);
+    NodeLayout* layout = static_cast<NodeLayout*>(attr);
+    // Called from within MPI, so report failures rather than throw
+    int error = MPI_Comm_free( &layout->nodeComm );
+    if( layout->leaderComm != MPI_COMM_NULL && error == MPI_SUCCESS )
+        error = MPI_Comm_free( &layout->leaderComm );
+    delete layout;
+    return error;
+}
+
+const NodeLayout* GetNodeLayout( Comm comm )
+{
+    static int keyval = MPI_KEYVAL_INVALID;
+    if( keyval == MPI_KEYVAL_INVALID )
+        SafeMpi
+        ( MPI_Comm_create_keyval
+          ( MPI_COMM_NULL_COPY_FN, FreeNodeLayout, &keyval, 0 ) );
+    void* attr;
+    int found;
+    SafeMpi( MPI_Comm_get_attr( comm, keyval, &attr, &found ) );
+    if( found )
+        return static_cast<NodeLayout*>(attr);
+
+    NodeLayout* layout = new NodeLayout;
+    const int commRank = CommRank( comm );
+    const int commSize = CommSize( comm );
+    const int imposedNodeSize = ImposedNodeSize();
+    if( imposedNodeSize > 0 && ImposedInterleaved() )
+    {
+        const int numImposed = (commSize+imposedNodeSize-1) / imposedNodeSize;
+        CommSplit( comm, commRank % numImposed, commRank, layout->nodeComm );
+    }
+    else if( imposedNodeSize > 0 )
+        CommSplit
+        ( comm, commRank / imposedNodeSize, commRank, layout->nodeComm );
+    else
+        CommSplitShared( comm, commRank, layout->nodeComm );
+    const int nodeRank = CommRank( layout->nodeComm );
+    const int nodeSize = CommSize( layout->nodeComm );
+    CommSplit
+    ( comm, nodeRank == 0 ? 0 : UNDEFINED, commRank, layout->leaderComm );
+    int node = nodeRank == 0 ? CommRank( layout->leaderComm ) : 0;
+    Broadcast( node, 0, layout->nodeComm );
+
+    const int minNodeSize = AllReduce( nodeSize, MIN, comm );
+    const int maxNodeSize = AllReduce( nodeSize, MAX, comm );
+    layout->nodeSize = minNodeSize == maxNodeSize ? nodeSize : 0;
+    layout->numNodes = commSize / maxNodeSize;
+    if( layout->nodeSize != 0 )
+    {
+        const int position = node*nodeSize + nodeRank;
+        std::vector<int> positions( commSize );
+        AllGather( &position, 1, &(positions[0]), 1, comm );
+        layout->ranks.resize( commSize );
+        for( int r=0; r<commSize; ++r )
+            layout->ranks[positions[r]] = r;
+    }
+    SafeMpi( MPI_Comm_set_attr( comm, keyval, layout ) );
+    return layout;
+}
+
+// The layout to run a two-level collective with, or 0 for the flat one
+const NodeLayout* Hierarchy( Collective coll, std::size_t bytes, Comm comm )
+{
+#ifdef HAVE_MPI3_SHARED_MEMORY
+    const Range& range = GetRanges().ranges[coll];
+    if( !range.enabled || bytes < range.minBytes || bytes > range.maxBytes )
+        return 0;
+    if( CommSize( comm ) <= 2 )
+        return 0;
+    const NodeLayout* layout = GetNodeLayout( comm );
+    if( layout->nodeSize < 2 || layout->numNodes < 2 )
+        return 0;
+    return layout;
+#else
+    NOT_USED(coll); NOT_USED(bytes); NOT_USED(comm);
+    return 0;
+#endif
+}
+
+} // anonymous namespace
+
+void SetHierarchical
+( Collective coll, std::size_t minBytes, std::size_t maxBytes )
+{
+    Range& range = GetRanges().ranges[coll];
+    range.minBytes = minBytes;
+    range.maxBytes = maxBytes;
+    range.enabled = true;
+}
+
+void UnsetHierarchical( Collective coll )
+{ GetRanges().ranges[coll].enabled = false; }
+
+void SetHierarchicalNodeSize( int nodeSize, bool interleaved )
+{
+    ImposedNodeSize() = nodeSize;
+    ImposedInterleaved() = interleaved;
+}
+
+bool Hierarchical( Collective coll, std::size_t bytes, Comm comm )
+{ return Hierarchy( coll, bytes, comm ) != 0; }
+
+template<typename T>
+void HierarchicalAllGather
+( const T* sbuf, Offset sc, T* rbuf, Offset rc, Comm comm )
+{
+    const NodeLayout* layout = Hierarchy( ALLGATHER, sc*sizeof(T), comm );
+    if( layout == 0 )
+    {
+        AllGather( sbuf, sc, rbuf, rc, comm );
+        return;
+    }
+    const int commSize = layout->ranks.size();
+    const bool leader = layout->leaderComm != COMM_NULL;
+    const Offset nodeCount = layout->nodeSize*sc;
+
+    Memory<T> nodeMem( COMM_MEMORY ), gatheredMem( COMM_MEMORY );
+    T* nodeBuf = leader ? nodeMem.Require( nodeCount ) : 0;
+    T* gathered =
+        leader ? gatheredMem.Require( nodeCount*layout->numNodes ) : 0;
+    Gather( sbuf, sc, nodeBuf, sc, 0, layout->nodeComm );
+    if( leader )
+    {
+        AllGather
+        ( nodeBuf, nodeCount, gathered, nodeCount, layout->leaderComm );
+        for( int k=0; k<commSize; ++k )
+            MemCopy( &rbuf[layout->ranks[k]*sc], &gathered[k*sc], sc );
+    }
+    Broadcast( rbuf, commSize*sc, 0, layout->nodeComm );
+}
+
+template<typename T>
+void HierarchicalAllToAll
+( const T* sbuf, Offset sc, T* rbuf, Offset rc, Comm comm )
+{
+    const int commSize = CommSize( comm );
+    const NodeLayout* layout =
+        Hierarchy( ALLTOALL, commSize*sc*sizeof(T), comm );
+    if( layout == 0 )
+    {
+        AllToAll( sbuf, sc, rbuf, rc, comm );
+        return;
+    }
+    const int nodeSize = layout->nodeSize;
+    const int numNodes = layout->numNodes;
+    const bool leader = layout->leaderComm != COMM_NULL;
+    const Offset commCount = commSize*sc;
+
+    // Blocks of the node gathered as [source][destination rank], exchanged
+    // as [destination node][destination][source] and handed out as
+    // [destination][source rank]
+    // Staged as communication memory, and only on the leaders
+    Memory<T> stagingMem( COMM_MEMORY );
+    T* gathered = leader ? stagingMem.Require( 3*nodeSize*commCount ) : 0;
+    T* sendBuf = leader ? gathered + nodeSize*commCount : 0;
+    T* recvBuf = leader ? sendBuf + nodeSize*commCount : 0;
+    Gather( sbuf, commCount, gathered, commCount, 0, layout->nodeComm );
+    if( leader )
+    {
+        for( int m=0; m<numNodes; ++m )
+            for( int j=0; j<nodeSize; ++j )
+                for( int l=0; l<nodeSize; ++l )
+                    MemCopy
+                    ( &sendBuf[((m*nodeSize+j)*nodeSize+l)*sc],
+                      &gathered[(l*commSize+layout->ranks[m*nodeSize+j])*sc],
+                      sc );
+        const Offset pairCount = nodeSize*nodeSize*sc;
+        AllToAll
+        ( sendBuf, pairCount, recvBuf, pairCount, layout->leaderComm );
+        for( int n=0; n<numNodes; ++n )
+            for( int j=0; j<nodeSize; ++j )
+                for( int l=0; l<nodeSize; ++l )
+                    MemCopy
+                    ( &gathered[(j*commSize+layout->ranks[n*nodeSize+l])*sc],
+                      &recvBuf[((n*nodeSize+j)*nodeSize+l)*sc], sc );
+    }
+    Scatter( gathered, commCount, rbuf, commCount, 0, layout->nodeComm );
+}
+
+template<typename T>
+void HierarchicalReduceScatter( T* sbuf, T* rbuf, Offset rc, Comm comm )
+{
+    const int commSize = CommSize( comm );
+    const NodeLayout* layout =
+        Hierarchy( REDUCESCATTER, commSize*rc*sizeof(T), comm );
+    if( layout == 0 )
+    {
+        ReduceScatter( sbuf, rbuf, rc, comm );
+        return;
+    }
+    const bool leader = layout->leaderComm != COMM_NULL;
+    const Offset nodeCount = layout->nodeSize*rc;
+
+    // Staged as communication memory, and only on the leaders
+    Memory<T> stagingMem( COMM_MEMORY );
+    T* nodeSum = leader ? stagingMem.Require( 2*commSize*rc + nodeCount ) : 0;
+    T* ordered = leader ? nodeSum + commSize*rc : 0;
+    T* nodePart = leader ? ordered + commSize*rc : 0;
+    Reduce( sbuf, nodeSum, commSize*rc, SUM, 0, layout->nodeComm );
+    if( leader )
+    {
+        // Node by node, so each leader ends up with its node's blocks
+        for( int k=0; k<commSize; ++k )
+            MemCopy( &ordered[k*rc], &nodeSum[layout->ranks[k]*rc], rc );
+        ReduceScatter( ordered, nodePart, nodeCount, SUM, layout->leaderComm );
+    }
+    Scatter( nodePart, rc, rbuf, rc, 0, layout->nodeComm );
+}
+
+template<typename T>
+void HierarchicalAllReduce( const T* sbuf, T* rbuf, Offset count, Comm comm )
+{
+    const NodeLayout* layout = Hierarchy( ALLREDUCE, count*sizeof(T), comm );
+    if( layout == 0 )
+    {
+        AllReduce( sbuf, rbuf, count, comm );
+        return;
+    }
+    const bool leader = layout->leaderComm != COMM_NULL;
+
+    Memory<T> nodeMem( COMM_MEMORY );
+    T* nodeSum = leader ? nodeMem.Require( count ) : 0;
+    Reduce( sbuf, nodeSum, count, SUM, 0, layout->nodeComm );
+    if( leader )
+        AllReduce( nodeSum, rbuf, count, layout->leaderComm );
+    Broadcast( rbuf, count, 0, layout->nodeComm );
+}
+
+#define PROTO(T) \
+    template void HierarchicalAllGather \
+    ( const T* sbuf, Offset sc, T* rbuf, Offset rc, Comm comm ); \
+    template void HierarchicalAllToAll \
+    ( const T* sbuf, Offset sc, T* rbuf, Offset rc, Comm comm ); \
+    template void HierarchicalReduceScatter \
+    ( T* sbuf, T* rbuf, Offset rc, Comm comm ); \
+    template void HierarchicalAllReduce \
+    ( const T* sbuf, T* rbuf, Offset count, Comm comm );
+
+PROTO(int)
+PROTO(float)
+PROTO(double)
+PROTO(std::complex<float>)
+PROTO(std::complex<double>)
+
+} // namespace mpi
+} // namespace rote
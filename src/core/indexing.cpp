@@ -80,6 +80,37 @@ MaxLength( Unsigned n, Unsigned wrap ) {
     return ( n > 0 ? (n - 1)/wrap + 1 : 0 );
 };
 
+Unsigned
+BlockLength( Unsigned n, Unsigned shift, Unsigned wrap, Unsigned blockSize )
+{
+    if( blockSize == 1 )
+        return Length( n, shift, wrap );
+    const Unsigned nBlocks = MaxLength( n, blockSize );
+    Unsigned length = Length( nBlocks, shift, wrap ) * blockSize;
+    // The last block may be cut short
+    if( nBlocks > 0 && (nBlocks - 1) % wrap == shift )
+        length -= nBlocks * blockSize - n;
+    return length;
+};
+
+Unsigned
+MaxBlockLength( Unsigned n, Unsigned wrap, Unsigned blockSize )
+{
+    return Min( MaxLength( MaxLength( n, blockSize ), wrap ) * blockSize, n );
+};
+
+Unsigned
+BlockOwner( Unsigned index, Unsigned alignment, Unsigned wrap, Unsigned blockSize )
+{ return (index / blockSize + alignment) % wrap; };
+
+Unsigned
+BlockGlobal2Local( Unsigned index, Unsigned wrap, Unsigned blockSize )
+{ return (index / blockSize / wrap) * blockSize + index % blockSize; };
+
+Unsigned
+BlockLocal2Global( Unsigned index, Unsigned shift, Unsigned wrap, Unsigned blockSize )
+{ return ((index / blockSize) * wrap + shift) * blockSize + index % blockSize; };
+
 //
 // Vector
 //
@@ -135,6 +166,34 @@ MaxLengths(const ObjShape& objShape, const ObjShape& wrapShape)
   return ret;
 };
 
+std::vector<Unsigned>
+BlockLengths(const ObjShape& objShape, const std::vector<Unsigned>& shifts, const ObjShape& wrapShape, const std::vector<Unsigned>& blockSizes)
+{
+#ifndef RELEASE
+    if(blockSizes.size() != objShape.size())
+        LogicError("dimensions and block sizes must contain same number of elements.");
+#endif
+  std::vector<Unsigned> lengths = Lengths(objShape, shifts, wrapShape);
+  for(Unsigned i = 0; i < objShape.size(); i++)
+    if(blockSizes[i] != 1)
+      lengths[i] = BlockLength(objShape[i], shifts[i], wrapShape[i], blockSizes[i]);
+  return lengths;
+};
+
+std::vector<Unsigned>
+MaxBlockLengths(const ObjShape& objShape, const ObjShape& wrapShape, const std::vector<Unsigned>& blockSizes)
+{
+#ifndef RELEASE
+    if(blockSizes.size() != objShape.size())
+        LogicError("objShape order and number of block sizes must be the same");
+#endif
+  std::vector<Unsigned> ret = MaxLengths(objShape, wrapShape);
+  for(Unsigned i = 0; i < ret.size(); i++)
+      if(blockSizes[i] != 1)
+          ret[i] = MaxBlockLength(objShape[i], wrapShape[i], blockSizes[i]);
+  return ret;
+};
+
 std::vector<Unsigned>
 Shifts( const std::vector<Unsigned>& modeRanks, const std::vector<Unsigned> alignments, const std::vector<Unsigned>& wrapShape)
 {
@@ -197,21 +256,21 @@ IntCeils(const std::vector<Unsigned>& ms, const std::vector<Unsigned>& ns)
 };
 
 // Other
-std::vector<Unsigned>
+std::vector<Offset>
 Dimensions2Strides(const ObjShape& objShape)
 {
-  std::vector<Unsigned> strides(objShape.size());
+  std::vector<Offset> strides(objShape.size());
   if(strides.size() > 0){
 	  strides[0] = 1;
 	  for(Unsigned i = 1; i < strides.size(); i++){
 	      //NOTE: strides set to Max(1,c) to ensure we don't end up with 0 value stride
-		  strides[i] = Max(1, strides[i-1]*objShape[i-1]);
+		  strides[i] = std::max<Offset>(1, strides[i-1]*objShape[i-1]);
 	  }
   }
   return strides;
 };
 
-Unsigned
+Offset
 Loc2LinearLoc(const Location& loc, const ObjShape& shape)
 {
   if(shape.size() != loc.size()){
@@ -219,25 +278,25 @@ Loc2LinearLoc(const Location& loc, const ObjShape& shape)
   }
 
   Unsigned i;
-  Unsigned linearInd = 0;
+  Offset linearInd = 0;
   if(loc.size() > 0){
-        const std::vector<Unsigned> shapeStrides = Dimensions2Strides(shape);
+        const std::vector<Offset> shapeStrides = Dimensions2Strides(shape);
         linearInd += loc[0];
         for(i = 1; i < loc.size(); i++)
-            linearInd += loc[i] * shape[i-1] * shapeStrides[i-1];
+            linearInd += loc[i] * shapeStrides[i-1] * shape[i-1];
   }
 
   return linearInd;
 };
 
 Location
-LinearLoc2Loc(Unsigned linearLoc, const ObjShape& objShape)
+LinearLoc2Loc(Offset linearLoc, const ObjShape& objShape)
 {
     if(objShape.size() == 0 && linearLoc != 0)
         LogicError("Combination of linearLoc=0 and strides incompatible");
     const Unsigned order = objShape.size();
-    Unsigned remainder = linearLoc;
-    const std::vector<Unsigned> strides = Dimensions2Strides(objShape);
+    Offset remainder = linearLoc;
+    const std::vector<Offset> strides = Dimensions2Strides(objShape);
 
     Location ret(order);
     for(Unsigned i = order - 1; i < order; i--){
@@ -248,14 +307,14 @@ LinearLoc2Loc(Unsigned linearLoc, const ObjShape& objShape)
     return ret;
 };
 
-Unsigned
-LinearLocFromStrides(const Location& loc, const std::vector<Unsigned>& strides)
+Offset
+LinearLocFromStrides(const Location& loc, const std::vector<Offset>& strides)
 {
     if(strides.size() != 0 && (loc.size() != strides.size())){
         LogicError( "Invalid index+stride combination");
     }
     Unsigned i;
-    Unsigned linearInd = 0;
+    Offset linearInd = 0;
     for(i = 0; i < loc.size(); i++)
         linearInd += loc[i] * strides[i];
 
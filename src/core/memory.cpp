@@ -12,25 +12,90 @@ namespace rote {
 
   template<typename G>
   Memory<G>::Memory()
-  : size_(0), buffer_(0)
+  : size_(0), bytes_(0), buffer_(0), customPolicy_(false),
+    category_(CurrentMemoryCategory()),
+    workspace_(CurrentWorkspaceArena()),
+    workspaceMark_(workspace_ != 0 ? workspace_->CurrentMark() : 0),
+    fromWorkspace_(false), fromFile_(false), sharedComm_(mpi::COMM_NULL),
+    window_(mpi::WINDOW_NULL), windowLeader_(false)
   { Require( 1 ); }
 
   template<typename G>
   Memory<G>::Memory( std::size_t size )
-  : size_(0), buffer_(0)
+  : size_(0), bytes_(0), buffer_(0), customPolicy_(false),
+    category_(CurrentMemoryCategory()),
+    workspace_(CurrentWorkspaceArena()),
+    workspaceMark_(workspace_ != 0 ? workspace_->CurrentMark() : 0),
+    fromWorkspace_(false), fromFile_(false), sharedComm_(mpi::COMM_NULL),
+    window_(mpi::WINDOW_NULL), windowLeader_(false)
   { Require( size ); }
 
+  template<typename G>
+  Memory<G>::Memory( MemoryCategory category )
+  : size_(0), bytes_(0), buffer_(0), customPolicy_(false),
+    category_(category), workspace_(CurrentWorkspaceArena()),
+    workspaceMark_(workspace_ != 0 ? workspace_->CurrentMark() : 0),
+    fromWorkspace_(false), fromFile_(false), sharedComm_(mpi::COMM_NULL),
+    window_(mpi::WINDOW_NULL), windowLeader_(false)
+  { Require( 1 ); }
+
+  template<typename G>
+  Memory<G>::Memory( Memory<G>&& mem )
+  : size_(mem.size_), bytes_(mem.bytes_), buffer_(mem.buffer_),
+    customPolicy_(mem.customPolicy_), policy_(mem.policy_),
+    bufferPolicy_(mem.bufferPolicy_), category_(mem.category_),
+    workspace_(std::move(mem.workspace_)), workspaceMark_(mem.workspaceMark_),
+    fromWorkspace_(mem.fromWorkspace_), scratchDir_(mem.scratchDir_),
+    fromFile_(mem.fromFile_), sharedComm_(mem.sharedComm_),
+    window_(mem.window_), windowLeader_(mem.windowLeader_)
+  {
+      mem.size_ = 0;
+      mem.bytes_ = 0;
+      mem.buffer_ = 0;
+      mem.fromWorkspace_ = false;
+      mem.scratchDir_.clear();
+      mem.fromFile_ = false;
+      mem.sharedComm_ = mpi::COMM_NULL;
+      mem.window_ = mpi::WINDOW_NULL;
+      mem.windowLeader_ = false;
+  }
+
+  template<typename G>
+  Memory<G>&
+  Memory<G>::operator=( Memory<G>&& mem )
+  {
+      if( &mem != this )
+      {
+          Empty();
+          Swap( mem );
+      }
+      return *this;
+  }
+
   template<typename G>
   void
   Memory<G>::Swap( Memory<G>& mem )
   {
       std::swap(size_,mem.size_);
+      std::swap(bytes_,mem.bytes_);
       std::swap(buffer_,mem.buffer_);
+      std::swap(customPolicy_,mem.customPolicy_);
+      std::swap(policy_,mem.policy_);
+      std::swap(bufferPolicy_,mem.bufferPolicy_);
+      std::swap(category_,mem.category_);
+      std::swap(workspace_,mem.workspace_);
+      std::swap(workspaceMark_,mem.workspaceMark_);
+      std::swap(fromWorkspace_,mem.fromWorkspace_);
+      std::swap(scratchDir_,mem.scratchDir_);
+      std::swap(fromFile_,mem.fromFile_);
+      std::swap(sharedComm_,mem.sharedComm_);
+      std::swap(window_,mem.window_);
+      std::swap(windowLeader_,mem.windowLeader_);
   }
 
   template<typename G>
   Memory<G>::~Memory()
-  { delete[] buffer_; }
+  { Empty(); }
 
   template<typename G>
   G*
@@ -42,17 +107,253 @@ namespace rote {
   Memory<G>::Size() const
   { return size_; }
 
+  template<typename G>
+  void
+  Memory<G>::SetPolicy( const AllocationPolicy& policy )
+  {
+      AssertValidAllocationPolicy( policy );
+      policy_ = policy;
+      customPolicy_ = true;
+      Rebind( policy );
+  }
+
+  template<typename G>
+  void
+  Memory<G>::UseDefaultPolicy()
+  {
+      customPolicy_ = false;
+      Rebind( DefaultAllocationPolicy() );
+  }
+
+  template<typename G>
+  void
+  Memory<G>::Allocate( std::size_t bytes, const AllocationPolicy& policy )
+  {
+      fromWorkspace_ = false;
+      fromFile_ = false;
+      window_ = mpi::WINDOW_NULL;
+      windowLeader_ = false;
+      if( sharedComm_ != mpi::COMM_NULL )
+      {
+          // The leader's segment holds the entries, the rest are empty
+          windowLeader_ = mpi::CommRank( sharedComm_ ) == 0;
+          buffer_ = static_cast<G*>(mpi::WindowAllocateShared
+                    ( windowLeader_ ? bytes : 0, sharedComm_, window_ ));
+          bytes_ = bytes;
+          size_ = bytes / sizeof(G);
+          bufferPolicy_ = policy;
+          if( windowLeader_ )
+              TrackAllocation( category_, bytes_ );
+          return;
+      }
+      if( !scratchDir_.empty() )
+      {
+          buffer_ = static_cast<G*>(MapScratchFile( scratchDir_, bytes ));
+          bytes_ = bytes;
+          size_ = bytes / sizeof(G);
+          bufferPolicy_ = policy;
+          fromFile_ = true;
+          return;
+      }
+      if( workspace_ != 0 && workspaceMark_ != 0 &&
+          workspace_->CurrentMark() == workspaceMark_ )
+      {
+          void* ptr = workspace_->Allocate( bytes, policy.alignment );
+          if( ptr != 0 )
+          {
+              // Counted by the accounting as part of the workspace
+              buffer_ = static_cast<G*>(ptr);
+              bytes_ = bytes;
+              size_ = bytes / sizeof(G);
+              bufferPolicy_ = policy;
+              fromWorkspace_ = true;
+              return;
+          }
+      }
+      buffer_ = static_cast<G*>(PoolAllocate( bytes, policy ));
+      // The size class may hold more entries than requested
+      bytes_ = bytes;
+      size_ = bytes / sizeof(G);
+      bufferPolicy_ = policy;
+      TrackAllocation( category_, bytes_ );
+  }
+
+  template<typename G>
+  void
+  Memory<G>::FreeBlock
+  ( G* buffer, std::size_t bytes, const AllocationPolicy& policy,
+    bool fromWorkspace, bool fromFile, mpi::Window& window,
+    bool windowLeader )
+  {
+      if( window != mpi::WINDOW_NULL )
+      {
+          if( windowLeader )
+              TrackDeallocation( category_, bytes );
+          mpi::WindowFreeShared( window );
+      }
+      else if( fromWorkspace )
+          workspace_->Deallocate( buffer, bytes, workspaceMark_ );
+      else if( fromFile )
+          UnmapScratchFile( buffer, bytes );
+      else
+      {
+          TrackDeallocation( category_, bytes );
+          PoolDeallocate( buffer, bytes, policy );
+      }
+  }
+
+  template<typename G>
+  void
+  Memory<G>::Deallocate()
+  {
+      FreeBlock
+      ( buffer_, bytes_, bufferPolicy_, fromWorkspace_, fromFile_,
+        window_, windowLeader_ );
+      size_ = 0;
+      bytes_ = 0;
+      buffer_ = 0;
+      fromWorkspace_ = false;
+      fromFile_ = false;
+      window_ = mpi::WINDOW_NULL;
+      windowLeader_ = false;
+  }
+
+  template<typename G>
+  void
+  Memory<G>::Rebind( const AllocationPolicy& policy )
+  {
+      // Scratch files and shared windows do not follow the allocation policy
+      if( buffer_ == 0 || fromFile_ || window_ != mpi::WINDOW_NULL ||
+          bufferPolicy_ == policy )
+          return;
+      Reallocate();
+  }
+
+  // Move the held entries to a block following the current settings
+  template<typename G>
+  void
+  Memory<G>::Reallocate()
+  {
+      if( buffer_ == 0 )
+          return;
+      G* oldBuffer = buffer_;
+      const std::size_t oldBytes = bytes_;
+      const AllocationPolicy oldPolicy = bufferPolicy_;
+      const bool oldFromWorkspace = fromWorkspace_;
+      const bool oldFromFile = fromFile_;
+      mpi::Window oldWindow = window_;
+      const bool oldWindowLeader = windowLeader_;
+      Allocate( oldBytes, Policy() );
+      // A shared block is written once per node
+      if( window_ == mpi::WINDOW_NULL || windowLeader_ )
+          std::memcpy( buffer_, oldBuffer, oldBytes );
+      if( window_ != mpi::WINDOW_NULL )
+          mpi::WindowSync( window_, sharedComm_ );
+      FreeBlock
+      ( oldBuffer, oldBytes, oldPolicy, oldFromWorkspace, oldFromFile,
+        oldWindow, oldWindowLeader );
+  }
+
+  template<typename G>
+  void
+  Memory<G>::SetOutOfCore( const std::string& dir )
+  {
+      const std::string scratchDir = dir.empty() ? ScratchDirectory() : dir;
+      if( scratchDir == scratchDir_ )
+          return;
+      scratchDir_ = scratchDir;
+      Reallocate();
+  }
+
+  template<typename G>
+  void
+  Memory<G>::SetInCore()
+  {
+      if( scratchDir_.empty() )
+          return;
+      scratchDir_.clear();
+      Reallocate();
+  }
+
+  template<typename G>
+  bool
+  Memory<G>::OutOfCore() const
+  { return !scratchDir_.empty(); }
+
+  template<typename G>
+  void
+  Memory<G>::SetNodeShared( mpi::Comm comm )
+  {
+      if( comm == sharedComm_ )
+          return;
+      // Windows over different communicators are not allocated together
+      if( sharedComm_ != mpi::COMM_NULL && comm != mpi::COMM_NULL )
+          SetNodeShared( mpi::COMM_NULL );
+      sharedComm_ = comm;
+      Reallocate();
+  }
+
+  template<typename G>
+  bool
+  Memory<G>::NodeShared() const
+  { return sharedComm_ != mpi::COMM_NULL; }
+
+  template<typename G>
+  mpi::Comm
+  Memory<G>::NodeComm() const
+  { return sharedComm_; }
+
+  template<typename G>
+  bool
+  Memory<G>::NodeLeader() const
+  { return sharedComm_ == mpi::COMM_NULL || mpi::CommRank( sharedComm_ ) == 0; }
+
+  template<typename G>
+  void
+  Memory<G>::NodeSync() const
+  {
+      if( window_ != mpi::WINDOW_NULL )
+          mpi::WindowSync( window_, sharedComm_ );
+  }
+
+  template<typename G>
+  AllocationPolicy
+  Memory<G>::Policy() const
+  { return customPolicy_ ? policy_ : DefaultAllocationPolicy(); }
+
+  template<typename G>
+  void
+  Memory<G>::SetCategory( MemoryCategory category )
+  {
+      if( fromWorkspace_ || fromFile_ ||
+          (window_ != mpi::WINDOW_NULL && !windowLeader_) )
+      {
+          category_ = category;
+          return;
+      }
+      TrackDeallocation( category_, bytes_ );
+      category_ = category;
+      TrackAllocation( category_, bytes_ );
+  }
+
+  template<typename G>
+  MemoryCategory
+  Memory<G>::Category() const
+  { return category_; }
+
   template<typename G>
   G*
   Memory<G>::Require( std::size_t size )
   {
       if( size > size_ )
       {
-          delete[] buffer_;
+          Empty();
+          const std::size_t bytes = size*sizeof(G);
+          const AllocationPolicy policy = Policy();
   #ifndef RELEASE
           try {
   #endif
-          buffer_ = new G[size];
+          Allocate( bytes, policy );
   #ifndef RELEASE
           }
           catch( std::bad_alloc& e )
@@ -64,7 +365,6 @@ namespace rote {
               throw e;
           }
   #endif
-          size_ = size;
       }
       return buffer_;
   }
@@ -81,11 +381,7 @@ namespace rote {
   template<typename G>
   void
   Memory<G>::Empty()
-  {
-      delete[] buffer_;
-      size_ = 0;
-      buffer_ = 0;
-  }
+  { Deallocate(); }
 
   #define FULL(G) \
       template class Memory<G>;
@@ -0,0 +1,288 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "rote.hpp"
+
+namespace {
+
+struct Accounting
+{
+    std::mutex mutex;
+    rote::MemoryUsage categories[rote::MemoryCategory_MAX];
+    rote::MemoryUsage total;
+    std::size_t budget;
+    std::size_t overruns;
+
+    // Statistics per section name, and the currently active ones
+    std::map<std::string, rote::MemorySectionUsage> sections;
+    std::vector<rote::MemorySectionUsage*> activeSections;
+
+    Accounting()
+    : budget(0), overruns(0)
+    {
+        std::memset( categories, 0, sizeof(categories) );
+        std::memset( &total, 0, sizeof(total) );
+    }
+};
+
+Accounting& GetAccounting()
+{
+    static Accounting accounting;
+    return accounting;
+}
+
+thread_local rote::MemoryCategory currentCategory = rote::TENSOR_MEMORY;
+
+void Add( rote::MemoryUsage& usage, std::size_t bytes )
+{
+    usage.bytesInUse += bytes;
+    usage.peakBytesInUse = std::max( usage.peakBytesInUse, usage.bytesInUse );
+    ++usage.numAllocations;
+}
+
+void PrintUsageLine
+( std::ostream& os, const std::string& name, const rote::MemoryUsage& usage )
+{
+    os << "  " << std::left << std::setw(10) << name << std::right
+       << " in use " << std::setw(14) << usage.bytesInUse
+       << "  peak " << std::setw(14) << usage.peakBytesInUse
+       << "  allocations " << usage.numAllocations << "\n";
+}
+
+} // anonymous namespace
+
+namespace rote {
+
+std::string MemoryCategoryName( MemoryCategory category )
+{
+    switch( category )
+    {
+    case TENSOR_MEMORY:   return "tensor";
+    case COMM_MEMORY:     return "comm";
+    case CONTRACT_MEMORY: return "contract";
+    case IO_MEMORY:       return "io";
+    default:              return "unknown";
+    }
+}
+
+MemoryCategoryScope::MemoryCategoryScope( MemoryCategory category )
+: previous_(currentCategory)
+{ currentCategory = category; }
+
+MemoryCategoryScope::~MemoryCategoryScope()
+{ currentCategory = previous_; }
+
+MemoryCategory CurrentMemoryCategory()
+{ return currentCategory; }
+
+void TrackAllocation( MemoryCategory category, std::size_t bytes )
+{
+    if( bytes == 0 )
+        return;
+    Accounting& acct = GetAccounting();
+    std::lock_guard<std::mutex> lock( acct.mutex );
+    const bool withinBudget =
+        acct.budget == 0 || acct.total.bytesInUse <= acct.budget;
+    Add( acct.categories[category], bytes );
+    Add( acct.total, bytes );
+    if( withinBudget && acct.budget != 0 &&
+        acct.total.bytesInUse > acct.budget )
+        ++acct.overruns;
+    for( std::size_t i=0; i<acct.activeSections.size(); ++i )
+    {
+        MemorySectionUsage& section = *acct.activeSections[i];
+        section.bytesAllocated += bytes;
+        section.peakBytesInUse =
+            std::max( section.peakBytesInUse, acct.total.bytesInUse );
+    }
+}
+
+void TrackDeallocation( MemoryCategory category, std::size_t bytes )
+{
+    if( bytes == 0 )
+        return;
+    Accounting& acct = GetAccounting();
+    std::lock_guard<std::mutex> lock( acct.mutex );
+    acct.categories[category].bytesInUse -= bytes;
+    acct.total.bytesInUse -= bytes;
+}
+
+void PushMemorySection( const std::string& name )
+{
+    Accounting& acct = GetAccounting();
+    std::lock_guard<std::mutex> lock( acct.mutex );
+    MemorySectionUsage& section = acct.sections[name];
+    if( section.name.empty() )
+    {
+        section.name = name;
+        section.peakBytesInUse = 0;
+        section.bytesAllocated = 0;
+    }
+    section.peakBytesInUse =
+        std::max( section.peakBytesInUse, acct.total.bytesInUse );
+    acct.activeSections.push_back( &section );
+}
+
+void PopMemorySection()
+{
+    Accounting& acct = GetAccounting();
+    std::lock_guard<std::mutex> lock( acct.mutex );
+    if( !acct.activeSections.empty() )
+        acct.activeSections.pop_back();
+}
+
+MemoryUsage GetMemoryUsage( MemoryCategory category )
+{
+    Accounting& acct = GetAccounting();
+    std::lock_guard<std::mutex> lock( acct.mutex );
+    return acct.categories[category];
+}
+
+MemoryUsage GetTotalMemoryUsage()
+{
+    Accounting& acct = GetAccounting();
+    std::lock_guard<std::mutex> lock( acct.mutex );
+    return acct.total;
+}
+
+std::vector<MemorySectionUsage> GetMemorySectionUsage()
+{
+    Accounting& acct = GetAccounting();
+    std::lock_guard<std::mutex> lock( acct.mutex );
+    std::vector<MemorySectionUsage> sections;
+    std::map<std::string, MemorySectionUsage>::const_iterator it;
+    for( it=acct.sections.begin(); it!=acct.sections.end(); ++it )
+        sections.push_back( it->second );
+    return sections;
+}
+
+void ResetMemoryPeaks()
+{
+    Accounting& acct = GetAccounting();
+    std::lock_guard<std::mutex> lock( acct.mutex );
+    for( Unsigned i=0; i<MemoryCategory_MAX; ++i )
+    {
+        acct.categories[i].peakBytesInUse = acct.categories[i].bytesInUse;
+        acct.categories[i].numAllocations = 0;
+    }
+    acct.total.peakBytesInUse = acct.total.bytesInUse;
+    acct.total.numAllocations = 0;
+    acct.overruns = 0;
+    // Sections still running keep their (reset) entries
+    std::map<std::string, MemorySectionUsage>::iterator it;
+    for( it=acct.sections.begin(); it!=acct.sections.end(); )
+    {
+        if( std::find
+            ( acct.activeSections.begin(), acct.activeSections.end(),
+              &it->second ) == acct.activeSections.end() )
+            acct.sections.erase( it++ );
+        else
+        {
+            it->second.peakBytesInUse = acct.total.bytesInUse;
+            it->second.bytesAllocated = 0;
+            ++it;
+        }
+    }
+}
+
+void SetMemoryBudget( std::size_t bytes )
+{
+    Accounting& acct = GetAccounting();
+    std::lock_guard<std::mutex> lock( acct.mutex );
+    acct.budget = bytes;
+}
+
+std::size_t MemoryBudget()
+{
+    Accounting& acct = GetAccounting();
+    std::lock_guard<std::mutex> lock( acct.mutex );
+    return acct.budget;
+}
+
+std::size_t MemoryHeadroom()
+{
+    Accounting& acct = GetAccounting();
+    std::lock_guard<std::mutex> lock( acct.mutex );
+    if( acct.budget == 0 )
+        return std::numeric_limits<std::size_t>::max();
+    return acct.total.bytesInUse >= acct.budget ? 0 :
+           acct.budget - acct.total.bytesInUse;
+}
+
+std::size_t MemoryBudgetOverruns()
+{
+    Accounting& acct = GetAccounting();
+    std::lock_guard<std::mutex> lock( acct.mutex );
+    return acct.overruns;
+}
+
+void PrintMemoryUsage( std::ostream& os )
+{
+    std::ostringstream msg;
+    msg << "Memory usage (bytes):\n";
+    for( Unsigned i=0; i<MemoryCategory_MAX; ++i )
+    {
+        const MemoryCategory category = static_cast<MemoryCategory>(i);
+        PrintUsageLine
+        ( msg, MemoryCategoryName( category ), GetMemoryUsage( category ) );
+    }
+    PrintUsageLine( msg, "total", GetTotalMemoryUsage() );
+    const std::size_t budget = MemoryBudget();
+    if( budget != 0 )
+        msg << "  budget " << budget << ", exceeded "
+            << MemoryBudgetOverruns() << " times\n";
+
+    const std::vector<MemorySectionUsage> sections = GetMemorySectionUsage();
+    for( std::size_t i=0; i<sections.size(); ++i )
+        msg << "  section " << sections[i].name
+            << ": peak " << sections[i].peakBytesInUse
+            << ", allocated " << sections[i].bytesAllocated << "\n";
+    os << msg.str() << std::flush;
+}
+
+void ReportMemoryUsage( mpi::Comm comm, std::ostream& os )
+{
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    // Peaks of each category followed by the total peak
+    const Unsigned n = MemoryCategory_MAX + 1;
+    std::vector<unsigned long> peaks(n), maxPeaks(n), minPeaks(n), sumPeaks(n);
+    for( Unsigned i=0; i<MemoryCategory_MAX; ++i )
+        peaks[i] =
+          GetMemoryUsage( static_cast<MemoryCategory>(i) ).peakBytesInUse;
+    peaks[MemoryCategory_MAX] = GetTotalMemoryUsage().peakBytesInUse;
+
+    mpi::AllReduce( &peaks[0], &maxPeaks[0], n, mpi::MAX, comm );
+    mpi::AllReduce( &peaks[0], &minPeaks[0], n, mpi::MIN, comm );
+    mpi::AllReduce( &peaks[0], &sumPeaks[0], n, mpi::SUM, comm );
+
+    // Lowest rank attaining each maximum
+    std::vector<int> owners(n), maxOwners(n);
+    for( Unsigned i=0; i<n; ++i )
+        owners[i] = peaks[i] == maxPeaks[i] ? commRank : commSize;
+    mpi::AllReduce( &owners[0], &maxOwners[0], n, mpi::MIN, comm );
+
+    if( commRank != 0 )
+        return;
+    std::ostringstream msg;
+    msg << "Peak memory usage over " << commSize << " ranks (bytes):\n";
+    for( Unsigned i=0; i<n; ++i )
+    {
+        const std::string name = i == MemoryCategory_MAX ? "total" :
+            MemoryCategoryName( static_cast<MemoryCategory>(i) );
+        msg << "  " << std::left << std::setw(10) << name << std::right
+            << " min " << std::setw(14) << minPeaks[i]
+            << "  avg " << std::setw(14) << sumPeaks[i] / commSize
+            << "  max " << std::setw(14) << maxPeaks[i]
+            << " (rank " << maxOwners[i] << ")\n";
+    }
+    os << msg.str() << std::flush;
+}
+
+} // namespace rote
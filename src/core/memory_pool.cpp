@@ -0,0 +1,213 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "rote.hpp"
+
+namespace {
+
+const std::size_t MIN_CLASS_SIZE = 64;
+
+// Blocks are only interchangeable if they were obtained under the same policy
+typedef std::pair<std::size_t, rote::AllocationPolicy> BlockKey;
+typedef std::map<BlockKey, std::vector<void*> > FreeLists;
+
+struct Pool
+{
+    std::mutex mutex;
+    bool enabled;
+    std::size_t capacity;
+    // Cached blocks, keyed by size class and allocation policy
+    FreeLists freeLists;
+    rote::MemoryPoolStats stats;
+
+    Pool()
+    : enabled(true), capacity(std::size_t(1) << 30)
+    { std::memset( &stats, 0, sizeof(stats) ); }
+
+    ~Pool()
+    { Trim( 0 ); }
+
+    // Free cached blocks, largest first, until at most maxCachedBytes remain.
+    // Assumes the caller holds the mutex (or that no one else can).
+    void Trim( std::size_t maxCachedBytes )
+    {
+        while( stats.bytesCached > maxCachedBytes && !freeLists.empty() )
+        {
+            FreeLists::iterator it = --freeLists.end();
+            const std::size_t bytes = it->first.first;
+            std::vector<void*>& blocks = it->second;
+            while( !blocks.empty() && stats.bytesCached > maxCachedBytes )
+            {
+                rote::SystemDeallocate
+                ( blocks.back(), bytes, it->first.second );
+                blocks.pop_back();
+                stats.bytesCached -= bytes;
+                ++stats.numFrees;
+            }
+            if( blocks.empty() )
+                freeLists.erase( it );
+        }
+    }
+};
+
+Pool& GetPool()
+{
+    static Pool pool;
+    return pool;
+}
+
+} // anonymous namespace
+
+namespace rote {
+
+void SetMemoryPoolEnabled( bool enabled )
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    pool.enabled = enabled;
+    if( !enabled )
+        pool.Trim( 0 );
+}
+
+bool MemoryPoolEnabled()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    return pool.enabled;
+}
+
+void SetMemoryPoolCapacity( std::size_t maxCachedBytes )
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    pool.capacity = maxCachedBytes;
+    pool.Trim( maxCachedBytes );
+}
+
+std::size_t MemoryPoolCapacity()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    return pool.capacity;
+}
+
+std::size_t MemoryPoolClassSize( std::size_t bytes )
+{
+    if( bytes <= MIN_CLASS_SIZE )
+        return MIN_CLASS_SIZE;
+    // Find pow2 with pow2 < bytes <= 2*pow2 and round up to a quarter of it
+    std::size_t pow2 = MIN_CLASS_SIZE;
+    while( pow2 <= (bytes-1)/2 )
+        pow2 *= 2;
+    const std::size_t step = pow2 / 4;
+    return ((bytes + step - 1) / step) * step;
+}
+
+void* PoolAllocate( std::size_t& bytes, const AllocationPolicy& policy )
+{
+    bytes = MemoryPoolClassSize( bytes );
+    Pool& pool = GetPool();
+    {
+        std::lock_guard<std::mutex> lock( pool.mutex );
+        MemoryPoolStats& stats = pool.stats;
+        ++stats.numRequests;
+        FreeLists::iterator it =
+            pool.freeLists.find( BlockKey( bytes, policy ) );
+        if( it != pool.freeLists.end() && !it->second.empty() )
+        {
+            void* ptr = it->second.back();
+            it->second.pop_back();
+            ++stats.numHits;
+            stats.bytesCached -= bytes;
+            stats.bytesInUse += bytes;
+            stats.peakBytesInUse =
+                std::max( stats.peakBytesInUse, stats.bytesInUse );
+            return ptr;
+        }
+    }
+
+    void* ptr;
+    try { ptr = SystemAllocate( bytes, policy ); }
+    catch( std::bad_alloc& )
+    {
+        // Give the cached blocks back and try once more
+        TrimMemoryPool( 0 );
+        ptr = SystemAllocate( bytes, policy );
+    }
+
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    MemoryPoolStats& stats = pool.stats;
+    stats.bytesInUse += bytes;
+    stats.peakBytesInUse = std::max( stats.peakBytesInUse, stats.bytesInUse );
+    return ptr;
+}
+
+void PoolDeallocate
+( void* ptr, std::size_t bytes, const AllocationPolicy& policy )
+{
+    if( ptr == 0 )
+        return;
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    MemoryPoolStats& stats = pool.stats;
+    ++stats.numReleases;
+    stats.bytesInUse -= bytes;
+    // Cached blocks count against the memory budget as well
+    if( pool.enabled && stats.bytesCached + bytes <= pool.capacity &&
+        stats.bytesCached + bytes <= MemoryHeadroom() )
+    {
+        pool.freeLists[BlockKey( bytes, policy )].push_back( ptr );
+        stats.bytesCached += bytes;
+    }
+    else
+    {
+        SystemDeallocate( ptr, bytes, policy );
+        ++stats.numFrees;
+    }
+}
+
+void TrimMemoryPool( std::size_t maxCachedBytes )
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    pool.Trim( maxCachedBytes );
+}
+
+MemoryPoolStats GetMemoryPoolStats()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    return pool.stats;
+}
+
+void ResetMemoryPoolStats()
+{
+    Pool& pool = GetPool();
+    std::lock_guard<std::mutex> lock( pool.mutex );
+    MemoryPoolStats& stats = pool.stats;
+    stats.numRequests = 0;
+    stats.numHits = 0;
+    stats.numReleases = 0;
+    stats.numFrees = 0;
+    stats.peakBytesInUse = stats.bytesInUse;
+}
+
+void PrintMemoryPoolStats( std::ostream& os )
+{
+    const MemoryPoolStats stats = GetMemoryPoolStats();
+    os << "Memory pool statistics:\n"
+       << "  requests:       " << stats.numRequests << "\n"
+       << "  cache hits:     " << stats.numHits << "\n"
+       << "  releases:       " << stats.numReleases << "\n"
+       << "  system frees:   " << stats.numFrees << "\n"
+       << "  bytes in use:   " << stats.bytesInUse << "\n"
+       << "  peak in use:    " << stats.peakBytesInUse << "\n"
+       << "  bytes cached:   " << stats.bytesCached << std::endl;
+}
+
+} // namespace rote
@@ -11,24 +11,24 @@
 namespace rote {
 
 ModeDistribution::ModeDistribution()
-: entries_()
+: entries_(), blockSize_(1)
 { }
 
 ModeDistribution::ModeDistribution(std::initializer_list<Unsigned> list)
-: entries_(list)
+: entries_(list), blockSize_(1)
 { CheckIsValid(); }
 
 ModeDistribution::ModeDistribution(const std::vector<Unsigned>& dist)
-: entries_(dist)
+: entries_(dist), blockSize_(1)
 { CheckIsValid(); }
 
 ModeDistribution::ModeDistribution(const ModeDistribution& dist)
-: entries_(dist.entries_)
+: entries_(dist.entries_), blockSize_(dist.blockSize_)
 { }
 
 ModeDistribution::ModeDistribution(const std::string& dist)
-: entries_(StringToModeDist(dist).entries_)
-{ }
+: blockSize_(1)
+{ *this = StringToModeDist(dist); }
 
 ModeDistribution::~ModeDistribution()
 { }
@@ -41,6 +41,18 @@ std::vector<Unsigned>
 ModeDistribution::Entries() const
 { return entries_; }
 
+Unsigned
+ModeDistribution::BlockSize() const
+{ return blockSize_; }
+
+void
+ModeDistribution::SetBlockSize(Unsigned blockSize)
+{
+	if(blockSize == 0)
+		LogicError("Block size must be positive");
+	blockSize_ = blockSize;
+}
+
 ModeDistribution
 operator+(const ModeDistribution& lhs, const ModeDistribution& rhs){
 	ModeDistribution ret(lhs);
@@ -51,6 +63,7 @@ operator+(const ModeDistribution& lhs, const ModeDistribution& rhs){
 ModeDistribution&
 ModeDistribution::operator=(const ModeDistribution& rhs){
 	entries_ = rhs.entries_;
+	blockSize_ = rhs.blockSize_;
 	return *this;
 }
 
@@ -204,11 +217,11 @@ ModeDistribution::CheckIsValid()
 }
 
 bool operator==( const ModeDistribution& A, const ModeDistribution& B ){
-	return A.entries_ == B.entries_;
+	return A.entries_ == B.entries_ && A.blockSize_ == B.blockSize_;
 }
 
 bool operator!=( const ModeDistribution& A, const ModeDistribution& B ){
-	return !(A.entries_ == B.entries_);
+	return !(A == B);
 }
 
 inline std::string
@@ -221,6 +234,8 @@ ModeDistToString_( const ModeDistribution& distribution, bool endLine )
 		for(size_t i = 1; i < distribution.size(); i++)
 		  ss << ", " << distribution[i];
     }
+    if(distribution.BlockSize() != 1)
+        ss << ":" << distribution.BlockSize();
     ss <<  ")";
     if(endLine)
         ss << std::endl;
@@ -238,20 +253,29 @@ ModeDistribution
 StringToModeDist( const std::string& s)
 {
 	std::vector<Unsigned> distVals;
-	size_t pos, lastPos;
+	size_t pos, lastPos, blockPos;
 	pos = s.find_first_of("(");
 	lastPos = s.find_first_of(")");
 	if(pos != 0 || lastPos != s.size() - 1) {
 		LogicError("Malformed mode distribution string");
 	}
-	pos = s.find_first_not_of("(,)", pos);
+	//An optional ":blockSize" closes the list of grid modes
+	blockPos = s.find_first_of(":");
+	const std::string modes = s.substr(0, blockPos);
+	pos = modes.find_first_not_of("(,)", pos);
 	while(pos != std::string::npos){
-		lastPos = s.find_first_of(",)", pos);
-		distVals.push_back(atoi(s.substr(pos, lastPos - pos).c_str()));
-		pos = s.find_first_not_of("(,)", lastPos+1);
+		lastPos = modes.find_first_of(",)", pos);
+		distVals.push_back(atoi(modes.substr(pos, lastPos - pos).c_str()));
+		pos = modes.find_first_not_of("(,)", lastPos);
 	}
 
 	ModeDistribution ret(distVals);
+	if(blockPos != std::string::npos){
+		const int blockSize = atoi(s.substr(blockPos + 1).c_str());
+		if(blockSize <= 0)
+			LogicError("Malformed block size in mode distribution string");
+		ret.SetBlockSize(blockSize);
+	}
 	return ret;
 }
 
@@ -0,0 +1,184 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "rote.hpp"
+
+#ifdef HAVE_SYS_MMAN_H
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
+namespace {
+
+struct Mappings
+{
+    std::mutex mutex;
+    std::string scratchDir;
+    // Start of each scratch mapping and its length
+    std::map<const char*, std::size_t> regions;
+
+    Mappings()
+    {
+        const char* dir = std::getenv( "ROTE_SCRATCH_DIR" );
+        if( dir == 0 )
+            dir = std::getenv( "TMPDIR" );
+        scratchDir = dir != 0 ? dir : "/tmp";
+    }
+};
+
+Mappings& GetMappings()
+{
+    static Mappings mappings;
+    return mappings;
+}
+
+#ifdef HAVE_SYS_MMAN_H
+
+std::size_t PageSize()
+{
+    static const std::size_t pageSize = sysconf( _SC_PAGESIZE );
+    return pageSize;
+}
+
+// Clips [ptr,ptr+bytes) to the scratch mapping containing ptr and widens it
+// to whole pages; returns false if ptr is not in one
+bool ScratchPages
+( const void* ptr, std::size_t bytes, char*& begin, std::size_t& length )
+{
+    const char* p = static_cast<const char*>(ptr);
+    const char* end;
+    {
+        Mappings& mappings = GetMappings();
+        std::lock_guard<std::mutex> lock( mappings.mutex );
+        std::map<const char*, std::size_t>::const_iterator it =
+            mappings.regions.upper_bound( p );
+        if( it == mappings.regions.begin() )
+            return false;
+        --it;
+        if( p >= it->first + it->second )
+            return false;
+        end = std::min( p + bytes, it->first + it->second );
+    }
+    const std::size_t pageSize = PageSize();
+    begin = reinterpret_cast<char*>
+            (reinterpret_cast<std::size_t>(p) / pageSize * pageSize);
+    length = end - begin;
+    return length != 0;
+}
+
+#endif // ifdef HAVE_SYS_MMAN_H
+
+} // anonymous namespace
+
+namespace rote {
+
+void SetScratchDirectory( const std::string& dir )
+{
+    Mappings& mappings = GetMappings();
+    std::lock_guard<std::mutex> lock( mappings.mutex );
+    mappings.scratchDir = dir;
+}
+
+std::string ScratchDirectory()
+{
+    Mappings& mappings = GetMappings();
+    std::lock_guard<std::mutex> lock( mappings.mutex );
+    return mappings.scratchDir;
+}
+
+void* MapScratchFile( const std::string& dir, std::size_t& bytes )
+{
+#ifdef HAVE_SYS_MMAN_H
+    const std::size_t pageSize = PageSize();
+    bytes = std::max( (bytes + pageSize - 1) / pageSize, std::size_t(1) ) *
+            pageSize;
+
+    const std::string pattern = dir + "/rote-scratch-XXXXXX";
+    std::vector<char> name( pattern.begin(), pattern.end() );
+    name.push_back( '\0' );
+    const int fd = mkstemp( &name[0] );
+    if( fd < 0 )
+        RuntimeError("Could not create a scratch file in " + dir);
+    // Nothing else needs the name, and this way the file cannot outlive us
+    unlink( &name[0] );
+    if( ftruncate( fd, bytes ) != 0 )
+    {
+        close( fd );
+        std::ostringstream msg;
+        msg << "Could not extend a scratch file in " << dir << " to "
+            << bytes << " bytes";
+        RuntimeError( msg.str() );
+    }
+    void* ptr =
+        mmap( 0, bytes, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0 );
+    close( fd );
+    if( ptr == MAP_FAILED )
+        RuntimeError("Could not map a scratch file in " + dir);
+
+    Mappings& mappings = GetMappings();
+    std::lock_guard<std::mutex> lock( mappings.mutex );
+    mappings.regions[static_cast<const char*>(ptr)] = bytes;
+    return ptr;
+#else
+    LogicError("Out-of-core storage requires mmap");
+    return 0;
+#endif
+}
+
+void UnmapScratchFile( void* ptr, std::size_t bytes )
+{
+#ifdef HAVE_SYS_MMAN_H
+    if( ptr == 0 )
+        return;
+    {
+        Mappings& mappings = GetMappings();
+        std::lock_guard<std::mutex> lock( mappings.mutex );
+        mappings.regions.erase( static_cast<const char*>(ptr) );
+    }
+    munmap( ptr, bytes );
+#endif
+}
+
+bool IsOutOfCore( const void* ptr )
+{
+#ifdef HAVE_SYS_MMAN_H
+    char* begin;
+    std::size_t length;
+    return ptr != 0 && ScratchPages( ptr, 1, begin, length );
+#else
+    return false;
+#endif
+}
+
+void PrefetchOutOfCore( const void* ptr, std::size_t bytes )
+{
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MADVISE)
+    char* begin;
+    std::size_t length;
+    if( ScratchPages( ptr, bytes, begin, length ) )
+        madvise( begin, length, MADV_WILLNEED );
+#endif
+}
+
+void EvictOutOfCore( const void* ptr, std::size_t bytes )
+{
+#ifdef HAVE_SYS_MMAN_H
+    char* begin;
+    std::size_t length;
+    if( !ScratchPages( ptr, bytes, begin, length ) )
+        return;
+    msync( begin, length, MS_ASYNC );
+#ifdef HAVE_MADVISE
+    // Dirty pages of a shared mapping stay in the page cache, so this only
+    // unmaps them from the process
+    madvise( begin, length, MADV_DONTNEED );
+#endif
+#endif
+}
+
+} // namespace rote
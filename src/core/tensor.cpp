@@ -16,11 +16,11 @@ namespace rote {
 
 template<typename T>
 void
-Tensor<T>::AssertValidDimensions( const ObjShape& shape, const std::vector<Unsigned>& strides ) const
+Tensor<T>::AssertValidDimensions( const ObjShape& shape, const std::vector<Offset>& strides ) const
 {
     if(shape.size() != strides.size())
         LogicError("shape order must match strides order");
-    if( !ElemwiseLessThan(shape, strides) )
+    if( !ElemwiseLessThan(std::vector<Offset>(shape.begin(), shape.end()), strides) )
         LogicError("Leading dimensions must be no less than dimensions");
     if( AnyZeroElem(strides) )
         LogicError("Leading dimensions cannot be zero (for BLAS compatibility)");
@@ -91,7 +91,7 @@ Tensor<T>::Tensor( const ObjShape& shape, bool fixed )
   viewType_( fixed ? OWNER_FIXED : OWNER )
 {
     const Unsigned order = Order();
-    Unsigned numElem = order > 0 ? strides_[order-1] * shape_[order-1] : 1;
+    Offset numElem = order > 0 ? strides_[order-1] * shape_[order-1] : 1;
 
     memory_.Require( numElem );
     data_ = memory_.Buffer();
@@ -100,7 +100,7 @@ Tensor<T>::Tensor( const ObjShape& shape, bool fixed )
 //TODO: Check for valid set of indices
 template<typename T>
 Tensor<T>::Tensor
-( const ObjShape& shape, const std::vector<Unsigned>& strides, bool fixed )
+( const ObjShape& shape, const std::vector<Offset>& strides, bool fixed )
 : shape_(shape), strides_(strides),
   viewType_( fixed ? OWNER_FIXED : OWNER )
 {
@@ -108,7 +108,7 @@ Tensor<T>::Tensor
     AssertValidDimensions( shape, strides );
 #endif
     const Unsigned order = Order();
-    Unsigned numElem = order > 0 ? strides_[order-1] * shape_[order-1] : 1;
+    Offset numElem = order > 0 ? strides_[order-1] * shape_[order-1] : 1;
 
     memory_.Require( numElem );
     data_ = memory_.Buffer();
@@ -116,7 +116,7 @@ Tensor<T>::Tensor
 
 template<typename T>
 Tensor<T>::Tensor
-( const ObjShape& shape, const T* buffer, const std::vector<Unsigned>& strides, bool fixed )
+( const ObjShape& shape, const T* buffer, const std::vector<Offset>& strides, bool fixed )
 : shape_(shape), strides_(strides),
   viewType_( fixed ? LOCKED_VIEW_FIXED: LOCKED_VIEW ),
   data_(buffer), memory_()
@@ -126,7 +126,7 @@ Tensor<T>::Tensor
 
 template<typename T>
 Tensor<T>::Tensor
-( const ObjShape& shape, T* buffer, const std::vector<Unsigned>& strides, bool fixed )
+( const ObjShape& shape, T* buffer, const std::vector<Offset>& strides, bool fixed )
 : shape_(shape), strides_(strides),
   viewType_( fixed ? VIEW_FIXED: VIEW ),
   data_(buffer), memory_()
@@ -149,6 +149,18 @@ Tensor<T>::Tensor( const Tensor<T>& A )
         LogicError("You just tried to construct a Tensor with itself!");
 }
 
+template<typename T>
+Tensor<T>::Tensor( Tensor<T>&& A )
+: shape_(std::move(A.shape_)), strides_(std::move(A.strides_)),
+  viewType_( A.viewType_ ),
+  data_(A.data_), memory_(std::move(A.memory_))
+{
+    A.shape_.clear();
+    A.strides_.clear();
+    A.viewType_ = OWNER;
+    A.data_ = 0;
+}
+
 template<typename T>
 void
 Tensor<T>::Swap( Tensor<T>& A )
@@ -200,14 +212,14 @@ Tensor<T>::Dimension(Mode mode) const
 }
 
 template<typename T>
-std::vector<Unsigned>
+std::vector<Offset>
 Tensor<T>::Strides() const
 {
     return strides_;
 }
 
 template<typename T>
-Unsigned
+Offset
 Tensor<T>::Stride(Mode mode) const
 {
     const Unsigned order = Order();
@@ -220,10 +232,96 @@ Tensor<T>::Stride(Mode mode) const
 }
 
 template<typename T>
-Unsigned
+Offset
 Tensor<T>::MemorySize() const
 { return memory_.Size(); }
 
+template<typename T>
+void
+Tensor<T>::SetAllocationPolicy( const AllocationPolicy& policy )
+{
+    memory_.SetPolicy( policy );
+    if( Owner() )
+        data_ = memory_.Buffer();
+}
+
+template<typename T>
+AllocationPolicy
+Tensor<T>::GetAllocationPolicy() const
+{ return memory_.Policy(); }
+
+template<typename T>
+void
+Tensor<T>::SetOutOfCore( const std::string& dir )
+{
+    memory_.SetOutOfCore( dir );
+    if( Owner() )
+        data_ = memory_.Buffer();
+}
+
+template<typename T>
+void
+Tensor<T>::SetInCore()
+{
+    memory_.SetInCore();
+    if( Owner() )
+        data_ = memory_.Buffer();
+}
+
+template<typename T>
+bool
+Tensor<T>::OutOfCore() const
+{ return IsOutOfCore( data_ ); }
+
+// Bytes from the first to just past the last entry
+template<typename T>
+static std::size_t
+SpanBytes( const ObjShape& shape, const std::vector<Offset>& strides )
+{
+    Offset last = 0;
+    for( Unsigned i = 0; i < shape.size(); ++i )
+    {
+        if( shape[i] == 0 )
+            return 0;
+        last += (shape[i]-1)*strides[i];
+    }
+    return (last+1)*sizeof(T);
+}
+
+template<typename T>
+void
+Tensor<T>::Prefetch() const
+{ PrefetchOutOfCore( data_, SpanBytes<T>( shape_, strides_ ) ); }
+
+template<typename T>
+void
+Tensor<T>::Evict() const
+{ EvictOutOfCore( data_, SpanBytes<T>( shape_, strides_ ) ); }
+
+template<typename T>
+void
+Tensor<T>::SetNodeShared( mpi::Comm comm )
+{
+    memory_.SetNodeShared( comm );
+    if( Owner() )
+        data_ = memory_.Buffer();
+}
+
+template<typename T>
+bool
+Tensor<T>::NodeShared() const
+{ return memory_.NodeShared(); }
+
+template<typename T>
+bool
+Tensor<T>::NodeLeader() const
+{ return memory_.NodeLeader(); }
+
+template<typename T>
+void
+Tensor<T>::NodeSync() const
+{ memory_.NodeSync(); }
+
 template<typename T>
 bool
 Tensor<T>::Owner() const
@@ -277,7 +375,7 @@ Tensor<T>::Buffer( const Location& loc )
 #endif
     // NOTE: This const_cast has been carefully considered and should be safe
     //       since the underlying data should be non-const if this is called.
-    Unsigned linearOffset = LinearLocFromStrides(loc, strides_);
+    Offset linearOffset = LinearLocFromStrides(loc, strides_);
     return &const_cast<T*>(data_)[linearOffset];
 }
 
@@ -285,7 +383,7 @@ template<typename T>
 const T*
 Tensor<T>::LockedBuffer( const Location& loc ) const
 {
-    Unsigned linearOffset = LinearLocFromStrides(loc, strides_);
+    Offset linearOffset = LinearLocFromStrides(loc, strides_);
     return &data_[linearOffset];
 }
 
@@ -316,7 +414,7 @@ Tensor<T>::IntroduceUnitModes(const ModeArray& modes){
     shape_.reserve(shape_.size() + sorted.size());
     strides_.reserve(strides_.size() + sorted.size());
     for(i = 0; i < sorted.size(); i++){
-        Unsigned newStrideVal;
+        Offset newStrideVal;
         if(sorted[i] == strides_.size()){
             if(sorted[i] == 0){
                 newStrideVal = 1;
@@ -483,7 +581,7 @@ Tensor<T>::UpdateImagPart( const Location& loc, BASE(T) alpha )
 
 template<typename T>
 void
-Tensor<T>::Attach_( const ObjShape& shape, T* buffer, const std::vector<Unsigned>& strides )
+Tensor<T>::Attach_( const ObjShape& shape, T* buffer, const std::vector<Offset>& strides )
 {
     memory_.Empty();
     shape_ = shape;
@@ -494,7 +592,7 @@ Tensor<T>::Attach_( const ObjShape& shape, T* buffer, const std::vector<Unsigned
 
 template<typename T>
 void
-Tensor<T>::Attach( const ObjShape& shape, T* buffer, const std::vector<Unsigned>& strides )
+Tensor<T>::Attach( const ObjShape& shape, T* buffer, const std::vector<Offset>& strides )
 {
 #ifndef RELEASE
     if( FixedSize() )
@@ -505,7 +603,7 @@ Tensor<T>::Attach( const ObjShape& shape, T* buffer, const std::vector<Unsigned>
 
 template<typename T>
 void
-Tensor<T>::LockedAttach_( const ObjShape& shape, const T* buffer, const std::vector<Unsigned>& strides )
+Tensor<T>::LockedAttach_( const ObjShape& shape, const T* buffer, const std::vector<Offset>& strides )
 {
     memory_.Empty();
     shape_ = shape;
@@ -517,7 +615,7 @@ Tensor<T>::LockedAttach_( const ObjShape& shape, const T* buffer, const std::vec
 template<typename T>
 void
 Tensor<T>::LockedAttach
-( const ObjShape& shape, const T* buffer, const std::vector<Unsigned>& strides )
+( const ObjShape& shape, const T* buffer, const std::vector<Offset>& strides )
 {
 #ifndef RELEASE
     if( FixedSize() )
@@ -549,6 +647,35 @@ Tensor<T>::operator=( const Tensor<T>& A )
     return *this;
 }
 
+template<typename T>
+Tensor<T>&
+Tensor<T>::operator=( Tensor<T>&& A )
+{
+    if( &A == this )
+        return *this;
+    // Views are written through and viewed data is copied, as in the
+    // copying assignment
+    if( Viewing() || A.Viewing() )
+    {
+        *this = static_cast<const Tensor<T>&>(A);
+        return *this;
+    }
+#ifndef RELEASE
+    if( FixedSize() && AnyElemwiseNotEqual(A.shape_, shape_) )
+        LogicError
+        ("Cannot assign to a fixed-size tensor of different dimensions");
+#endif
+    shape_ = std::move(A.shape_);
+    strides_ = std::move(A.strides_);
+    data_ = A.data_;
+    memory_ = std::move(A.memory_);
+
+    A.shape_.clear();
+    A.strides_.clear();
+    A.data_ = 0;
+    return *this;
+}
+
 template<typename T>
 void
 Tensor<T>::Empty_()
@@ -610,27 +737,27 @@ Tensor<T>::ResizeTo( const ObjShape& shape )
 
 template<typename T>
 void
-Tensor<T>::ResizeTo_( const ObjShape& shape, const std::vector<Unsigned>& strides )
+Tensor<T>::ResizeTo_( const ObjShape& shape, const std::vector<Offset>& strides )
 {
 	Unsigned oldOrder = shape_.size();
-	Unsigned curMaxElem = (oldOrder == 0) ? 1 : shape_[oldOrder - 1] * strides_[oldOrder - 1];
+	Offset curMaxElem = (oldOrder == 0) ? 1 : shape_[oldOrder - 1] * strides_[oldOrder - 1];
 
 	Unsigned newOrder = shape.size();
-	Unsigned newMaxElem = (newOrder == 0) ? 1 : shape[newOrder - 1] * strides[newOrder - 1];
+	Offset newMaxElem = (newOrder == 0) ? 1 : shape[newOrder - 1] * strides[newOrder - 1];
 
 	shape_ = shape;
 	strides_ = strides;
 
 	//Guard has newOrder == 0 in case we resize scalar to scalar (ensures at least one data entry is created)
 	if(newOrder == 0 || (curMaxElem < newMaxElem)){
-		memory_.Require(Max(1,newMaxElem));
+		memory_.Require(std::max<Offset>(1, newMaxElem));
 		data_ = memory_.Buffer();
 	}
 }
 
 template<typename T>
 void
-Tensor<T>::ResizeTo( const ObjShape& shape, const std::vector<Unsigned>& strides )
+Tensor<T>::ResizeTo( const ObjShape& shape, const std::vector<Offset>& strides )
 {
     //TODO: IMPLEMENT CORRECTLY
 #ifndef RELEASE
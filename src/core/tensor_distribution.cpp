@@ -62,6 +62,30 @@ TensorDistribution::UnusedModes() const{
 	return entries_[entries_.size() - 1];
 }
 
+std::vector<Unsigned>
+TensorDistribution::BlockSizes() const{
+	std::vector<Unsigned> ret(entries_.empty() ? 0 : entries_.size() - 1);
+	for(Unsigned i = 0; i < ret.size(); i++)
+		ret[i] = entries_[i].BlockSize();
+	return ret;
+}
+
+bool
+TensorDistribution::IsBlockCyclic() const{
+	for(Unsigned i = 0; i < entries_.size(); i++)
+		if(entries_[i].BlockSize() != 1)
+			return true;
+	return false;
+}
+
+TensorDistribution
+TensorDistribution::ElementCyclic() const{
+	TensorDistribution ret(*this);
+	for(Unsigned i = 0; i < ret.entries_.size(); i++)
+		ret.entries_[i].SetBlockSize(1);
+	return ret;
+}
+
 void
 TensorDistribution::SetToMatch(const TensorDistribution& other, const IndexArray& otherIndices, const IndexArray& myIndices){
 	Unsigned i;
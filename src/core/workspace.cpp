@@ -0,0 +1,225 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "rote.hpp"
+
+namespace {
+
+thread_local rote::Workspace* currentWorkspace = 0;
+
+} // anonymous namespace
+
+namespace rote {
+
+Workspace::Workspace( std::size_t bytes )
+: arena_(new WorkspaceArena( bytes ))
+{ }
+
+Workspace::~Workspace()
+{ arena_->Close(); }
+
+void Workspace::Reserve( std::size_t bytes )
+{ arena_->Reserve( bytes ); }
+
+std::size_t Workspace::Capacity() const
+{ return arena_->Capacity(); }
+
+std::size_t Workspace::BytesInUse() const
+{ return arena_->BytesInUse(); }
+
+std::size_t Workspace::HighWater() const
+{ return arena_->HighWater(); }
+
+std::size_t Workspace::NumMisses() const
+{ return arena_->NumMisses(); }
+
+const std::shared_ptr<WorkspaceArena>& Workspace::Arena() const
+{ return arena_; }
+
+WorkspaceArena::WorkspaceArena( std::size_t bytes )
+: buffer_(0), capacity_(0), offset_(0), highWater_(0), numMisses_(0),
+  lastSerial_(0), closed_(false)
+{
+    unwound_.offset = 0;
+    unwound_.serial = 0;
+    unwound_.numLive = 0;
+    Reserve( bytes );
+}
+
+WorkspaceArena::~WorkspaceArena()
+{ Free(); }
+
+void WorkspaceArena::Free()
+{
+    if( buffer_ != 0 )
+    {
+        TrackDeallocation( CONTRACT_MEMORY, capacity_ );
+        PoolDeallocate( buffer_, capacity_, policy_ );
+        buffer_ = 0;
+        capacity_ = 0;
+    }
+}
+
+void WorkspaceArena::Reserve( std::size_t bytes )
+{
+    if( bytes <= capacity_ || offset_ != 0 || closed_ )
+        return;
+    Free();
+    std::size_t capacity = bytes;
+    policy_ = DefaultAllocationPolicy();
+    buffer_ = static_cast<char*>(PoolAllocate( capacity, policy_ ));
+    capacity_ = capacity;
+    TrackAllocation( CONTRACT_MEMORY, capacity_ );
+}
+
+std::size_t WorkspaceArena::Capacity() const
+{ return capacity_; }
+
+std::size_t WorkspaceArena::BytesInUse() const
+{ return offset_; }
+
+std::size_t WorkspaceArena::HighWater() const
+{ return highWater_; }
+
+std::size_t WorkspaceArena::NumMisses() const
+{ return numMisses_; }
+
+std::size_t WorkspaceArena::CurrentMark() const
+{ return frames_.empty() ? 0 : frames_.back().serial; }
+
+void* WorkspaceArena::Allocate( std::size_t bytes, std::size_t alignment )
+{
+    if( frames_.empty() )
+        return 0;
+    // Aligning offsets suffices for alignments buffer_ itself satisfies
+    const std::size_t start =
+        ((offset_ + alignment - 1) / alignment) * alignment;
+    highWater_ = std::max( highWater_, start + bytes );
+    if( alignment > policy_.alignment ||
+        start + bytes > capacity_ )
+    {
+        ++numMisses_;
+        return 0;
+    }
+    offset_ = start + bytes;
+    ++frames_.back().numLive;
+    return buffer_ + start;
+}
+
+bool WorkspaceArena::Frame::Holds( std::size_t mark ) const
+{
+    return serial == mark ||
+           std::find( retired.begin(), retired.end(), mark ) != retired.end();
+}
+
+void WorkspaceArena::Deallocate
+( void* ptr, std::size_t bytes, std::size_t mark )
+{
+    std::size_t i = frames_.size();
+    while( i > 0 && !frames_[i-1].Holds( mark ) )
+        --i;
+    if( i == 0 )
+    {
+        // Every live block is counted in a frame, so there is nothing to
+        // give back for an unknown mark
+        if( !unwound_.Holds( mark ) )
+            return;
+        // The last survivor of a closed outermost mark frees the workspace
+        if( --unwound_.numLive == 0 )
+        {
+            unwound_.retired.clear();
+            if( frames_.empty() )
+                offset_ = 0;
+            if( closed_ )
+                Free();
+        }
+        return;
+    }
+    --frames_[i-1].numLive;
+    // The most recent block can be handed back right away
+    char* block = static_cast<char*>(ptr);
+    if( i == frames_.size() && block + bytes == buffer_ + offset_ )
+        offset_ = block - buffer_;
+}
+
+void WorkspaceArena::OpenMark()
+{
+    Frame frame;
+    frame.offset = offset_;
+    frame.serial = ++lastSerial_;
+    frame.numLive = 0;
+    frames_.push_back( frame );
+}
+
+void WorkspaceArena::CloseMark()
+{
+    Frame& frame = frames_.back();
+    if( frame.numLive == 0 )
+    {
+        offset_ = frame.offset;
+        if( frames_.size() == 1 && unwound_.numLive == 0 )
+            offset_ = 0;
+    }
+    else
+    {
+        // Blocks moved out of the mark are still in use: leave offset_
+        // past them and let the enclosing mark account for them instead
+        Frame& parent = frames_.size() > 1 ? frames_[frames_.size()-2]
+                                           : unwound_;
+        parent.numLive += frame.numLive;
+        parent.retired.push_back( frame.serial );
+        parent.retired.insert
+        ( parent.retired.end(), frame.retired.begin(), frame.retired.end() );
+    }
+    frames_.pop_back();
+    // Completely unwound: grow to what the last pass needed
+    if( frames_.empty() && highWater_ > capacity_ )
+        Reserve( highWater_ );
+}
+
+void WorkspaceArena::Close()
+{
+    closed_ = true;
+    // Marks are scoped inside the workspace, but close any left open so
+    // their blocks are counted as survivors
+    while( !frames_.empty() )
+        CloseMark();
+    if( unwound_.numLive == 0 )
+        Free();
+}
+
+WorkspaceScope::WorkspaceScope( Workspace& workspace )
+: previous_(currentWorkspace)
+{ currentWorkspace = &workspace; }
+
+WorkspaceScope::~WorkspaceScope()
+{ currentWorkspace = previous_; }
+
+WorkspaceMark::WorkspaceMark()
+: workspace_(currentWorkspace)
+{
+    if( workspace_ != 0 )
+        workspace_->arena_->OpenMark();
+}
+
+WorkspaceMark::~WorkspaceMark()
+{
+    if( workspace_ != 0 )
+        workspace_->arena_->CloseMark();
+}
+
+Workspace* CurrentWorkspace()
+{ return currentWorkspace; }
+
+std::shared_ptr<WorkspaceArena> CurrentWorkspaceArena()
+{
+    return currentWorkspace != 0 ? currentWorkspace->Arena()
+                                 : std::shared_ptr<WorkspaceArena>();
+}
+
+} // namespace rote
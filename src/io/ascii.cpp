@@ -0,0 +1,245 @@
+/*
+   Copyright (c) 2009-2015, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "rote.hpp"
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#ifdef HAVE_OPENMP
+# include <omp.h>
+#endif
+
+namespace rote {
+
+namespace {
+
+//Ranges shorter than this are parsed on one thread
+#define ASCII_PARALLEL_BYTES (1 << 20)
+
+inline bool IsSpace( char c )
+{ return std::isspace(static_cast<unsigned char>(c)) != 0; }
+
+//Each parser converts the entry at p, returning the first character past
+//it, or p itself if there is no valid entry there
+inline const char* ParseEntry( const char* p, Int& value )
+{
+    char* q;
+    value = static_cast<Int>(std::strtol(p, &q, 10));
+    return q;
+}
+
+inline const char* ParseEntry( const char* p, float& value )
+{
+    char* q;
+    value = std::strtof(p, &q);
+    return q;
+}
+
+inline const char* ParseEntry( const char* p, double& value )
+{
+    char* q;
+    value = std::strtod(p, &q);
+    return q;
+}
+
+template<typename R>
+inline const char* ParseEntry( const char* p, std::complex<R>& value )
+{
+    R re = 0, im = 0;
+    if( *p != '(' )
+    {
+        const char* q = ParseEntry(p, re);
+        value = std::complex<R>(re, im);
+        return q;
+    }
+    const char* q = ParseEntry(p + 1, re);
+    if( q == p + 1 )
+        return p;
+    while( IsSpace(*q) )
+        q++;
+    if( *q == ',' )
+    {
+        const char* r = ParseEntry(q + 1, im);
+        if( r == q + 1 )
+            return p;
+        q = r;
+        while( IsSpace(*q) )
+            q++;
+    }
+    if( *q != ')' )
+        return p;
+    value = std::complex<R>(re, im);
+    return q + 1;
+}
+
+//Parses [begin,end) into values, returning false on a malformed entry
+template<typename T>
+bool ParseRange( const char* begin, const char* end, std::vector<T>& values )
+{
+    const char* p = begin;
+    while( true )
+    {
+        while( p < end && IsSpace(*p) )
+            p++;
+        if( p >= end )
+            return true;
+        T value;
+        const char* q = ParseEntry(p, value);
+        if( q == p || q > end )
+            return false;
+        values.push_back(value);
+        p = q;
+    }
+}
+
+} // anonymous namespace
+
+template<typename T>
+void ParseAscii( const char* begin, const char* end, std::vector<T>& values )
+{
+#ifndef RELEASE
+    if( *end != '\0' && !IsSpace(*end) )
+        LogicError("ASCII ranges must end at whitespace or NUL");
+#endif
+    bool ok = true;
+#ifdef HAVE_OPENMP
+    if( end - begin >= ASCII_PARALLEL_BYTES && !omp_in_parallel() )
+    {
+        //Each thread takes a contiguous piece, moved forward to the next
+        //whitespace so no entry straddles two pieces
+        const Unsigned nThreads = omp_get_max_threads();
+        const Offset length = end - begin;
+        std::vector<const char*> splits(nThreads + 1, end);
+        splits[0] = begin;
+        for( Unsigned t = 1; t < nThreads; t++ )
+        {
+            const char* s = std::max(begin + length * t / nThreads, splits[t - 1]);
+            while( s < end && !IsSpace(*s) )
+                s++;
+            splits[t] = s;
+        }
+        std::vector<std::vector<T> > pieces(nThreads);
+        #pragma omp parallel for schedule(static, 1) reduction(&&:ok)
+        for( Int t = 0; t < static_cast<Int>(nThreads); t++ )
+            ok = ParseRange(splits[t], splits[t + 1], pieces[t]) && ok;
+
+        Offset nValues = values.size();
+        for( Unsigned t = 0; t < nThreads; t++ )
+            nValues += pieces[t].size();
+        values.reserve(nValues);
+        for( Unsigned t = 0; t < nThreads; t++ )
+            values.insert(values.end(), pieces[t].begin(), pieces[t].end());
+    }
+    else
+#endif
+        ok = ParseRange(begin, end, values);
+
+    if( !ok )
+        RuntimeError("Malformed entry in ASCII tensor file");
+}
+
+template<typename T>
+AsciiReader<T>::AsciiReader( std::istream& file, Offset maxBytes )
+: file_(file), pos_(0), bytesLeft_(maxBytes), lineDone_(false),
+  sawNewline_(false)
+{ }
+
+template<typename T>
+void AsciiReader<T>::Refill()
+{
+    values_.clear();
+    pos_ = 0;
+    while( values_.empty() )
+        if( !ReadChunk() )
+            RuntimeError("Too few entries in ASCII tensor file");
+}
+
+//Parses the next chunk into values_, returning false once the line is done
+template<typename T>
+bool AsciiReader<T>::ReadChunk()
+{
+    if( lineDone_ )
+        return false;
+
+    //text_ holds the partial entry left over from the last chunk
+    const Offset carry = text_.size();
+    const Offset nWanted = std::min(static_cast<Offset>(ASCII_CHUNK_BYTES), bytesLeft_);
+    text_.resize(carry + nWanted + 1);
+    file_.read(&(text_[carry]), nWanted);
+    const Offset nRead = file_.gcount();
+    bytesLeft_ -= nRead;
+    Offset size = carry + nRead;
+
+    //The data line ends at the first newline
+    const char* newline = static_cast<const char*>(std::memchr(&(text_[carry]), '\n', nRead));
+    if( newline != 0 ){
+        size = newline - &(text_[0]);
+        lineDone_ = true;
+        sawNewline_ = true;
+    }else if( nRead < nWanted || bytesLeft_ == 0 ){
+        lineDone_ = true;
+    }
+
+    //Parse up to the last whitespace and carry the rest over
+    Offset cut = size;
+    if( lineDone_ ){
+        text_[size] = '\0';
+    }else{
+        while( cut > 0 && !IsSpace(text_[cut - 1]) )
+            cut--;
+        cut = cut > 0 ? cut - 1 : 0;
+    }
+    if( cut > 0 )
+        ParseAscii(&(text_[0]), &(text_[cut]), values_);
+    text_.resize(size);
+    text_.erase(text_.begin(), text_.begin() + cut);
+    return true;
+}
+
+template<typename T>
+void AsciiReader<T>::Skip( Offset n )
+{
+    while( n > 0 )
+    {
+        if( pos_ == values_.size() )
+            Refill();
+        const Offset step = std::min(n, static_cast<Offset>(values_.size() - pos_));
+        pos_ += step;
+        n -= step;
+    }
+}
+
+template<typename T>
+void AsciiReader<T>::ReadAll( std::vector<T>& values )
+{
+    do
+    {
+        values.insert(values.end(), values_.begin() + pos_, values_.end());
+        values_.clear();
+        pos_ = 0;
+    } while( ReadChunk() );
+}
+
+#define FULL(T) \
+  template void ParseAscii( const char* begin, const char* end, std::vector<T>& values ); \
+  template class AsciiReader<T>;
+
+FULL(Int)
+#ifndef DISABLE_FLOAT
+FULL(float)
+#endif
+FULL(double)
+
+#ifndef DISABLE_COMPLEX
+#ifndef DISABLE_FLOAT
+FULL(std::complex<float>)
+#endif
+FULL(std::complex<double>)
+#endif
+
+} // namespace rote
@@ -0,0 +1,349 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "rote.hpp"
+
+namespace rote {
+
+namespace {
+
+struct CheckpointInfo
+{
+    Unsigned entrySize;
+    ObjShape gridShape;
+    ObjShape shape;
+    TensorDistribution dist;
+    std::vector<Unsigned> alignments;
+    std::vector<Unsigned> permutation;
+};
+
+std::string ShardName( const std::string& prefix, Unsigned rank )
+{
+    std::ostringstream name;
+    name << prefix << "." << rank;
+    return name.str();
+}
+
+template<typename U>
+void WriteVector( std::ostream& os, const std::string& key, const std::vector<U>& v )
+{
+    os << key;
+    for( Unsigned i = 0; i < v.size(); i++ )
+        os << " " << v[i];
+    os << "\n";
+}
+
+template<typename U>
+std::vector<U> ReadVector( std::istream& is, const std::string& key )
+{
+    std::string line, word;
+    std::getline( is, line );
+    std::istringstream words( line );
+    words >> word;
+    if( word != key )
+        RuntimeError("Expected " + key + " in checkpoint metadata");
+    std::vector<U> v;
+    U value;
+    while( words >> value )
+        v.push_back( value );
+    return v;
+}
+
+// Rank 0 reads the metadata and shares it
+CheckpointInfo ReadInfo( const std::string& prefix, mpi::Comm comm )
+{
+    std::string text;
+    int opened = 1;
+    if( mpi::CommRank( comm ) == 0 )
+    {
+        std::ifstream file( (prefix + ".meta").c_str() );
+        opened = file.is_open() ? 1 : 0;
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        text = contents.str();
+    }
+    //Every rank raises the error, so none waits on the others
+    mpi::Broadcast( opened, 0, comm );
+    if( !opened )
+        RuntimeError("Could not open " + prefix + ".meta");
+    Unsigned length = text.size();
+    mpi::Broadcast( length, 0, comm );
+    text.resize( length );
+    if( length > 0 )
+        mpi::Broadcast( (byte*)&(text[0]), length, 0, comm );
+
+    std::istringstream meta( text );
+    std::string line;
+    std::getline( meta, line );
+    if( line != "rote-checkpoint 1" )
+        RuntimeError(prefix + ".meta is not a checkpoint");
+    CheckpointInfo info;
+    const std::vector<Unsigned> entrySize = ReadVector<Unsigned>( meta, "entry" );
+    info.entrySize = entrySize.empty() ? 0 : entrySize[0];
+    info.gridShape = ReadVector<Unsigned>( meta, "grid" );
+    info.shape = ReadVector<Unsigned>( meta, "shape" );
+    std::getline( meta, line );
+    if( line.compare( 0, 5, "dist " ) != 0 )
+        RuntimeError("Expected dist in checkpoint metadata");
+    info.dist = TensorDistribution( line.substr( 5 ) );
+    info.alignments = ReadVector<Unsigned>( meta, "alignments" );
+    info.permutation = ReadVector<Unsigned>( meta, "permutation" );
+    return info;
+}
+
+// The grid rank whose shard holds the entries of the process at gridLoc:
+// the copy at 0 along the grid modes dist binds to no tensor mode
+Unsigned ShardRank
+( const TensorDistribution& dist, Location gridLoc, const ObjShape& gridShape )
+{
+    const ModeDistribution used = dist.UsedModes();
+    for( Unsigned i = 0; i < gridLoc.size(); i++ )
+        if( !used.Contains(i) )
+            gridLoc[i] = 0;
+    return Loc2LinearLoc( gridLoc, gridShape );
+}
+
+// The local entries of A in storage order
+template<typename T>
+mpi::Datatype LocalType( const DistTensor<T>& A )
+{
+    const std::vector<Offset> strides = A.LocalStrides();
+    std::vector<Offset> strideBytes( strides.size() );
+    for( Unsigned i = 0; i < strides.size(); i++ )
+        strideBytes[i] = strides[i] * sizeof(T);
+    return StridedType( A.LocalShape(), strideBytes, mpi::TypeMap<T>() );
+}
+
+// Same grid shape and distribution: the shard is exactly A's local data
+template<typename T>
+void ReadShard( DistTensor<T>& A, const std::string& prefix )
+{
+    const rote::Grid& g = A.Grid();
+    int matches = 1;
+    if( A.Participating() )
+    {
+        const Unsigned rank = ShardRank( A.TensorDist(), g.Loc(), g.Shape() );
+        mpi::File fh;
+        mpi::FileOpen
+        ( mpi::COMM_SELF, ShardName( prefix, rank ), mpi::MODE_RDONLY,
+          mpi::INFO_NULL, fh );
+        const Offset entries = prod(A.LocalShape());
+        matches = mpi::FileSize( fh ) == Offset(entries * sizeof(T)) ? 1 : 0;
+        if( matches && entries != 0 )
+        {
+            mpi::Datatype type = LocalType( A );
+            mpi::FileReadAt( fh, 0, A.Buffer(), 1, type );
+            mpi::TypeFree( type );
+        }
+        mpi::FileClose( fh );
+    }
+    if( !mpi::AllReduce( matches, mpi::MIN, g.OwningComm() ) )
+        RuntimeError("The shards of " + prefix + " do not match the checkpoint");
+}
+
+// Another grid: pick the entries A owns out of every shard holding some.
+// Along each mode the indices A owns and those a shard holds are arithmetic
+// progressions, so their common indices are one too.
+template<typename T>
+void ReadResharded
+( DistTensor<T>& A, const CheckpointInfo& info, const std::string& prefix )
+{
+    A.ResizeTo( info.shape );
+    const Unsigned order = A.Order();
+    const Permutation toModes = A.LocalPermutation().InversePermutation();
+    const ObjShape localShape = toModes.applyTo(A.LocalShape());
+    if( !A.Participating() || prod(localShape) == 0 )
+        return;
+    const std::vector<Offset> localStrides = toModes.applyTo(A.LocalStrides());
+    const Permutation shardPerm( info.permutation );
+    const Offset entryBytes = sizeof(T);
+
+    const Unsigned numShards = prod(info.gridShape);
+    for( Unsigned q = 0; q < numShards; q++ )
+    {
+        const Location shardLoc = LinearLoc2Loc( q, info.gridShape );
+        if( ShardRank( info.dist, shardLoc, info.gridShape ) != q )
+            continue;
+
+        ObjShape shardShape( order ), counts( order );
+        std::vector<Unsigned> shardFirst( order ), shardStep( order );
+        std::vector<Unsigned> localFirst( order ), localStep( order );
+        bool overlaps = true;
+        for( Unsigned i = 0; i < order; i++ )
+        {
+            const ModeArray gridModes = info.dist[i].Entries();
+            const ObjShape modeGridShape = FilterVector( info.gridShape, gridModes );
+            const Unsigned wrap = gridModes.empty() ? 1 : prod(modeGridShape);
+            const Unsigned modeRank = gridModes.empty() ? 0 :
+                Loc2LinearLoc( FilterVector( shardLoc, gridModes ), modeGridShape );
+            const Unsigned shift = Shift( modeRank, info.alignments[i], wrap );
+            shardShape[i] = Length( info.shape[i], shift, wrap );
+
+            const Unsigned myShift = A.ModeShift(i);
+            const Unsigned myWrap = A.ModeStride(i);
+            const Unsigned period = LCM( wrap, myWrap );
+            Unsigned k = 0;
+            while( k < localShape[i] && k < period / myWrap &&
+                   ( myShift + k * myWrap < shift ||
+                     ( myShift + k * myWrap - shift ) % wrap != 0 ) )
+                k++;
+            const Unsigned first = myShift + k * myWrap;
+            if( k == localShape[i] || k == period / myWrap || first >= info.shape[i] )
+            {
+                overlaps = false;
+                break;
+            }
+            counts[i] = ( info.shape[i] - first - 1 ) / period + 1;
+            localFirst[i] = k;
+            localStep[i] = period / myWrap;
+            shardFirst[i] = ( first - shift ) / wrap;
+            shardStep[i] = period / wrap;
+        }
+        if( !overlaps )
+            continue;
+
+        const std::vector<Offset> shardStrides =
+            shardPerm.InversePermutation().applyTo(
+                Dimensions2Strides( shardPerm.applyTo(shardShape) ) );
+        Offset disp = 0, localOffset = 0;
+        std::vector<Offset> fileStrides( order ), memStrides( order );
+        for( Unsigned i = 0; i < order; i++ )
+        {
+            disp += shardFirst[i] * shardStrides[i] * entryBytes;
+            localOffset += localFirst[i] * localStrides[i];
+            fileStrides[i] = shardStep[i] * shardStrides[i] * entryBytes;
+            memStrides[i] = localStep[i] * localStrides[i] * entryBytes;
+        }
+        //File views need increasing offsets, so go in the shard's storage order
+        mpi::Datatype fileType =
+            StridedType
+            ( shardPerm.applyTo(counts), shardPerm.applyTo(fileStrides),
+              mpi::TypeMap<T>() );
+        mpi::Datatype memType =
+            StridedType
+            ( shardPerm.applyTo(counts), shardPerm.applyTo(memStrides),
+              mpi::TypeMap<T>() );
+        mpi::File fh;
+        mpi::FileOpen
+        ( mpi::COMM_SELF, ShardName( prefix, q ), mpi::MODE_RDONLY,
+          mpi::INFO_NULL, fh );
+        mpi::FileSetView( fh, disp, fileType );
+        mpi::FileReadAll( fh, A.Buffer() + localOffset, 1, memType );
+        mpi::FileClose( fh );
+        mpi::TypeFree( fileType );
+        mpi::TypeFree( memType );
+    }
+}
+
+} // anonymous namespace
+
+template<typename T>
+void Checkpoint( const DistTensor<T>& A, const std::string& prefix )
+{
+    const rote::Grid& g = A.Grid();
+    mpi::Comm comm = g.OwningComm();
+    int written = 1;
+    if( mpi::CommRank( comm ) == 0 )
+    {
+        std::ofstream meta( (prefix + ".meta").c_str() );
+        meta << "rote-checkpoint 1\n";
+        meta << "entry " << sizeof(T) << "\n";
+        WriteVector( meta, "grid", g.Shape() );
+        WriteVector( meta, "shape", A.Shape() );
+        meta << "dist " << TensorDistToString( A.TensorDist() ) << "\n";
+        WriteVector( meta, "alignments", A.Alignments() );
+        WriteVector( meta, "permutation", A.LocalPermutation().Entries() );
+        meta.close();
+        written = meta.good() ? 1 : 0;
+    }
+    mpi::Broadcast( written, 0, comm );
+    if( !written )
+        RuntimeError("Could not write " + prefix + ".meta");
+
+    const Unsigned rank = g.LinearRank();
+    if( A.Participating() &&
+        ShardRank( A.TensorDist(), g.Loc(), g.Shape() ) == rank )
+    {
+        mpi::File fh;
+        mpi::FileOpen
+        ( mpi::COMM_SELF, ShardName( prefix, rank ),
+          mpi::MODE_WRONLY | mpi::MODE_CREATE, mpi::INFO_NULL, fh );
+        const Offset entries = prod(A.LocalShape());
+        mpi::FileSetSize( fh, entries * sizeof(T) );
+        if( entries != 0 )
+        {
+            mpi::Datatype type = LocalType( A );
+            mpi::FileWriteAt( fh, 0, A.LockedBuffer(), 1, type );
+            mpi::TypeFree( type );
+        }
+        mpi::FileClose( fh );
+    }
+    mpi::Barrier( comm );
+}
+
+template<typename T>
+void Restart( DistTensor<T>& A, const std::string& prefix )
+{
+    const rote::Grid& g = A.Grid();
+    const CheckpointInfo info = ReadInfo( prefix, g.OwningComm() );
+    if( info.entrySize != sizeof(T) )
+        RuntimeError(prefix + " holds entries of another type");
+    if( info.shape.size() != A.Order() )
+        LogicError("Checkpoint does not match the tensor order");
+
+    if( info.gridShape == g.Shape() )
+    {
+        if( info.dist == A.TensorDist() )
+        {
+            A.Align( info.alignments );
+            A.SetLocalPermutation( Permutation( info.permutation ) );
+            A.ResizeTo( info.shape );
+            ReadShard( A, prefix );
+        }
+        else
+        {
+            DistTensor<T> tmp( info.shape, info.dist, info.alignments, g );
+            tmp.SetLocalPermutation( Permutation( info.permutation ) );
+            ReadShard( tmp, prefix );
+            A.ResizeTo( info.shape );
+            A.RedistFrom( tmp );
+        }
+        return;
+    }
+
+    if( info.dist.IsBlockCyclic() )
+        LogicError("Block-cyclic checkpoints can only be restarted on their own grid shape");
+    if( A.TensorDist().IsBlockCyclic() )
+    {
+        DistTensor<T> tmp( info.shape, A.TensorDist().ElementCyclic(), g );
+        ReadResharded( tmp, info, prefix );
+        A.ResizeTo( info.shape );
+        A.RedistFrom( tmp );
+        return;
+    }
+    ReadResharded( A, info, prefix );
+}
+
+#define FULL(T) \
+  template void Checkpoint( const DistTensor<T>& A, const std::string& prefix ); \
+  template void Restart( DistTensor<T>& A, const std::string& prefix );
+
+FULL(Int)
+#ifndef DISABLE_FLOAT
+FULL(float)
+#endif
+FULL(double)
+
+#ifndef DISABLE_COMPLEX
+#ifndef DISABLE_FLOAT
+FULL(std::complex<float>)
+#endif
+FULL(std::complex<double>)
+#endif
+
+} // namespace rote
@@ -0,0 +1,137 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "rote.hpp"
+
+namespace rote {
+
+mpi::Datatype StridedType
+( const std::vector<Unsigned>& counts, const std::vector<Offset>& strideBytes,
+  mpi::Datatype entry )
+{
+    mpi::Datatype type;
+    mpi::TypeCreateHvector( 1, 1, 0, entry, type );
+    for( Unsigned i = 0; i < counts.size(); i++ )
+    {
+        mpi::Datatype next;
+        mpi::TypeCreateHvector( counts[i], 1, strideBytes[i], type, next );
+        mpi::TypeFree( type );
+        type = next;
+    }
+    mpi::TypeCommit( type );
+    return type;
+}
+
+namespace {
+
+// The file and memory layouts of the entries this process transfers; with
+// oneCopy, only the copy on the processes at 0 along the replicated modes
+template<typename T>
+class FileView
+{
+public:
+    FileView( const DistTensor<T>& A, Offset disp, bool oneCopy )
+    : disp_(disp), count_(0), fileType_(mpi::BYTE), memType_(mpi::BYTE)
+    {
+#ifndef RELEASE
+        if( A.TensorDist().IsBlockCyclic() )
+            LogicError("File views need an element-cyclic distribution");
+#endif
+        const Unsigned order = A.Order();
+        const Permutation storageToModes = A.LocalPermutation().InversePermutation();
+        const ObjShape localShape = storageToModes.applyTo(A.LocalShape());
+        const std::vector<Offset> localStrides = storageToModes.applyTo(A.LocalStrides());
+
+        bool transfers = A.Participating() && prod(localShape) != 0;
+        if( oneCopy )
+        {
+            const TensorDistribution dist = A.TensorDist();
+            const ModeDistribution used = dist.UsedModes();
+            const ModeDistribution unused = dist.UnusedModes();
+            const Location gridLoc = A.Grid().Loc();
+            for( Unsigned i = 0; i < gridLoc.size(); i++ )
+                if( !used.Contains(i) && !unused.Contains(i) && gridLoc[i] != 0 )
+                    transfers = false;
+        }
+        if( !transfers )
+            return;
+
+        const Offset entryBytes = sizeof(T);
+        const std::vector<Offset> globalStrides = Dimensions2Strides(A.Shape());
+        std::vector<Offset> fileStrides(order), memStrides(order);
+        for( Unsigned i = 0; i < order; i++ )
+        {
+            disp_ += A.ModeShift(i) * globalStrides[i] * entryBytes;
+            fileStrides[i] = A.ModeStride(i) * globalStrides[i] * entryBytes;
+            memStrides[i] = localStrides[i] * entryBytes;
+        }
+        fileType_ = StridedType( localShape, fileStrides, mpi::TypeMap<T>() );
+        memType_ = StridedType( localShape, memStrides, mpi::TypeMap<T>() );
+        count_ = 1;
+    }
+
+    ~FileView()
+    {
+        if( count_ != 0 )
+        {
+            mpi::TypeFree( fileType_ );
+            mpi::TypeFree( memType_ );
+        }
+    }
+
+    void Set( mpi::File fh ) const
+    { mpi::FileSetView( fh, disp_, fileType_ ); }
+
+    int Count() const { return count_; }
+    mpi::Datatype MemType() const { return memType_; }
+
+private:
+    Offset disp_;
+    int count_;
+    mpi::Datatype fileType_;
+    mpi::Datatype memType_;
+};
+
+} // anonymous namespace
+
+template<typename T>
+void ReadFileView( DistTensor<T>& A, mpi::File fh, Offset disp )
+{
+    const FileView<T> view( A, disp, false );
+    view.Set( fh );
+    mpi::FileReadAll( fh, A.Buffer(), view.Count(), view.MemType() );
+    mpi::FileSetView( fh, 0, mpi::BYTE );
+}
+
+template<typename T>
+void WriteFileView( const DistTensor<T>& A, mpi::File fh, Offset disp )
+{
+    const FileView<T> view( A, disp, true );
+    view.Set( fh );
+    mpi::FileWriteAll( fh, A.LockedBuffer(), view.Count(), view.MemType() );
+    mpi::FileSetView( fh, 0, mpi::BYTE );
+}
+
+#define FULL(T) \
+  template void ReadFileView( DistTensor<T>& A, mpi::File fh, Offset disp ); \
+  template void WriteFileView( const DistTensor<T>& A, mpi::File fh, Offset disp );
+
+FULL(Int)
+#ifndef DISABLE_FLOAT
+FULL(float)
+#endif
+FULL(double)
+
+#ifndef DISABLE_COMPLEX
+#ifndef DISABLE_FLOAT
+FULL(std::complex<float>)
+#endif
+FULL(std::complex<double>)
+#endif
+
+} // namespace rote
@@ -157,11 +157,11 @@ PrintData
 template<typename T>
 void
 PrintArray
-( const T* dataBuf, const ObjShape& shape, const ObjShape strides, std::string title){
+( const T* dataBuf, const ObjShape& shape, const std::vector<Offset> strides, std::string title){
     std::ostream& os = std::cout;
     Unsigned order = shape.size();
     Location curLoc(order, 0);
-    Unsigned linLoc = 0;
+    Offset linLoc = 0;
     Unsigned ptr = 0;
 
     os << title << ":";
@@ -329,7 +329,7 @@ PrintRedistPlanInfo
   template void PrintData \
   ( const DistTensor<T>& A, std::string title, bool all); \
   template void PrintArray \
-  ( const T* dataBuf, const ObjShape& shape, const ObjShape strides, std::string title); \
+  ( const T* dataBuf, const ObjShape& shape, const std::vector<Offset> strides, std::string title); \
   template void PrintArray \
   ( const T* dataBuf, const ObjShape& shape, std::string title);
 
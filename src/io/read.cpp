@@ -8,6 +8,13 @@
 */
 #include "rote.hpp"
 
+#ifdef HAVE_SYS_MMAN_H
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
 namespace rote {
 
 template<typename T>
@@ -27,9 +34,46 @@ void Read( Tensor<T>& A, const std::string filename, FileFormat format )
     }
 }
 
+//Ranks in the communicator over the (sorted) grid modes the tensor modes
+//are bound to, which ReadSeq scatters over: the owner at grid view
+//location l has rank sum_i ownerRanks[i][l[i]]
+template<typename T>
+inline std::vector<std::vector<Unsigned> >
+ReadSeqOwnerRanks(const DistTensor<T>& A)
+{
+    const TensorDistribution dist = A.TensorDist();
+    const ObjShape gridShape = A.Grid().Shape();
+    ModeArray commModes = dist.UsedModes().Entries();
+    SortVector(commModes);
+    const std::vector<Offset> commStrides = Dimensions2Strides(FilterVector(gridShape, commModes));
+
+    const Unsigned order = A.Order();
+    std::vector<std::vector<Unsigned> > ownerRanks(order);
+    for(Unsigned i = 0; i < order; i++){
+        const ModeArray modes = dist[i].Entries();
+        const ObjShape modeShape = FilterVector(gridShape, modes);
+        ownerRanks[i].resize(modes.empty() ? 1 : prod(modeShape), 0);
+        for(Unsigned l = 0; l < ownerRanks[i].size() && !modes.empty(); l++){
+            const Location modeLoc = LinearLoc2Loc(l, modeShape);
+            for(Unsigned j = 0; j < modes.size(); j++)
+                ownerRanks[i][l] += modeLoc[j] * commStrides[IndexOf(commModes, modes[j])];
+        }
+    }
+    return ownerRanks;
+}
+
+inline Unsigned
+ReadSeqOwnerRank(const std::vector<std::vector<Unsigned> >& ownerRanks, const Location& ownerGVLoc)
+{
+    Unsigned rank = 0;
+    for(Unsigned i = 0; i < ownerGVLoc.size(); i++)
+        rank += ownerRanks[i][ownerGVLoc[i]];
+    return rank;
+}
+
 template<typename T>
 inline void
-ReadBinarySeqPack(const DistTensor<T>& A, const ObjShape& packShape, const ObjShape& commGridViewShape, const Unsigned& nElemsPerProc, const Location& fileLoc, const ObjShape& gblDataShape, std::ifstream& fileStream, T* sendBuf)
+ReadBinarySeqPack(const DistTensor<T>& A, const ObjShape& packShape, const ObjShape& commGridViewShape, const Unsigned& nElemsPerProc, const Location& fileLoc, const ObjShape& gblDataShape, const std::vector<std::vector<Unsigned> >& ownerRanks, std::ifstream& fileStream, T* sendBuf)
 {
     Unsigned order = packShape.size();
 
@@ -50,8 +94,7 @@ ReadBinarySeqPack(const DistTensor<T>& A, const ObjShape& packShape, const ObjSh
         T value;
         fileStream.read((char*)&value, sizeof(T));
         Location procGVLoc = A.DetermineOwner(gblDataLoc);
-
-        Unsigned whichProc = A.GetGridView().ToParticipatingLinearLoc(procGVLoc);
+        Unsigned whichProc = ReadSeqOwnerRank(ownerRanks, procGVLoc);
         sendBuf[whichProc*nElemsPerProc + nElemsPackedPerProc[whichProc]] = value;
 
 
@@ -101,7 +144,7 @@ ReadBinarySeqPack(const DistTensor<T>& A, const ObjShape& packShape, const ObjSh
 
 template<typename T>
 inline void
-ReadAsciiSeqPack(const DistTensor<T>& A, const ObjShape& packShape, const ObjShape& commGridViewShape, const Unsigned& nElemsPerProc, const Location& fileLoc, const ObjShape& gblDataShape, std::stringstream& dataStream, T* sendBuf)
+ReadAsciiSeqPack(const DistTensor<T>& A, const ObjShape& packShape, const ObjShape& commGridViewShape, const Unsigned& nElemsPerProc, const Location& fileLoc, const ObjShape& gblDataShape, const std::vector<std::vector<Unsigned> >& ownerRanks, AsciiReader<T>& reader, T* sendBuf)
 {
     Unsigned order = packShape.size();
 
@@ -119,10 +162,9 @@ ReadAsciiSeqPack(const DistTensor<T>& A, const ObjShape& packShape, const ObjSha
     bool done = !ElemwiseLessThan(gblDataLoc, gblDataShape);
 
     while(!done){
-        T value;
-        dataStream >> value;
+        const T value = reader.Next();
         Location procGVLoc = A.DetermineOwner(gblDataLoc);
-        Unsigned whichProc = A.GetGridView().ToParticipatingLinearLoc(procGVLoc);
+        Unsigned whichProc = ReadSeqOwnerRank(ownerRanks, procGVLoc);
         sendBuf[whichProc*nElemsPerProc + nElemsPackedPerProc[whichProc]] = value;
 
         //Update
@@ -167,78 +209,63 @@ ReadAsciiSeqPack(const DistTensor<T>& A, const ObjShape& packShape, const ObjSha
     }
 }
 
+//Copy the recvShape entries packed in recvBuf, mode 0 fastest, into A
+//starting from the global location firstGblLoc
 template<typename T>
 inline void
 ReadSeqUnpack(DistTensor<T>& A, const Location& firstGblLoc, const ObjShape& recvShape, const T* recvBuf){
-    //packetShape.size() always less than A.Order()
     Unsigned order = recvShape.size();
-    Location firstLocalLocUnpack = A.Global2LocalIndex(firstGblLoc);
-    //TODO:  Respect permutations...
-    T* dstBuf = A.Buffer(firstLocalLocUnpack);
-    ObjShape localShape = A.LocalShape();
-
-    Unsigned dstBufPtr = 0;
-    std::vector<Unsigned> dstBufStrides = A.LocalStrides();
-    Unsigned recvBufPtr = 0;
-    std::vector<Unsigned> recvBufStrides = Dimensions2Strides(recvShape);
+    const Permutation toModes = A.LocalPermutation().InversePermutation();
+    const std::vector<Offset> dstBufStrides = toModes.applyTo(A.LocalStrides());
+    const Location firstLocalLoc = A.Global2LocalIndex(firstGblLoc);
 
-    Unsigned localUnpackPtr = 0;
-    Unsigned recvPtr = 0;
-    Location localUnpackLoc = firstLocalLocUnpack;
-    Location recvLoc(recvShape.size(), 0);
-
-    bool done = !(ElemwiseLessThan(localUnpackLoc, localShape) && ElemwiseLessThan(recvLoc, recvShape));
-
-    //TODO: Detect "nice" strides and use MemCopy
-    //NOTE: This is basically a copy of PackCommHelper routine
-    //      but modified as the termination condition depends
-    //      on both the packShape and the local shape
+    T* dstBuf = A.Buffer();
+    Offset dstBufPtr = 0;
+    for(Unsigned i = 0; i < order; i++)
+        dstBufPtr += firstLocalLoc[i] * dstBufStrides[i];
 
-    while (!done) {
+    const Offset nElem = prod(recvShape);
+    Location recvLoc(order, 0);
+    for(Offset recvBufPtr = 0; recvBufPtr < nElem; recvBufPtr++){
         dstBuf[dstBufPtr] = recvBuf[recvBufPtr];
-//        PrintVector(localUnpackLoc, "localUnpackLoc");
-//        PrintVector(recvLoc, "recvLoc");
-        //Update
-        localUnpackLoc[localUnpackPtr]++;
-        recvLoc[recvPtr]++;
 
-        dstBufPtr += dstBufStrides[0];
-        recvBufPtr += recvBufStrides[0];
-
-        while (recvPtr < order && recvLoc[recvPtr] >= recvShape[recvPtr]) {
-            recvLoc[recvPtr] = 0;
-
-            recvBufPtr -= recvBufStrides[recvPtr] * recvShape[recvPtr];
-            recvPtr++;
-            if (recvPtr >= order) {
-                done = true;
-                break;
-            } else {
-                recvLoc[recvPtr]++;
-                recvBufPtr += recvBufStrides[recvPtr];
-            }
+        //Update
+        Unsigned ptr = 0;
+        recvLoc[ptr]++;
+        dstBufPtr += dstBufStrides[ptr];
+        while(ptr < order - 1 && recvLoc[ptr] >= recvShape[ptr]){
+            recvLoc[ptr] = 0;
+            dstBufPtr -= dstBufStrides[ptr] * recvShape[ptr];
+            ptr++;
+            recvLoc[ptr]++;
+            dstBufPtr += dstBufStrides[ptr];
         }
-        if (done)
-            break;
-        recvPtr = 0;
-
-        while (localUnpackPtr < order && localUnpackLoc[localUnpackPtr] >= localShape[localUnpackPtr]) {
-            localUnpackLoc[localUnpackPtr] = firstLocalLocUnpack[localUnpackPtr];
+    }
+}
 
-            dstBufPtr -= dstBufStrides[localUnpackPtr] * localShape[localUnpackPtr];
-            localUnpackPtr++;
-            if (localUnpackPtr >= order) {
-                done = true;
-                break;
-            } else {
-                localUnpackLoc[localUnpackPtr]++;
-                dstBufPtr += dstBufStrides[localUnpackPtr];
-            }
-        }
-        if (done)
-            break;
-        localUnpackPtr = 0;
+//Unpack my share of the packet of the given shape starting at dataLoc;
+//the packers hand every process its entries in file order
+template<typename T>
+inline void
+ReadSeqUnpackPacket(DistTensor<T>& A, const Location& dataLoc, const ObjShape& packetShape, const T* recvBuf)
+{
+    if(!A.Participating())
+        return;
+    const Unsigned order = dataLoc.size();
+    const ObjShape gvAShape = A.GetGridView().ParticipatingShape();
+    const Location myLoc = A.GetGridView().ParticipatingLoc();
+    const Location owner = A.DetermineOwner(dataLoc);
+
+    Location myFirstGblLoc(order);
+    ObjShape recvShape(order);
+    for(Unsigned i = 0; i < order; i++){
+        const Unsigned offset = (myLoc[i] + gvAShape[i] - owner[i]) % gvAShape[i];
+        if(offset >= packetShape[i])
+            return;
+        myFirstGblLoc[i] = dataLoc[i] + offset;
+        recvShape[i] = MaxLength(packetShape[i] - offset, gvAShape[i]);
     }
+    ReadSeqUnpack(A, myFirstGblLoc, recvShape, recvBuf);
 }
 
 template<typename T>
@@ -285,28 +312,24 @@ ReadSeq(DistTensor<T>& A, const std::string filename, FileFormat format)
     const rote::GridView& gvA = A.GetGridView();
 
     //Determine the max shape we can pack with available memory
-    //Figure out the first mode that a packet does not fully pack
+    //Packets cover whole modes up to the first partial one, a run of
+    //that mode, and single indices beyond, so each is a contiguous
+    //stretch of the file
     ObjShape packetShape(A.Shape());
     Unsigned firstPartialPackMode = order - 1;
 
-    //MAX_ELEM_PER_PROC must account for entire send buffer size
-    Unsigned remainder = MaxLength(MAX_ELEM_PER_PROC, prod(gvA.ParticipatingShape()));
+    //MAX_ELEM_PER_PROC must account for both stages of the send buffer
+    Unsigned remainder = MaxLength(MAX_ELEM_PER_PROC / 2, prod(gvA.ParticipatingShape()));
     Unsigned readStride = 1;
     for(i = 0; i < order; i++){
-        if(remainder < (A.Dimension(i) * readStride)){
+        if(remainder < A.Dimension(i) * readStride){
             packetShape[i] = Max(1, remainder / readStride);
+            for(Unsigned j = i + 1; j < order; j++)
+                packetShape[j] = 1;
+            firstPartialPackMode = i;
+            break;
         }
-
-        if(remainder == 0 && firstPartialPackMode == order - 1){
-            firstPartialPackMode = i - 1;
-        }
-
-        Unsigned testRemainder = remainder - packetShape[i] * readStride;
-        if(testRemainder > remainder)
-            remainder = 0;
-        else
-            remainder = testRemainder;
-        readStride *= packetShape[i];
+        readStride *= A.Dimension(i);
     }
 
 //    PrintVector(gvA.ParticipatingShape(), "gvA.ParticipatingShape()");
@@ -320,11 +343,6 @@ ReadSeq(DistTensor<T>& A, const std::string filename, FileFormat format)
     ObjShape sendShape = MaxLengths(packetShape, gvAShape);
 //    PrintVector(sendShape, "sendShape");
 
-    T* auxBuf = new T[prod(sendShape) * (nCommProcs + 1)];
-//    T* auxBuf = A.auxMemory_.Require(prod(sendShape) * (nCommProcs + 1));
-    T* sendBuf = &(auxBuf[prod(sendShape)]);
-    T* recvBuf = &(auxBuf[0]);
-
     //Set up the communicator information, including
     //the permutation from TensorDist proc order -> comm proc order
     ModeArray commModes = A.TensorDist().UsedModes().Entries();
@@ -332,54 +350,69 @@ ReadSeq(DistTensor<T>& A, const std::string filename, FileFormat format)
     SortVector(sortedCommModes);
     mpi::Comm comm = A.GetCommunicatorForModes(sortedCommModes, A.Grid());
 
+    //Two stages: root packs the next packet while the last is scattered
+    //and unpacked.  Each copy of a replicated tensor has its own root.
+    const Unsigned nElemsPerProc = prod(sendShape);
+    const bool isRoot = mpi::CommRank(comm) == 0;
+    Memory<T> auxMemory( IO_MEMORY );
+    T* auxBuf = auxMemory.Require(2 * nElemsPerProc * (isRoot ? nCommProcs + 1 : 1));
+    T* recvBufs[2] = { &(auxBuf[0]), &(auxBuf[nElemsPerProc]) };
+    T* sendBufs[2] = { 0, 0 };
+    if(isRoot){
+        sendBufs[0] = &(auxBuf[2 * nElemsPerProc]);
+        sendBufs[1] = &(auxBuf[(2 + nCommProcs) * nElemsPerProc]);
+    }
+#if HAVE_NONBLOCKING
+    mpi::Request requests[2];
+#endif
+
     //Perform the read
     Location dataLoc(order, 0);
     Unsigned ptr = firstPartialPackMode;
 
-    std::vector<Unsigned> sendBufStrides = Dimensions2Strides(dataShape);
-
-    //For the case that we're dealing with ASCII, read into a stringstream
-    std::stringstream dataStream;
-    std::string line;
-
-    if(format == ASCII || format == ASCII_MATLAB){
-        std::getline(file, line);
-        dataStream.str(line);
-    }
+    //ASCII entries are parsed a chunk at a time as the packets need them
+    AsciiReader<T> reader(file);
 
     bool done = !ElemwiseLessThan(dataLoc, dataShape);
 
-    Location myFirstGblElemLocUnpack;
-    Location firstLocalElemLocUnpack;
-    Location myPackGridViewLoc = gvA.ParticipatingLoc();
+    const std::vector<std::vector<Unsigned> > ownerRanks = ReadSeqOwnerRanks(A);
+    Location lastDataLoc;
+    ObjShape lastClippedShape;
+    bool havePacket = false;
+    Unsigned stage = 0;
 
     while(!done){
-        if(A.Grid().LinearRank() == 0){
-            MemZero(&(sendBuf[0]), prod(sendShape) * nCommProcs);
+        T* sendBuf = sendBufs[stage];
+        //The last packet along the partial mode may run off the end
+        ObjShape clippedShape = packetShape;
+        clippedShape[firstPartialPackMode] = Min(packetShape[firstPartialPackMode], dataShape[firstPartialPackMode] - dataLoc[firstPartialPackMode]);
+        if(isRoot){
+            MemZero(&(sendBuf[0]), nElemsPerProc * nCommProcs);
             if(format == ASCII || format == ASCII_MATLAB){
-                ReadAsciiSeqPack(A, packetShape, gvAShape, prod(sendShape), dataLoc, dataShape, dataStream, &(sendBuf[0]));
+                ReadAsciiSeqPack(A, clippedShape, gvAShape, nElemsPerProc, dataLoc, dataShape, ownerRanks, reader, &(sendBuf[0]));
             }else{
-                ReadBinarySeqPack(A, packetShape, gvAShape, prod(sendShape), dataLoc, dataShape, file, &(sendBuf[0]));
+                ReadBinarySeqPack(A, clippedShape, gvAShape, nElemsPerProc, dataLoc, dataShape, ownerRanks, file, &(sendBuf[0]));
             }
-            ObjShape commShape = sendShape;
-            commShape.insert(commShape.end(), nCommProcs);
         }
 
         //Communicate the data
-        mpi::Scatter(sendBuf, prod(sendShape), recvBuf, prod(sendShape), 0, comm);
-
-        //Unpack it
-        Location packLastLoc = dataLoc;
-        for(i = 0; i < firstPartialPackMode + 1; i++)
-            packLastLoc[i] += packetShape[i] - 1;
-
-        //Determine the first element I own
-        Location owner = A.DetermineOwner(dataLoc);
-        myFirstGblElemLocUnpack = ElemwiseSum(dataLoc, ElemwiseSubtract(myPackGridViewLoc, owner));
+#if HAVE_NONBLOCKING
+        mpi::IScatter(sendBuf, nElemsPerProc, recvBufs[stage], nElemsPerProc, 0, comm, requests[stage]);
+#else
+        mpi::Scatter(sendBuf, nElemsPerProc, recvBufs[stage], nElemsPerProc, 0, comm);
+#endif
 
-        if(ElemwiseLessThan(myFirstGblElemLocUnpack, dataShape) && ElemwiseLessThanEqualTo(dataLoc, myFirstGblElemLocUnpack) && !AnyElemwiseGreaterThan(myFirstGblElemLocUnpack, packLastLoc)){
-            ReadSeqUnpack(A, myFirstGblElemLocUnpack, sendShape, recvBuf);
+        //Unpack the previous packet while this one is in flight
+        if(havePacket){
+#if HAVE_NONBLOCKING
+            mpi::Wait(requests[1 - stage]);
+#endif
+            ReadSeqUnpackPacket(A, lastDataLoc, lastClippedShape, recvBufs[1 - stage]);
         }
+        lastDataLoc = dataLoc;
+        lastClippedShape = clippedShape;
+        havePacket = true;
+        stage = 1 - stage;
 
         //Update
         dataLoc[ptr] += packetShape[ptr];
@@ -399,9 +432,88 @@ ReadSeq(DistTensor<T>& A, const std::string filename, FileFormat format)
             break;
         ptr = firstPartialPackMode;
     }
-    delete [] auxBuf;
-//    A.auxMemory_.Release();
 
+    if(havePacket){
+#if HAVE_NONBLOCKING
+        mpi::Wait(requests[1 - stage]);
+#endif
+        ReadSeqUnpackPacket(A, lastDataLoc, lastClippedShape, recvBufs[1 - stage]);
+    }
+}
+
+//Entries SetMany places at a time, bounding the location lists
+#define ASCII_SET_BATCH (1 << 20)
+
+//Start of the first entry at or after pos in the data line
+inline Offset
+AsciiEntryStart(std::ifstream& file, Offset pos, Offset dataStart, Offset fileEnd){
+    if(pos <= dataStart)
+        return dataStart;
+    if(pos >= fileEnd)
+        return fileEnd;
+    file.clear();
+    file.seekg(pos - 1);
+    char c;
+    while(file.get(c) && !std::isspace(static_cast<unsigned char>(c)))
+        pos++;
+    return std::min(pos, fileEnd);
+}
+
+//Every process parses its own byte range of the data line, cut at entry
+//boundaries, and the entries are sent to their owners with SetMany
+template<typename T>
+void
+ReadAsciiNonSeq(DistTensor<T>& A, std::ifstream& file){
+    mpi::Comm comm = A.Grid().OwningComm();
+    const Unsigned commRank = mpi::CommRank(comm);
+    const Unsigned commSize = mpi::CommSize(comm);
+    const Offset dataStart = file.tellg();
+    file.seekg(0, std::ios::end);
+    const Offset fileEnd = file.tellg();
+    const Offset length = fileEnd - dataStart;
+    const Offset begin = AsciiEntryStart(file, dataStart + length * commRank / commSize, dataStart, fileEnd);
+    const Offset end = AsciiEntryStart(file, dataStart + length * (commRank + 1) / commSize, dataStart, fileEnd);
+
+    std::vector<T> values;
+    file.clear();
+    file.seekg(begin);
+    AsciiReader<T> reader(file, end - begin);
+    reader.ReadAll(values);
+
+    //Ranges past the end of the data line hold no entries
+    const Unsigned lineEndRank = mpi::AllReduce(reader.SawNewline() ? commRank : commSize, mpi::MIN, comm);
+    if(commRank > lineEndRank)
+        values.clear();
+
+    std::vector<unsigned long> counts(commSize, 0), allCounts(commSize);
+    counts[commRank] = values.size();
+    mpi::AllReduce(&(counts[0]), &(allCounts[0]), commSize, mpi::SUM, comm);
+    Offset first = 0, total = 0;
+    for(Unsigned p = 0; p < commSize; p++){
+        if(p < commRank)
+            first += allCounts[p];
+        total += allCounts[p];
+    }
+    const ObjShape shape = A.Shape();
+    //Order-0 tensors hold a single entry
+    const Offset numEntries = shape.empty() ? 1 : prod(shape);
+    if(total < numEntries)
+        RuntimeError("Too few entries in ASCII tensor file");
+
+    const Offset myCount = first >= numEntries ? 0 : std::min(static_cast<Offset>(values.size()), numEntries - first);
+    const Offset maxCount = mpi::AllReduce(static_cast<unsigned long>(myCount), mpi::MAX, comm);
+    std::vector<Location> locs;
+    std::vector<T> batch;
+    for(Offset start = 0; start < maxCount; start += ASCII_SET_BATCH){
+        const Offset stop = std::min(myCount, start + ASCII_SET_BATCH);
+        locs.clear();
+        batch.clear();
+        for(Offset k = start; k < stop; k++){
+            locs.push_back(LinearLoc2Loc(first + k, shape));
+            batch.push_back(values[k]);
+        }
+        A.SetMany(locs, batch);
+    }
 }
 
 template<typename T>
@@ -428,6 +540,8 @@ ReadNonSeq(DistTensor<T>& A, const std::string filename, FileFormat format){
         Unsigned value;
         while( dataShapeStream >> value ) dataShape.push_back(value);
         A.ResizeTo(dataShape);
+        ReadAsciiNonSeq(A, file);
+        return;
     }else if(format == BINARY){
         //Ignore tensor order?
         Unsigned i;
@@ -440,7 +554,6 @@ ReadNonSeq(DistTensor<T>& A, const std::string filename, FileFormat format){
             file.read( (char*)&(dataShape[i]), sizeof(Unsigned));
         A.ResizeTo(dataShape);
     }
-    Unsigned i;
     Unsigned order = A.Order();
     const rote::GridView& gvA = A.GetGridView();
 
@@ -452,39 +565,27 @@ ReadNonSeq(DistTensor<T>& A, const std::string filename, FileFormat format){
     std::vector<Unsigned> loopIters = MaxLengths(loopSpace, gvAShape);
 
     Unsigned startLinLoc = Loc2LinearLoc(myLoc, shapeA);
-    std::vector<Unsigned> srcBufStrides = Dimensions2Strides(A.Shape());
-    std::vector<Unsigned> dstBufStrides = A.LocalStrides();
+    std::vector<Offset> srcBufStrides = Dimensions2Strides(A.Shape());
+    std::vector<Offset> dstBufStrides = A.LocalStrides();
     T* dstBuf = A.Buffer();
 
-    std::string line;
-    std::stringstream dataStream;
-    if(format == ASCII_MATLAB || format == ASCII){
-        std::getline(file, line);
-        dataStream.str(line);
-        T value;
-        for(i = 0; i < startLinLoc; i++)
-            dataStream >> value;
-    }else if(format == BINARY){
+    if(format == BINARY){
         file.seekg( ((1 + order) * sizeof(Unsigned)) + (startLinLoc * sizeof(T)));
     }else if(format == BINARY_FLAT){
         file.seekg( startLinLoc * sizeof(T));
     }
     Unsigned ptr = 0;
-    Unsigned dstBufPtr = 0;
+    Offset dstBufPtr = 0;
 
     Location curLoc = myLoc;
-    Unsigned srcBufPtr = startLinLoc;
-    Unsigned newSrcBufPtr = 0;
+    Offset srcBufPtr = startLinLoc;
+    Offset newSrcBufPtr = 0;
 
     bool done = !ElemwiseLessThan(curLoc, A.Shape());
 
     while(!done){
         T value;
-        if(format == ASCII_MATLAB || format == ASCII){
-            dataStream >> value;
-        }else{
-            file.read((char*)&value, sizeof(T));
-        }
+        file.read((char*)&value, sizeof(T));
 
         dstBuf[dstBufPtr] = value;
 
@@ -510,13 +611,7 @@ ReadNonSeq(DistTensor<T>& A, const std::string filename, FileFormat format){
         if (done)
             break;
         ptr = 0;
-        //Adjust streams (we read in 1 value, so adjust by -1 )
-        Unsigned adjustAmount = newSrcBufPtr - srcBufPtr - 1;
-        if(format == ASCII_MATLAB || format == ASCII){
-            T val;
-            for(i = 0; i < adjustAmount; i++)
-                dataStream >> val;
-        }else if(format == BINARY){
+        if(format == BINARY){
             file.seekg(((1 + order) * sizeof(Unsigned)) + (newSrcBufPtr * sizeof(T)));
         }else if(format == BINARY_FLAT){
             file.seekg((newSrcBufPtr * sizeof(T)));
@@ -526,6 +621,140 @@ ReadNonSeq(DistTensor<T>& A, const std::string filename, FileFormat format){
 
 }
 
+//Every process reads its own entries through a file view with MPI-IO
+template<typename T>
+void
+ReadMPIIO(DistTensor<T>& A, const std::string filename, FileFormat format){
+    mpi::Comm comm = A.Grid().OwningComm();
+    mpi::File fh;
+    mpi::FileOpen(comm, filename, mpi::MODE_RDONLY, mpi::INFO_NULL, fh);
+
+    Offset disp = 0;
+    if(format == BINARY){
+        //Root reads the header and shares the shape
+        Unsigned order = 0;
+        if(mpi::CommRank(comm) == 0)
+            mpi::FileReadAt(fh, 0, &order, sizeof(Unsigned), mpi::BYTE);
+        mpi::Broadcast(order, 0, comm);
+        ObjShape dataShape(order);
+        if(mpi::CommRank(comm) == 0 && order > 0)
+            mpi::FileReadAt(fh, sizeof(Unsigned), &(dataShape[0]), order * sizeof(Unsigned), mpi::BYTE);
+        if(order > 0)
+            mpi::Broadcast(&(dataShape[0]), order, 0, comm);
+        A.ResizeTo(dataShape);
+        disp = (1 + order) * sizeof(Unsigned);
+    }
+
+    ReadFileView(A, fh, disp);
+    mpi::FileClose(fh);
+}
+
+template<typename T>
+void ReadMapped( DistTensor<T>& A, const std::string filename, FileFormat format )
+{
+    if( format == AUTO )
+        format = DetectFormat( filename );
+    if( format != BINARY && format != BINARY_FLAT )
+        LogicError("ReadMapped only supports BINARY and BINARY_FLAT files");
+#ifdef HAVE_SYS_MMAN_H
+    const int fd = open( filename.c_str(), O_RDONLY );
+    if( fd < 0 )
+        RuntimeError("Could not open " + filename);
+    struct stat info;
+    if( fstat( fd, &info ) != 0 ){
+        close( fd );
+        RuntimeError("Could not stat " + filename);
+    }
+    const std::size_t fileBytes = info.st_size;
+    void* mapping = 0;
+    if( fileBytes > 0 )
+        mapping = mmap( 0, fileBytes, PROT_READ, MAP_SHARED, fd, 0 );
+    close( fd );
+    if( mapping == MAP_FAILED )
+        RuntimeError("Could not map " + filename);
+    const char* data = static_cast<const char*>(mapping);
+
+    //Every process takes the shape from the header itself
+    Offset dataBytes = 0;
+    if( format == BINARY ){
+        Unsigned order = 0;
+        if( fileBytes >= sizeof(Unsigned) )
+            MemCopy( &order, reinterpret_cast<const Unsigned*>(data), 1 );
+        dataBytes = (1 + order) * sizeof(Unsigned);
+        if( fileBytes < dataBytes ){
+            munmap( mapping, fileBytes );
+            RuntimeError(filename + " is too short for its header");
+        }
+        ObjShape dataShape(order);
+        if( order > 0 )
+            MemCopy( &(dataShape[0]), reinterpret_cast<const Unsigned*>(data) + 1, order );
+        A.ResizeTo(dataShape);
+    }
+    //Order-0 tensors hold a single entry
+    const Offset numEntries = A.Order() == 0 ? 1 : prod(A.Shape());
+    if( fileBytes < dataBytes + numEntries * sizeof(T) ){
+        munmap( mapping, fileBytes );
+        RuntimeError(filename + " is too short for the tensor");
+    }
+
+    if( A.Participating() && A.Order() == 0 ){
+        A.Buffer()[0] = *reinterpret_cast<const T*>(data + dataBytes);
+    }else if( A.Participating() && prod(A.LocalShape()) != 0 ){
+        //File offsets of the local indices of each mode, in storage order
+        const Unsigned order = A.Order();
+        const TensorDistribution dist = A.TensorDist();
+        ModeArray modes(order);
+        for( Unsigned i = 0; i < order; i++ )
+            modes[i] = i;
+        const ModeArray storedModes = A.LocalPermutation().applyTo(modes);
+        const ObjShape localShape = A.LocalShape();
+        const std::vector<Offset> fileStrides = Dimensions2Strides(A.Shape());
+        std::vector<std::vector<Offset> > modeOffsets(order);
+        for( Unsigned k = 0; k < order; k++ ){
+            const Mode i = storedModes[k];
+            modeOffsets[k].resize(localShape[k]);
+            for( Unsigned l = 0; l < localShape[k]; l++ )
+                modeOffsets[k][l] = BlockLocal2Global(l, A.ModeShift(i), A.ModeStride(i), dist[i].BlockSize()) * fileStrides[i];
+        }
+        const std::vector<Offset> localStrides = A.LocalStrides();
+
+        //Gather along the innermost stored mode, stepping the rest
+        const T* src = reinterpret_cast<const T*>(data + dataBytes);
+        T* dst = A.Buffer();
+        const std::vector<Offset>& innerOffsets = modeOffsets[0];
+        const Unsigned innerDim = localShape[0];
+        Location loc(order, 0);
+        Offset srcBase = 0, dstBase = 0;
+        for( Unsigned i = 1; i < order; i++ )
+            srcBase += modeOffsets[i][0];
+        while( true ){
+            for( Unsigned l = 0; l < innerDim; l++ )
+                dst[dstBase + l * localStrides[0]] = src[srcBase + innerOffsets[l]];
+
+            Unsigned ptr = 1;
+            for( ; ptr < order; ptr++ ){
+                srcBase -= modeOffsets[ptr][loc[ptr]];
+                dstBase -= loc[ptr] * localStrides[ptr];
+                if( ++loc[ptr] < localShape[ptr] ){
+                    srcBase += modeOffsets[ptr][loc[ptr]];
+                    dstBase += loc[ptr] * localStrides[ptr];
+                    break;
+                }
+                loc[ptr] = 0;
+                srcBase += modeOffsets[ptr][0];
+            }
+            if( ptr >= order )
+                break;
+        }
+    }
+    if( mapping != 0 )
+        munmap( mapping, fileBytes );
+#else
+    NOT_USED(A);
+    LogicError("ReadMapped requires mmap");
+#endif
+}
+
 template<typename T>
 void Read
 ( DistTensor<T>& A, const std::string filename, FileFormat format,
@@ -534,8 +763,22 @@ void Read
     if( format == AUTO )
         format = DetectFormat( filename );
 
+    //The readers place entries element-cyclically
+    if( A.TensorDist().IsBlockCyclic() )
+    {
+        DistTensor<T> tmp( A.Shape(), A.TensorDist().ElementCyclic(), A.Grid() );
+        Read( tmp, filename, format, sequential );
+        A.RedistFrom( tmp );
+        return;
+    }
+
+    //Binary files are read collectively whichever way was asked for
+    if(format == BINARY || format == BINARY_FLAT)
+    {
+        ReadMPIIO( A, filename, format );
+    }
     //Everyone accesses data
-    if(!sequential)
+    else if(!sequential)
     {
         ReadNonSeq(A, filename, format);
     }
@@ -552,7 +795,9 @@ void Read
   ( Tensor<T>& A, const std::string filename, FileFormat format ); \
   template void Read \
   ( DistTensor<T>& A, const std::string filename, \
-    FileFormat format, bool sequential );
+    FileFormat format, bool sequential ); \
+  template void ReadMapped \
+  ( DistTensor<T>& A, const std::string filename, FileFormat format );
 
 FULL(Int)
 #ifndef DISABLE_FLOAT
@@ -32,11 +32,70 @@ namespace rote {
 	        Write( A.LockedTensor(), title, filename );
 	}
 
+	template<typename T>
+	void
+	Write
+	( const DistTensor<T>& A, const std::string filename, FileFormat format,
+	  Unsigned numAggregators )
+	{
+	    if( format == AUTO )
+	        format = DetectFormat( filename );
+	    if( format != BINARY && format != BINARY_FLAT )
+	        LogicError("Unsupported distributed write format");
+
+	    //File views describe element-cyclic pieces
+	    if( A.TensorDist().IsBlockCyclic() )
+	    {
+	        DistTensor<T> tmp( A.Shape(), A.TensorDist().ElementCyclic(), A.Grid() );
+	        tmp.RedistFrom( A );
+	        Write( tmp, filename, format, numAggregators );
+	        return;
+	    }
+
+	    mpi::Comm comm = A.Grid().OwningComm();
+	    mpi::Info info = mpi::INFO_NULL;
+	    if( numAggregators > 0 )
+	    {
+	        std::ostringstream aggregators;
+	        aggregators << numAggregators;
+	        mpi::InfoCreate( info );
+	        mpi::InfoSet( info, "cb_nodes", aggregators.str() );
+	    }
+	    mpi::File fh;
+	    mpi::FileOpen
+	    ( comm, filename, mpi::MODE_WRONLY | mpi::MODE_CREATE, info, fh );
+	    if( info != mpi::INFO_NULL )
+	        mpi::InfoFree( info );
+
+	    const ObjShape shape = A.Shape();
+	    const Unsigned order = shape.size();
+	    Offset disp = 0;
+	    if( format == BINARY )
+	    {
+	        disp = (1 + order) * sizeof(Unsigned);
+	        if( mpi::CommRank( comm ) == 0 )
+	        {
+	            std::vector<Unsigned> header( 1, order );
+	            header.insert( header.end(), shape.begin(), shape.end() );
+	            mpi::FileWriteAt( fh, 0, &(header[0]), disp, mpi::BYTE );
+	        }
+	    }
+	    //Drop whatever an older, larger file held past the new end
+	    mpi::FileSetSize( fh, disp + prod(shape) * sizeof(T) );
+
+	    WriteFileView( A, fh, disp );
+	    mpi::FileClose( fh );
+	}
+
 #define FULL(T) \
   template void \
 		Write \
 		( const DistTensor<T>& A, std::string title="", \
 		  std::string filename="DistTensor" ); \
+	template void \
+		Write \
+		( const DistTensor<T>& A, const std::string filename, \
+		  FileFormat format, Unsigned numAggregators ); \
 	template void \
 		Write \
 		( const Tensor<T>& A, std::string title="", \
@@ -16,6 +16,12 @@ T prod(const std::vector<T>& src, const Unsigned startIndex){
   return std::accumulate(src.begin() + startIndex, src.end(), T(1), std::multiplies<T>());
 }
 
+Offset prod(const ObjShape& shape, const Unsigned startIndex){
+  if (shape.size() == 0)
+    return 0;
+  return std::accumulate(shape.begin() + startIndex, shape.end(), Offset(1), std::multiplies<Offset>());
+}
+
 template<typename T>
 std::vector<T> ElemwiseSum(const std::vector<T>& src1, const std::vector<T>& src2){
     std::vector<T> ret(src1.size());
@@ -278,7 +284,6 @@ void SortVector(std::vector<T>& vec1) {
 //Non-template functions
 #define PROTO(T) \
 	template T sum(const std::vector<T>& src); \
-	template T prod(const std::vector<T>& src, const Unsigned startIndex); \
 	template std::vector<T> ElemwiseSum(const std::vector<T>& src1, const std::vector<T>& src2); \
 	template std::vector<T> ElemwiseSubtract(const std::vector<T>& src1, const std::vector<T>& src2); \
 	template std::vector<T> ElemwiseProd(const std::vector<T>& src1, const std::vector<T>& src2); \
@@ -310,6 +315,15 @@ PROTO(Int)
 PROTO(float)
 PROTO(double)
 PROTO(char)
+PROTO(Offset)
+
+#define PROTOPROD(T) \
+	template T prod(const std::vector<T>& src, const Unsigned startIndex);
+PROTOPROD(Int)
+PROTOPROD(float)
+PROTOPROD(double)
+PROTOPROD(char)
+PROTOPROD(Offset)
 
 #define PROTOMOD(T) \
   template std::vector<T> ElemwiseMod(const std::vector<T>& src1, const std::vector<T>& src2);
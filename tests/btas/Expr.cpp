@@ -0,0 +1,183 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+#include "rote.hpp"
+using namespace rote;
+
+void Usage(){
+    std::cout << "./Expr <gridOrder> <gridDim0> <gridDim1> ... <tenOrder> <tenDim0> <tenDim1> ... \"<tensorDist>\"\n";
+    std::cout << "<gridOrder>  : order of the grid ( >0 )\n";
+    std::cout << "<gridDimK>   : dimension of mode-K of grid\n";
+    std::cout << "<tenOrder>   : order of the tensor ( >0 )\n";
+    std::cout << "<tenDimK>    : dimension of mode-K of the tensor\n";
+}
+
+typedef struct Arguments{
+  Unsigned nProcs;
+  ObjShape gridShape;
+  ObjShape tensorShape;
+  TensorDistribution tensorDist;
+} Params;
+
+void ProcessShape(Unsigned argc, char** const argv, Unsigned& argCount, ObjShape& shape){
+    if(argCount + 1 >= argc){
+        Usage();
+        throw ArgException();
+    }
+    const Unsigned order = atoi(argv[++argCount]);
+    if(order == 0 || argCount + order >= argc){
+        Usage();
+        throw ArgException();
+    }
+    shape.resize(order);
+    for(Unsigned i = 0; i < order; i++){
+        const int dim = atoi(argv[++argCount]);
+        if(dim <= 0){
+            std::cerr << "Dimensions must be greater than 0\n";
+            Usage();
+            throw ArgException();
+        }
+        shape[i] = dim;
+    }
+}
+
+void ProcessInput(Unsigned argc,  char** const argv, Params& args){
+    Unsigned argCount = 0;
+    ProcessShape(argc, argv, argCount, args.gridShape);
+    args.nProcs = rote::prod(args.gridShape);
+    ProcessShape(argc, argv, argCount, args.tensorShape);
+
+    if(argCount + 1 >= argc){
+        std::cerr << "Missing tensor distribution argument\n";
+        Usage();
+        throw ArgException();
+    }
+    args.tensorDist = rote::StringToTensorDist(argv[++argCount]);
+    if(args.tensorDist.size() != args.tensorShape.size() + 1){
+        std::cerr << "Tensor distribution must be of same order as tensor\n";
+        Usage();
+        throw ArgException();
+    }
+}
+
+// Whether Z(loc) == f(loc) everywhere, to within tol
+template<typename T, typename F>
+bool
+CheckExpr(const DistTensor<T>& Z, const F& f, double tol)
+{
+    const ObjShape shape = Z.Shape();
+    bool ok = true;
+    for(Unsigned k = 0; k < prod(shape); k++){
+        const Location loc = LinearLoc2Loc(k, shape);
+        if(Abs(Z.Get(loc) - f(loc)) > tol)
+            ok = false;
+    }
+    return ok;
+}
+
+template<typename T>
+bool
+TestExpr(const DistTensor<T>& A)
+{
+    const Unsigned order = A.Order();
+    const Grid& g = A.Grid();
+    const double tol = 1e-10;
+    bool ok = true;
+
+    DistTensor<T> B(A.Shape(), A.TensorDist(), g);
+    MakeUniform(B);
+
+    //Same distribution as the operands: no redistribution
+    DistTensor<T> Y(A.Shape(), A.TensorDist(), g);
+    Y = T(2)*A + B*A - B;
+    ok = CheckExpr(Y, [&](const Location& l){ return T(2)*A.Get(l) + B.Get(l)*A.Get(l) - B.Get(l); }, tol) && ok;
+
+    //Z replicated along the last distributed mode: A and B are redistributed
+    //once each although A appears three times
+    TensorDistribution distZ = A.TensorDist();
+    for(Unsigned i = order; i > 0; i--){
+        if(distZ[i - 1].size() != 0){
+            distZ[i - 1] = ModeDistribution();
+            break;
+        }
+    }
+    DistTensor<T> Z(A.Shape(), distZ, g);
+    Z = A*A + T(3)*B - A;
+    ok = CheckExpr(Z, [&](const Location& l){ return A.Get(l)*A.Get(l) + T(3)*B.Get(l) - A.Get(l); }, tol) && ok;
+
+    //Permuted operands, each used twice under the same permutation, with
+    //W distributed so that no redistribution is needed
+    std::vector<Unsigned> entries = Permutation(order).Entries();
+    do{
+        const Permutation perm(entries);
+        const Permutation inv = perm.InversePermutation();
+        TensorDistribution distW = A.TensorDist();
+        for(Unsigned i = 0; i < order; i++)
+            distW[i] = A.TensorDist()[perm[i]];
+        DistTensor<T> W(perm.applyTo(A.Shape()), distW, g);
+        W = Permuted(A, perm) - T(3)*Permuted(A, perm);
+        ok = CheckExpr(W, [&](const Location& l){ return T(-2)*A.Get(inv.applyTo(l)); }, tol) && ok;
+    } while(std::next_permutation(entries.begin(), entries.end()));
+
+    return ok;
+}
+
+//Order-0 tensors hold a single entry
+template<typename T>
+bool
+TestScalarExpr()
+{
+    Tensor<T> A((ObjShape())), B((ObjShape())), Z((ObjShape()));
+    A.Set(Location(), T(3.5));
+    B.Set(Location(), T(2));
+    Z.Set(Location(), T(-1));
+    Z = T(2)*A - B;
+    return Z.Get(Location()) == T(5);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+    const Int commSize = mpi::CommSize( comm );
+    bool test = true;
+    try
+    {
+        Params args;
+
+        ProcessInput(argc, argv, args);
+
+        if(args.nProcs != ((Unsigned)commSize)){
+            if(commRank == 0)
+                std::cerr << "program not started with correct number of processes\n";
+            Usage();
+            throw ArgException();
+        }
+
+        const Grid g( comm, args.gridShape );
+
+        DistTensor<double> A(args.tensorShape, args.tensorDist, g);
+        MakeUniform(A);
+        test &= TestExpr(A);
+        test &= TestScalarExpr<double>();
+
+        Unsigned rL = test ? 1 : 0;
+        Unsigned rG;
+        mpi::AllReduce(&rL, &rG, 1, mpi::LOGICAL_AND, comm);
+        test = rG == 1;
+    }
+    catch( std::exception& e ) { test = false; ReportException(e); }
+
+    if( commRank == 0 )
+        std::cout << "Expr: " << (test ? "SUCCESS" : "FAILURE") << std::endl;
+    Finalize();
+    return 0;
+}
@@ -12,7 +12,7 @@ using namespace std;
 void Usage() {
     std::cout << "./DistTensor <gridOrder> <gridDim0> <gridDim1> ... <n_o> <n_v> <block_size> <testIter> \n";
     std::cout << "<gridOrder>  : order of computing grid (number dimensions)";
-    std::cout << "<gridDimK>   : dimension of mode-K of grid\n";
+    std::cout << "<gridDimK>   : dimension of mode-K of grid (all 0 to choose one for the process count)\n";
     std::cout << "<n_o>        : number occupied orbitals\n";
     std::cout << "<n_v>        : number virtual orbitals\n";
     std::cout << "<block_size> : computing block size\n";
@@ -48,14 +48,20 @@ void ProcessInput(int argc, char** const argv, Params& args) {
     args.nProcs = 1;
     for (Unsigned i = 0; i < gridOrder; i++) {
         int gridDim = atoi(argv[++argCount]);
-        if (gridDim <= 0) {
-            std::cerr << "Grid dim must be greater than 0\n";
+        if (gridDim < 0) {
+            std::cerr << "Grid dim must not be negative\n";
             Usage();
             throw ArgException();
         }
         args.nProcs *= gridDim;
         args.gridShape[i] = gridDim;
     }
+    const Unsigned nZero = std::count(args.gridShape.begin(), args.gridShape.end(), 0);
+    if (nZero != 0 && nZero != gridOrder) {
+        std::cerr << "Grid dims must be all 0 or all positive\n";
+        Usage();
+        throw ArgException();
+    }
 
     args.n_o = atoi(argv[++argCount]);
     args.n_v = atoi(argv[++argCount]);
@@ -479,6 +485,28 @@ InitCheckTensor("ccsd_terms/term_Z_iter", testIter, check_Z);
     }
 }
 
+// Grid shape for the dominant CCSD terms: the vvvv ladder and the voov ring
+ObjShape SuggestGridShape(Unsigned nProcs, Unsigned gridOrder, Unsigned n_o, Unsigned n_v) {
+    const TensorDistribution dist4("[(0),(1),(2),(3)]");
+    ObjShape vvoo = {n_v, n_v, n_o, n_o};
+    ObjShape voov = {n_v, n_o, n_o, n_v};
+    ObjShape vvvv = {n_v, n_v, n_v, n_v};
+    IndexArray abij = {'a', 'b', 'i', 'j'};
+    IndexArray abef = {'a', 'b', 'e', 'f'};
+    IndexArray efij = {'e', 'f', 'i', 'j'};
+    IndexArray akic = {'a', 'k', 'i', 'c'};
+    IndexArray cbkj = {'c', 'b', 'k', 'j'};
+
+    GridWorkload workload(gridOrder);
+    workload.AddTensor(vvvv, dist4);
+    workload.AddTensor(voov, dist4);
+    for (Unsigned i = 0; i < 4; i++)
+        workload.AddTensor(vvoo, dist4);
+    workload.AddContraction(vvvv, dist4, abef, vvoo, dist4, efij, vvoo, dist4, abij);
+    workload.AddContraction(voov, dist4, akic, vvoo, dist4, cbkj, vvoo, dist4, abij);
+    return Grid::Suggest(nProcs, workload)[0].shape;
+}
+
 int main(int argc, char* argv[]) {
     Initialize(argc, argv);
     mpi::Comm comm = mpi::COMM_WORLD;
@@ -489,6 +517,17 @@ int main(int argc, char* argv[]) {
 
         ProcessInput(argc, argv, args);
 
+        if (args.nProcs == 0) {
+            args.gridShape = SuggestGridShape(commSize, args.gridShape.size(), args.n_o, args.n_v);
+            args.nProcs = commSize;
+            if (commRank == 0) {
+                std::cout << "Using grid";
+                for (Unsigned i = 0; i < args.gridShape.size(); i++)
+                    std::cout << " " << args.gridShape[i];
+                std::cout << std::endl;
+            }
+        }
+
         if (commRank == 0 && commSize != args.nProcs) {
             std::cerr
                     << "program not started with correct number of processes\n";
@@ -0,0 +1,224 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+#include "rote.hpp"
+using namespace rote;
+
+void Usage(){
+    std::cout << "./Bulk <gridOrder> <gridDim0> <gridDim1> ... <tenOrder> <tenDim0> <tenDim1> ... \"<tensorDist>\"\n";
+    std::cout << "<gridOrder>  : order of the grid ( >0 )\n";
+    std::cout << "<gridDimK>   : dimension of mode-K of grid\n";
+    std::cout << "<tenOrder>   : order of the tensor ( >0 )\n";
+    std::cout << "<tenDimK>    : dimension of mode-K of the tensor\n";
+}
+
+typedef struct Arguments{
+  Unsigned nProcs;
+  ObjShape gridShape;
+  ObjShape tensorShape;
+  TensorDistribution tensorDist;
+} Params;
+
+void ProcessShape(Unsigned argc, char** const argv, Unsigned& argCount, ObjShape& shape){
+    if(argCount + 1 >= argc){
+        Usage();
+        throw ArgException();
+    }
+    const Unsigned order = atoi(argv[++argCount]);
+    if(order == 0 || argCount + order >= argc){
+        Usage();
+        throw ArgException();
+    }
+    shape.resize(order);
+    for(Unsigned i = 0; i < order; i++){
+        const int dim = atoi(argv[++argCount]);
+        if(dim <= 0){
+            std::cerr << "Dimensions must be greater than 0\n";
+            Usage();
+            throw ArgException();
+        }
+        shape[i] = dim;
+    }
+}
+
+void ProcessInput(Unsigned argc,  char** const argv, Params& args){
+    Unsigned argCount = 0;
+    ProcessShape(argc, argv, argCount, args.gridShape);
+    args.nProcs = rote::prod(args.gridShape);
+    ProcessShape(argc, argv, argCount, args.tensorShape);
+
+    if(argCount + 1 >= argc){
+        std::cerr << "Missing tensor distribution argument\n";
+        Usage();
+        throw ArgException();
+    }
+    args.tensorDist = rote::StringToTensorDist(argv[++argCount]);
+    if(args.tensorDist.size() != args.tensorShape.size() + 1){
+        std::cerr << "Tensor distribution must be of same order as tensor\n";
+        Usage();
+        throw ArgException();
+    }
+}
+
+//Same distribution with every distributed mode wrapped in blocks of blkSize
+TensorDistribution BlockCyclic(const TensorDistribution& dist, Unsigned blkSize){
+    TensorDistribution ret(dist);
+    for(Unsigned i = 0; i < ret.size() - 1; i++)
+        if(ret[i].size() > 0)
+            ret[i].SetBlockSize(blkSize);
+    return ret;
+}
+
+//An aligned and a locally permuted tensor of the given shape
+template<typename T>
+void
+MakeTestTensor(Unsigned c, const ObjShape& shape, DistTensor<T>& A){
+    const Unsigned order = shape.size();
+    const Grid& g = A.Grid();
+    const TensorDistribution dist = A.TensorDist();
+    if(c == 0){
+        std::vector<Unsigned> align(order, 0);
+        for(Unsigned i = 0; i < order; i++)
+            if(prod(FilterVector(g.Shape(), dist[i].Entries())) > 1)
+                align[i] = 1;
+        A.Align(align);
+    }else{
+        std::vector<Unsigned> perm(order);
+        for(Unsigned i = 0; i < order; i++)
+            perm[i] = order - 1 - i;
+        A.SetLocalPermutation(Permutation(perm));
+    }
+    A.ResizeTo(shape);
+}
+
+//Each process asks for a different subset, rank 0 for none, with repeats
+std::vector<Location>
+MyLocations(const ObjShape& shape, Int commRank, Int commSize){
+    std::vector<Location> locs;
+    if(commRank == 0)
+        return locs;
+    for(Unsigned i = commRank; i < prod(shape); i += commSize - 1)
+        locs.push_back(LinearLoc2Loc(i, shape));
+    for(Unsigned i = 0; i < prod(shape); i += 3)
+        locs.push_back(LinearLoc2Loc(i, shape));
+    return locs;
+}
+
+template<typename T>
+T
+EntryValue(const Location& loc, const ObjShape& shape){
+    return T(1 + Loc2LinearLoc(loc, shape));
+}
+
+//Bulk results must match the per-entry Get, Set and Update
+template<typename T>
+bool
+BulkTest(const ObjShape& shape, const TensorDistribution& dist, const Grid& g){
+    mpi::Comm comm = g.OwningComm();
+    const Int commRank = mpi::CommRank(comm);
+    const Int commSize = mpi::CommSize(comm);
+    const Unsigned numEntries = prod(shape);
+    const std::vector<Location> locs = MyLocations(shape, commRank, commSize);
+    bool ok = true;
+
+    for(Unsigned c = 0; c < 2; c++){
+        DistTensor<T> A(dist, g);
+        MakeTestTensor(c, shape, A);
+        MakeUniform(A);
+
+        //Get is collective, so everyone reads every entry
+        std::vector<T> entries(numEntries);
+        for(Unsigned i = 0; i < numEntries; i++)
+            entries[i] = A.Get(LinearLoc2Loc(i, shape));
+        const std::vector<T> got = A.GetMany(locs);
+        ok = ok && got.size() == locs.size();
+        for(Unsigned i = 0; i < got.size(); i++)
+            if(got[i] != entries[Loc2LinearLoc(locs[i], shape)])
+                ok = false;
+
+        //Every copy is set: GetMany reads the copy nearest each process
+        DistTensor<T> B(dist, g), ref(dist, g);
+        MakeTestTensor(c, shape, B);
+        MakeTestTensor(c, shape, ref);
+        Zero(B);
+        Zero(ref);
+        std::vector<T> values(locs.size());
+        for(Unsigned i = 0; i < locs.size(); i++)
+            values[i] = EntryValue<T>(locs[i], shape);
+        B.SetMany(locs, values);
+        for(Unsigned i = 0; i < numEntries; i++){
+            const Location loc = LinearLoc2Loc(i, shape);
+            ref.Set(loc, EntryValue<T>(loc, shape));
+        }
+        std::vector<Location> all(numEntries);
+        for(Unsigned i = 0; i < numEntries; i++)
+            all[i] = LinearLoc2Loc(i, shape);
+        const std::vector<T> setB = B.GetMany(all), setRef = ref.GetMany(all);
+        for(Unsigned i = 0; i < numEntries; i++)
+            if(setB[i] != setRef[i])
+                ok = false;
+
+        //UpdateMany sums the contributions of every process
+        DistTensor<T> C(A), refC(A);
+        C.UpdateMany(locs, values);
+        std::vector<Unsigned> counts(numEntries, 0), allCounts(numEntries);
+        for(Unsigned i = 0; i < locs.size(); i++)
+            counts[Loc2LinearLoc(locs[i], shape)]++;
+        mpi::AllReduce(&(counts[0]), &(allCounts[0]), numEntries, mpi::SUM, comm);
+        for(Unsigned i = 0; i < numEntries; i++){
+            const Location loc = LinearLoc2Loc(i, shape);
+            refC.Update(loc, T(allCounts[i]) * EntryValue<T>(loc, shape));
+        }
+        const std::vector<T> upC = C.GetMany(all), upRef = refC.GetMany(all);
+        for(Unsigned i = 0; i < numEntries; i++)
+            if(upC[i] != upRef[i])
+                ok = false;
+    }
+    return ok;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+    const Int commSize = mpi::CommSize( comm );
+    bool test = true;
+    try
+    {
+        Params args;
+
+        ProcessInput(argc, argv, args);
+
+        if(args.nProcs != ((Unsigned)commSize) || commSize < 2){
+            if(commRank == 0)
+                std::cerr << "program not started with correct number of processes\n";
+            Usage();
+            throw ArgException();
+        }
+
+        const Grid g( comm, args.gridShape );
+
+        test &= BulkTest<double>(args.tensorShape, args.tensorDist, g);
+        test &= BulkTest<std::complex<double> >(args.tensorShape, args.tensorDist, g);
+        test &= BulkTest<double>(args.tensorShape, BlockCyclic(args.tensorDist, 2), g);
+
+        Unsigned rL = test ? 1 : 0;
+        Unsigned rG;
+        mpi::AllReduce(&rL, &rG, 1, mpi::LOGICAL_AND, comm);
+        test = rG == 1;
+    }
+    catch( std::exception& e ) { test = false; ReportException(e); }
+
+    if( commRank == 0 )
+        std::cout << "Bulk: " << (test ? "SUCCESS" : "FAILURE") << std::endl;
+    Finalize();
+    return 0;
+}
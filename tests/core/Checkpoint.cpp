@@ -0,0 +1,175 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+#include "rote.hpp"
+using namespace rote;
+
+void Usage(){
+    std::cout << "./Checkpoint <prefix>\n";
+    std::cout << "<prefix> : path prefix of the checkpoint files written\n";
+}
+
+template<typename T>
+bool
+SameEntries(const DistTensor<T>& A, const DistTensor<T>& B){
+    const ObjShape shape = A.Shape();
+    if(B.Shape() != shape)
+        return false;
+    bool ok = true;
+    for(Unsigned i = 0; i < prod(shape); i++){
+        const Location loc = LinearLoc2Loc(i, shape);
+        if(A.Get(loc) != B.Get(loc))
+            ok = false;
+    }
+    return ok;
+}
+
+//Whether f throws on every process
+template<typename F>
+bool
+ThrowsEverywhere(const F& f){
+    Unsigned rL = 0;
+    try { f(); }
+    catch( std::exception& e ) { rL = 1; }
+    Unsigned rG;
+    mpi::AllReduce(&rL, &rG, 1, mpi::LOGICAL_AND, mpi::COMM_WORLD);
+    return rG == 1;
+}
+
+void
+WriteText(const std::string& name, const std::string& text){
+    if(mpi::CommRank(mpi::COMM_WORLD) == 0){
+        std::ofstream file(name.c_str());
+        file << text;
+    }
+    mpi::Barrier(mpi::COMM_WORLD);
+}
+
+void
+RemoveCheckpoint(const std::string& prefix){
+    if(mpi::CommRank(mpi::COMM_WORLD) == 0){
+        std::remove((prefix + ".meta").c_str());
+        for(Int q = 0; q < mpi::CommSize(mpi::COMM_WORLD); q++){
+            std::ostringstream shard;
+            shard << prefix << "." << q;
+            std::remove(shard.str().c_str());
+        }
+    }
+    mpi::Barrier(mpi::COMM_WORLD);
+}
+
+//Restarts on the same grid with the same and another distribution, and on
+//another grid shape
+bool
+RoundTripTest(const std::string& prefix, const Grid& g, const Grid& other){
+    const ObjShape shape = {5, 7};
+    DistTensor<double> A(shape, TensorDistribution("[(0),(1)]"), g);
+    A.Align(std::vector<Unsigned>(2, 1));
+    A.SetLocalPermutation(Permutation({1, 0}));
+    A.ResizeTo(shape);
+    MakeUniform(A);
+    Checkpoint(A, prefix);
+
+    DistTensor<double> B(TensorDistribution("[(0),(1)]"), g);
+    Restart(B, prefix);
+    bool ok = B.Alignments() == A.Alignments() && B.LocalPermutation().Entries() == A.LocalPermutation().Entries();
+    ok = SameEntries(A, B) && ok;
+
+    DistTensor<double> C(TensorDistribution("[(0),()]"), g);
+    Restart(C, prefix);
+    ok = SameEntries(A, C) && ok;
+
+    DistTensor<double> D(TensorDistribution("[(0),(1)]"), other);
+    Restart(D, prefix);
+    ok = SameEntries(A, D) && ok;
+
+    RemoveCheckpoint(prefix);
+    return ok;
+}
+
+//Bad files raise an error on every process instead of leaving some waiting
+bool
+ErrorTest(const std::string& prefix, const Grid& g){
+    const std::string other = prefix + "-other";
+    DistTensor<double> A(ObjShape({5, 7}), TensorDistribution("[(0),(1)]"), g);
+    MakeUniform(A);
+    DistTensor<double> B(TensorDistribution("[(0),(1)]"), g);
+    bool ok = true;
+
+    ok = ThrowsEverywhere([&](){ Restart(B, prefix + "-missing"); }) && ok;
+    ok = ThrowsEverywhere([&](){ Checkpoint(A, "/nonexistent-dir/" + prefix); }) && ok;
+
+    WriteText(prefix + ".meta", "not a checkpoint\n");
+    ok = ThrowsEverywhere([&](){ Restart(B, prefix); }) && ok;
+    WriteText(prefix + ".meta", "rote-checkpoint 1\nentry 8\ngrid 2 2\nshape 5 7\n");
+    ok = ThrowsEverywhere([&](){ Restart(B, prefix); }) && ok;
+
+    //Metadata of a larger tensor over the shards of A
+    Checkpoint(A, prefix);
+    DistTensor<double> E(ObjShape({9, 9}), TensorDistribution("[(0),(1)]"), g);
+    Checkpoint(E, other);
+    std::string meta;
+    if(mpi::CommRank(mpi::COMM_WORLD) == 0){
+        std::ifstream file((other + ".meta").c_str());
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        meta = contents.str();
+    }
+    WriteText(prefix + ".meta", meta);
+    ok = ThrowsEverywhere([&](){ Restart(B, prefix); }) && ok;
+    DistTensor<double> F(TensorDistribution("[(1),(0)]"), g);
+    ok = ThrowsEverywhere([&](){ Restart(F, prefix); }) && ok;
+
+    DistTensor<float> G(TensorDistribution("[(0),(1)]"), g);
+    ok = ThrowsEverywhere([&](){ Restart(G, other); }) && ok;
+
+    RemoveCheckpoint(prefix);
+    RemoveCheckpoint(other);
+    return ok;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+    const Int commSize = mpi::CommSize( comm );
+    bool test = true;
+    try
+    {
+        if(argc < 2){
+            Usage();
+            throw ArgException();
+        }
+        const std::string prefix = argv[1];
+        if(commSize != 4){
+            if(commRank == 0)
+                std::cerr << "program not started with 4 processes\n";
+            throw ArgException();
+        }
+
+        const Grid g( comm, ObjShape({2, 2}) );
+        const Grid other( comm, ObjShape({4, 1}) );
+
+        test &= RoundTripTest(prefix, g, other);
+        test &= ErrorTest(prefix, g);
+
+        Unsigned rL = test ? 1 : 0;
+        Unsigned rG;
+        mpi::AllReduce(&rL, &rG, 1, mpi::LOGICAL_AND, comm);
+        test = rG == 1;
+    }
+    catch( std::exception& e ) { test = false; ReportException(e); }
+
+    if( commRank == 0 )
+        std::cout << "Checkpoint: " << (test ? "SUCCESS" : "FAILURE") << std::endl;
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,217 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+#include "rote.hpp"
+using namespace rote;
+
+void Usage(){
+    std::cout << "./Copy <gridOrder> <gridDim0> <gridDim1> ... <tenOrder> <tenDim0> <tenDim1> ... \"<tensorDist>\"\n";
+    std::cout << "<gridOrder>  : order of the grid ( >0 )\n";
+    std::cout << "<gridDimK>   : dimension of mode-K of grid\n";
+    std::cout << "<tenOrder>   : order of the tensor ( >0 )\n";
+    std::cout << "<tenDimK>    : dimension of mode-K of the tensor\n";
+}
+
+typedef struct Arguments{
+  Unsigned nProcs;
+  ObjShape gridShape;
+  ObjShape tensorShape;
+  TensorDistribution tensorDist;
+} Params;
+
+void ProcessShape(Unsigned argc, char** const argv, Unsigned& argCount, ObjShape& shape){
+    if(argCount + 1 >= argc){
+        Usage();
+        throw ArgException();
+    }
+    const Unsigned order = atoi(argv[++argCount]);
+    if(order == 0 || argCount + order >= argc){
+        Usage();
+        throw ArgException();
+    }
+    shape.resize(order);
+    for(Unsigned i = 0; i < order; i++){
+        const int dim = atoi(argv[++argCount]);
+        if(dim <= 0){
+            std::cerr << "Dimensions must be greater than 0\n";
+            Usage();
+            throw ArgException();
+        }
+        shape[i] = dim;
+    }
+}
+
+void ProcessInput(Unsigned argc,  char** const argv, Params& args){
+    Unsigned argCount = 0;
+    ProcessShape(argc, argv, argCount, args.gridShape);
+    args.nProcs = rote::prod(args.gridShape);
+    ProcessShape(argc, argv, argCount, args.tensorShape);
+
+    if(argCount + 1 >= argc){
+        std::cerr << "Missing tensor distribution argument\n";
+        Usage();
+        throw ArgException();
+    }
+    args.tensorDist = rote::StringToTensorDist(argv[++argCount]);
+    if(args.tensorDist.size() != args.tensorShape.size() + 1){
+        std::cerr << "Tensor distribution must be of same order as tensor\n";
+        Usage();
+        throw ArgException();
+    }
+}
+
+template<typename T>
+bool
+SameEntries(const DistTensor<T>& A, const DistTensor<T>& B){
+    const ObjShape shape = A.Shape();
+    if(B.Shape() != shape)
+        return false;
+    bool ok = true;
+    for(Unsigned i = 0; i < prod(shape); i++){
+        const Location loc = LinearLoc2Loc(i, shape);
+        if(A.Get(loc) != B.Get(loc))
+            ok = false;
+    }
+    return ok;
+}
+
+//An aligned and a locally permuted tensor, filled with random entries
+template<typename T>
+void
+MakeTestTensor(Unsigned c, const ObjShape& shape, DistTensor<T>& A){
+    const Unsigned order = shape.size();
+    const Grid& g = A.Grid();
+    const TensorDistribution dist = A.TensorDist();
+    if(c == 0){
+        std::vector<Unsigned> align(order, 0);
+        for(Unsigned i = 0; i < order; i++)
+            if(prod(FilterVector(g.Shape(), dist[i].Entries())) > 1)
+                align[i] = 1;
+        A.Align(align);
+    }else{
+        std::vector<Unsigned> perm(order);
+        for(Unsigned i = 0; i < order; i++)
+            perm[i] = order - 1 - i;
+        A.SetLocalPermutation(Permutation(perm));
+    }
+    A.ResizeTo(shape);
+    MakeUniform(A);
+}
+
+//Copies must keep alignments, local permutation and entries
+template<typename T>
+bool
+CopyTest(const ObjShape& shape, const TensorDistribution& dist, const Grid& g){
+    bool ok = true;
+    for(Unsigned c = 0; c < 2; c++){
+        DistTensor<T> A(dist, g);
+        MakeTestTensor(c, shape, A);
+
+        DistTensor<T> B(A);
+        ok = ok && B.Alignments() == A.Alignments() && B.LocalPermutation().Entries() == A.LocalPermutation().Entries();
+        ok = SameEntries(A, B) && ok;
+
+        //Assignment only copies between equally aligned tensors
+        DistTensor<T> C(dist, g);
+        C.Align(A.Alignments());
+        C = A;
+        ok = ok && C.Alignments() == A.Alignments() && C.LocalPermutation().Entries() == A.LocalPermutation().Entries();
+        ok = SameEntries(A, C) && ok;
+    }
+    return ok;
+}
+
+//Moves hand the local buffer over instead of copying it
+template<typename T>
+bool
+MoveTest(const ObjShape& shape, const TensorDistribution& dist, const Grid& g){
+    bool ok = true;
+    for(Unsigned c = 0; c < 2; c++){
+        DistTensor<T> A(dist, g);
+        MakeTestTensor(c, shape, A);
+        const DistTensor<T> ref(A);
+        const T* buffer = A.LockedBuffer();
+
+        DistTensor<T> B(std::move(A));
+        ok = ok && B.LockedBuffer() == buffer;
+        ok = ok && B.Alignments() == ref.Alignments() && B.LocalPermutation().Entries() == ref.LocalPermutation().Entries();
+        ok = SameEntries(ref, B) && ok;
+
+        //The target takes the source's distribution as well
+        DistTensor<T> C(shape, TensorDistribution(shape.size()), g);
+        C = std::move(B);
+        ok = ok && C.LockedBuffer() == buffer && C.TensorDist() == dist;
+        ok = SameEntries(ref, C) && ok;
+    }
+    return ok;
+}
+
+//A moved view of a local tensor still views the same buffer
+template<typename T>
+bool
+TensorMoveTest(const ObjShape& shape){
+    Tensor<T> A(shape);
+    MakeUniform(A);
+    const Tensor<T> ref(A);
+    const T* buffer = A.LockedBuffer();
+
+    Tensor<T> B(std::move(A));
+    bool ok = B.LockedBuffer() == buffer;
+
+    Tensor<T> V;
+    View(V, B);
+    Tensor<T> W(std::move(V));
+    ok = ok && W.LockedBuffer() == buffer;
+    for(Unsigned i = 0; i < prod(shape); i++){
+        const Location loc = LinearLoc2Loc(i, shape);
+        if(W.Get(loc) != ref.Get(loc))
+            ok = false;
+    }
+    return ok;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+    const Int commSize = mpi::CommSize( comm );
+    bool test = true;
+    try
+    {
+        Params args;
+
+        ProcessInput(argc, argv, args);
+
+        if(args.nProcs != ((Unsigned)commSize)){
+            if(commRank == 0)
+                std::cerr << "program not started with correct number of processes\n";
+            Usage();
+            throw ArgException();
+        }
+
+        const Grid g( comm, args.gridShape );
+
+        test &= CopyTest<double>(args.tensorShape, args.tensorDist, g);
+        test &= MoveTest<double>(args.tensorShape, args.tensorDist, g);
+        test &= TensorMoveTest<double>(args.tensorShape);
+
+        Unsigned rL = test ? 1 : 0;
+        Unsigned rG;
+        mpi::AllReduce(&rL, &rG, 1, mpi::LOGICAL_AND, comm);
+        test = rG == 1;
+    }
+    catch( std::exception& e ) { test = false; ReportException(e); }
+
+    if( commRank == 0 )
+        std::cout << "Copy: " << (test ? "SUCCESS" : "FAILURE") << std::endl;
+    Finalize();
+    return 0;
+}
@@ -229,7 +229,17 @@ void ProcessInput(Unsigned argc,  char** const argv, Params& args){
     args.n_dim = atoi(argv[++argCount]);
 }
 
-void RunTest(const Grid& g, const Params& args){
+//Same distribution with every distributed mode wrapped in blocks of blkSize
+TensorDistribution BlockCyclic(const TensorDistribution& dist, Unsigned blkSize){
+	TensorDistribution ret(dist);
+	for(Unsigned i = 0; i < ret.size() - 1; i++)
+		if(ret[i].size() > 0)
+			ret[i].SetBlockSize(blkSize);
+	return ret;
+}
+
+//Returns the norm of the error on process 0
+double RunTest(const Grid& g, const Params& args){
 	Unsigned i;
 	mpi::Comm comm = mpi::COMM_WORLD;
 	const Int commRank = mpi::CommRank( comm );
@@ -315,7 +325,18 @@ void RunTest(const Grid& g, const Params& args){
 		Diff(finalC.Tensor(), checkC, diff);
 		norm = Norm(diff);
 		std::cout << "Norm: " << norm << std::endl;
+		return norm;
 	}
+	return 0;
+}
+
+//Repeats the contraction with block-cyclic operands
+bool BlockCyclicTest(const Grid& g, const Params& args){
+	Params blkArgs = args;
+	blkArgs.distA = BlockCyclic(args.distA, 2);
+	blkArgs.distB = BlockCyclic(args.distB, 2);
+	blkArgs.distC = BlockCyclic(args.distC, 2);
+	return RunTest(g, blkArgs) < 1e-6;
 }
 
 int
@@ -328,7 +349,12 @@ main( int argc, char* argv[] )
     try
     {
     	const Grid g(comm, args.gShape);
-      RunTest(g, args);
+      const bool elemTest = RunTest(g, args) < 1e-6;
+      if(mpi::CommRank(comm) == 0)
+        std::cout << "Contract: " << (elemTest ? "SUCCESS" : "FAILURE") << std::endl;
+      const bool test = BlockCyclicTest(g, args);
+      if(mpi::CommRank(comm) == 0)
+        std::cout << "BlockCyclic: " << (test ? "SUCCESS" : "FAILURE") << std::endl;
     }
     catch( std::exception& e ) { ReportException(e); }
 
@@ -0,0 +1,131 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+#include "rote.hpp"
+using namespace rote;
+
+void Usage(){
+    std::cout << "./GridSuggest <numProcs>\n";
+    std::cout << "<numProcs> : process count to suggest grids for ( >1 )\n";
+}
+
+//Every ordered factorisation appears once, best first
+bool TestCandidates(Unsigned numProcs){
+    GridWorkload workload(3);
+    workload.AddTensor(ObjShape(3, 8), TensorDistribution("[(0),(1),(2)]"));
+    const std::vector<GridCandidate> candidates = Grid::Suggest(numProcs, workload);
+
+    Unsigned expected = 0;
+    for(Unsigned d0 = 1; d0 <= numProcs; d0++)
+        for(Unsigned d1 = 1; d1 <= numProcs; d1++)
+            if(numProcs % (d0 * d1) == 0)
+                expected++;
+    bool ok = candidates.size() == expected;
+    for(Unsigned i = 0; i < candidates.size(); i++){
+        ok = ok && candidates[i].shape.size() == 3 && prod(candidates[i].shape) == numProcs;
+        for(Unsigned j = 0; j < i; j++)
+            ok = ok && candidates[j].shape != candidates[i].shape;
+        if(i > 0)
+            ok = ok && candidates[i-1].time <= candidates[i].time;
+    }
+    return ok;
+}
+
+//A redistribution along grid mode 0 only costs nothing when that mode is 1
+bool TestRedist(Unsigned numProcs){
+    GridWorkload workload(2);
+    workload.AddRedist(ObjShape(2, 64), TensorDistribution("[(0),()]"), TensorDistribution("[(),()]"));
+    const std::vector<GridCandidate> candidates = Grid::Suggest(numProcs, workload);
+    const GridCandidate& best = candidates[0];
+    return best.shape[0] == 1 && best.time == 0 && candidates.back().time > 0;
+}
+
+//The larger operand stays put, as in Contract::run
+bool TestStationary(){
+    const TensorDistribution distA("[(0),(1)]"), distB("[(1),()]"), distC("[(0),()]");
+    const IndexArray ab = {'a', 'b'}, bc = {'b', 'c'}, ac = {'a', 'c'};
+    const ObjShape big = {32, 32}, tall = {32, 4}, small = {4, 4};
+    bool ok = true;
+
+    //A is the largest: B is moved to match A
+    GridWorkload statA(2);
+    statA.AddContraction(big, distA, ab, tall, distB, bc, tall, distC, ac);
+    const GridWorkload::Contraction& cA = statA.Contractions()[0];
+    ok = ok && cA.shapeA == big && cA.distA == distA;
+    ok = ok && cA.redistB.shape == tall && cA.redistB.from == distB;
+    ok = ok && cA.redistB.to[0] == distA[1];
+    ok = ok && cA.shapeBC == ObjShape(1, 4);
+
+    //B is the largest: A is moved to match B
+    GridWorkload statB(2);
+    statB.AddContraction(small, distA, ab, big, distB, bc, tall, distC, ac);
+    const GridWorkload::Contraction& cB = statB.Contractions()[0];
+    ok = ok && cB.shapeA == big && cB.distA == distB;
+    ok = ok && cB.redistB.shape == small && cB.redistB.from == distA;
+    ok = ok && cB.redistB.to[1] == distB[0];
+
+    //Both are modeled with communication and flops
+    ok = ok && Grid::Suggest(4, statA)[0].time > 0 && Grid::Suggest(4, statB)[0].time > 0;
+    return ok;
+}
+
+//Candidates within the memory limit rank first
+bool TestMemoryLimit(Unsigned numProcs){
+    GridWorkload workload(2);
+    workload.AddTensor(ObjShape(2, 60), TensorDistribution("[(0),()]"));
+    workload.AddRedist(ObjShape(2, 60), TensorDistribution("[(0),()]"), TensorDistribution("[(),(1)]"));
+    GridCostModel model;
+    std::vector<GridCandidate> candidates = Grid::Suggest(numProcs, workload, model);
+    double minMemory = candidates[0].memory;
+    for(Unsigned i = 1; i < candidates.size(); i++)
+        minMemory = std::min(minMemory, candidates[i].memory);
+
+    model.memoryLimit = minMemory;
+    candidates = Grid::Suggest(numProcs, workload, model);
+    bool ok = candidates[0].memory <= minMemory;
+    bool fits = true;
+    for(Unsigned i = 0; i < candidates.size(); i++){
+        const bool f = candidates[i].memory <= minMemory;
+        ok = ok && (fits || !f);
+        fits = f;
+    }
+    return ok;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+    bool test = true;
+    try
+    {
+        if(argc < 2){
+            Usage();
+            throw ArgException();
+        }
+        const Unsigned numProcs = atoi(argv[1]);
+        if(numProcs < 2){
+            Usage();
+            throw ArgException();
+        }
+
+        test &= TestCandidates(numProcs);
+        test &= TestRedist(numProcs);
+        test &= TestStationary();
+        test &= TestMemoryLimit(numProcs);
+    }
+    catch( std::exception& e ) { test = false; ReportException(e); }
+
+    if( commRank == 0 )
+        std::cout << "GridSuggest: " << (test ? "SUCCESS" : "FAILURE") << std::endl;
+    Finalize();
+    return 0;
+}
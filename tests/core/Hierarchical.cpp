@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "rote.hpp" instead
+#include "rote.hpp"
+using namespace rote;
+
+void Usage(){
+    std::cout << "./Hierarchical <nodeSize> <count>\n";
+    std::cout << "<nodeSize> : processes treated as one node ( >1, must divide the number of processes )\n";
+    std::cout << "<count>    : entries each process sends to each other one\n";
+}
+
+template<typename T>
+bool Equal(const std::vector<T>& a, const std::vector<T>& b){
+    bool test = a == b;
+    Unsigned rL = test ? 1 : 0;
+    Unsigned rG;
+    mpi::AllReduce(&rL, &rG, 1, mpi::LOGICAL_AND, mpi::COMM_WORLD);
+    return rG == 1;
+}
+
+//Compares each two-level collective against the flat one
+template<typename T>
+bool TestCollectives(Offset count, mpi::Comm comm){
+    const Int commRank = mpi::CommRank(comm);
+    const Int commSize = mpi::CommSize(comm);
+    const Offset total = commSize * count;
+    bool test = true;
+
+    std::vector<T> sbuf(total);
+    for(Offset i = 0; i < total; i++)
+        sbuf[i] = T(commRank * total + i);
+    std::vector<T> flat(total), hier(total);
+
+    mpi::AllGather(&(sbuf[0]), count, &(flat[0]), count, comm);
+    mpi::HierarchicalAllGather(&(sbuf[0]), count, &(hier[0]), count, comm);
+    test &= Equal(flat, hier);
+
+    mpi::AllToAll(&(sbuf[0]), count, &(flat[0]), count, comm);
+    mpi::HierarchicalAllToAll(&(sbuf[0]), count, &(hier[0]), count, comm);
+    test &= Equal(flat, hier);
+
+    std::vector<T> rsFlat(count), rsHier(count);
+    mpi::ReduceScatter(&(sbuf[0]), &(rsFlat[0]), count, comm);
+    mpi::HierarchicalReduceScatter(&(sbuf[0]), &(rsHier[0]), count, comm);
+    test &= Equal(rsFlat, rsHier);
+
+    mpi::AllReduce(&(sbuf[0]), &(flat[0]), total, comm);
+    mpi::HierarchicalAllReduce(&(sbuf[0]), &(hier[0]), total, comm);
+    test &= Equal(flat, hier);
+
+    return test;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+    const Int commSize = mpi::CommSize( comm );
+    bool test = true;
+    try
+    {
+        if(argc < 3){
+            Usage();
+            throw ArgException();
+        }
+        const Int nodeSize = atoi(argv[1]);
+        const Offset count = atoi(argv[2]);
+        if(nodeSize < 2 || commSize % nodeSize != 0 || commSize / nodeSize < 2){
+            if(commRank == 0)
+                std::cout << "nodeSize must be >1 and divide the number of processes into at least two nodes\n";
+            Usage();
+            throw ArgException();
+        }
+
+        mpi::SetHierarchical(mpi::ALLGATHER, 0);
+        mpi::SetHierarchical(mpi::ALLTOALL, 0);
+        mpi::SetHierarchical(mpi::REDUCESCATTER, 0);
+        mpi::SetHierarchical(mpi::ALLREDUCE, 0);
+        //Force the two-level path on a communicator not laid out yet, with
+        //nodes of consecutive and of interleaved ranks
+        for(Unsigned interleaved = 0; interleaved < 2; interleaved++){
+            mpi::SetHierarchicalNodeSize(nodeSize, interleaved == 1);
+            mpi::Comm testComm;
+            mpi::CommDup(comm, testComm);
+            if(!mpi::Hierarchical(mpi::ALLTOALL, count, testComm)){
+                if(commRank == 0)
+                    std::cout << "Two-level collectives not available\n";
+                test = false;
+            }else{
+                test &= TestCollectives<double>(count, testComm);
+                test &= TestCollectives<std::complex<double> >(count, testComm);
+            }
+            mpi::CommFree(testComm);
+        }
+        mpi::SetHierarchicalNodeSize(0);
+    }
+    catch( std::exception& e ) { test = false; ReportException(e); }
+
+    if(commRank == 0)
+        std::cout << "Hierarchical: " << (test ? "SUCCESS" : "FAILURE") << "\n";
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+#include "rote.hpp"
+using namespace rote;
+
+void Usage(){
+    std::cout << "./NodeShared\n";
+    std::cout << "Runs on 4 processes, as a 2x2 grid\n";
+}
+
+template<typename T>
+bool
+SameEntries(const DistTensor<T>& A, const DistTensor<T>& B, double tol){
+    const ObjShape shape = A.Shape();
+    if(B.Shape() != shape)
+        return false;
+    bool ok = true;
+    for(Unsigned i = 0; i < prod(shape); i++){
+        const Location loc = LinearLoc2Loc(i, shape);
+        if(Abs(A.Get(loc) - B.Get(loc)) > tol)
+            ok = false;
+    }
+    return ok;
+}
+
+//Replicated tensors share one copy per node; others stay private
+bool
+RedistTest(const Grid& g){
+    const ObjShape shape = {6, 5};
+    DistTensor<double> A(shape, TensorDistribution("[(0),(1)]"), g);
+    MakeUniform(A);
+    bool ok = true;
+
+    const char* dists[] = {"[(0),()]", "[(),(0)]", "[(),()]"};
+    for(Unsigned d = 0; d < 3; d++){
+        DistTensor<double> B(shape, TensorDistribution(dists[d]), g);
+        B.SetNodeShared();
+        ok = ok && B.NodeShared();
+        B.RedistFrom(A);
+        ok = SameEntries(A, B, 0) && ok;
+
+        //Resizing reallocates the window on every process
+        const ObjShape bigger = {9, 7};
+        DistTensor<double> C(bigger, TensorDistribution("[(0),(1)]"), g);
+        MakeUniform(C);
+        B.ResizeTo(bigger);
+        B.RedistFrom(C);
+        ok = SameEntries(C, B, 0) && ok;
+
+        //Set writes on the leader, NodeSync publishes it
+        for(Unsigned i = 0; i < prod(bigger); i++){
+            const Location loc = LinearLoc2Loc(i, bigger);
+            B.Set(loc, 2 * C.Get(loc));
+        }
+        B.NodeSync();
+        for(Unsigned i = 0; i < prod(bigger); i++){
+            const Location loc = LinearLoc2Loc(i, bigger);
+            if(B.Get(loc) != 2 * C.Get(loc))
+                ok = false;
+        }
+
+        B.SetNodePrivate();
+        ok = ok && !B.NodeShared();
+    }
+
+    DistTensor<double> D(shape, TensorDistribution("[(0),(1)]"), g);
+    D.SetNodeShared();
+    ok = ok && !D.NodeShared();
+    return ok;
+}
+
+//Contractions give the same result with node-shared intermediates
+bool
+ContractTest(const Grid& g){
+    const ObjShape shapeA = {8, 6}, shapeB = {6, 7}, shapeC = {8, 7};
+    DistTensor<double> A(shapeA, TensorDistribution("[(0),(1)]"), g);
+    DistTensor<double> B(shapeB, TensorDistribution("[(1),()]"), g);
+    DistTensor<double> C(shapeC, TensorDistribution("[(0),()]"), g);
+    MakeUniform(A);
+    MakeUniform(B);
+    MakeUniform(C);
+    DistTensor<double> CPrivate(C), CShared(C);
+    const std::vector<Unsigned> blkSizes(1, 4);
+
+    const bool share = NodeSharedIntermediates();
+    SetNodeSharedIntermediates(false);
+    Contract<double>::run(2.0, A, "ab", B, "bc", 3.0, CPrivate, "ac", blkSizes);
+    SetNodeSharedIntermediates(true);
+    Contract<double>::run(2.0, A, "ab", B, "bc", 3.0, CShared, "ac", blkSizes);
+    SetNodeSharedIntermediates(share);
+
+    return SameEntries(CPrivate, CShared, 1e-10);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+    const Int commSize = mpi::CommSize( comm );
+    bool test = true;
+    try
+    {
+        if(commSize != 4){
+            if(commRank == 0)
+                std::cerr << "program not started with 4 processes\n";
+            Usage();
+            throw ArgException();
+        }
+
+        const Grid g( comm, ObjShape({2, 2}) );
+
+        test &= RedistTest(g);
+        test &= ContractTest(g);
+
+        Unsigned rL = test ? 1 : 0;
+        Unsigned rG;
+        mpi::AllReduce(&rL, &rG, 1, mpi::LOGICAL_AND, comm);
+        test = rG == 1;
+    }
+    catch( std::exception& e ) { test = false; ReportException(e); }
+
+    if( commRank == 0 )
+        std::cout << "NodeShared: " << (test ? "SUCCESS" : "FAILURE") << std::endl;
+    Finalize();
+    return 0;
+}
@@ -208,6 +208,44 @@ int nElem(const ObjShape& s) {
   return n;
 }
 
+template<typename T>
+bool SameLocalEntries(const DistTensor<T>& A, const DistTensor<T>& B) {
+  const Tensor<T>& localA = A.LockedTensor();
+  const Tensor<T>& localB = B.LockedTensor();
+  bool test = localA.Shape() == localB.Shape();
+  const ObjShape shape = localA.Shape();
+  for(Unsigned i = 0; test && i < prod(shape); i++) {
+    const Location loc = LinearLoc2Loc(i, shape);
+    test = localA.Get(loc) == localB.Get(loc);
+  }
+
+  Unsigned rL = test ? 1 : 0;
+  Unsigned rG;
+  mpi::AllReduce(&rL, &rG, 1, mpi::LOGICAL_AND, mpi::COMM_WORLD);
+  return rG == 1;
+}
+
+// Repeats the redistribution with the one-sided all-to-all, both when the
+// peer-count limit admits it (fraction 1) and when it falls back (fraction 0)
+template<typename T>
+bool TestRMA(const DistTensor<T>& B, const DistTensor<T>& A, const Params& params, const T alpha, const T beta) {
+  const RMAEpoch epochs[2] = {RMA_FENCE, RMA_PSCW};
+  const double fractions[2] = {1.0, 0.0};
+  const RMAEpoch oldEpoch = AllToAllRMA();
+  const double oldFraction = AllToAllRMAPeerFraction();
+  bool test = true;
+  for(int e = 0; e < 2; e++) {
+    for(int f = 0; f < 2; f++) {
+      SetAllToAllRMA(epochs[e], fractions[f]);
+      DistTensor<T> C(B.Shape(), params.dB, B.Grid());
+      C.RedistFrom(A, params.reduceModes, alpha, beta);
+      test &= SameLocalEntries(B, C);
+    }
+  }
+  SetAllToAllRMA(oldEpoch, oldFraction);
+  return test;
+}
+
 template<typename T>
 bool TestRedist(const Grid& g, const Params& params) {
   ObjShape shapeB(params.sT.size() - params.reduceModes.size(), params.sT[0]);
@@ -217,7 +255,9 @@ bool TestRedist(const Grid& g, const Params& params) {
   T alpha = T(2);
   T beta = T(0);
   B.RedistFrom(A, params.reduceModes, alpha, beta);
-  return Test<T>(B, A, params.reduceModes, alpha, beta);
+  bool test = Test<T>(B, A, params.reduceModes, alpha, beta);
+  test &= TestRMA<T>(B, A, params, alpha, beta);
+  return test;
 }
 
 std::vector<std::string> SplitLine(const std::string& s, char delim='\t') {